@@ -2,5 +2,21 @@
 mkdir -p ./src/linux/
 wayland-scanner client-header /usr/share/wayland-protocols/stable/xdg-shell/xdg-shell.xml ./src/linux/xdg_shell_client_protocol.h
 wayland-scanner private-code /usr/share/wayland-protocols/stable/xdg-shell/xdg-shell.xml ./src/linux/xdg_shell_protocol.c
+wayland-scanner server-header /usr/share/wayland-protocols/stable/xdg-shell/xdg-shell.xml ./src/linux/xdg_shell_server_protocol.h
+wayland-scanner client-header /usr/share/wayland-protocols/staging/tearing-control/tearing-control-v1.xml ./src/linux/tearing_control_client_protocol.h
+wayland-scanner server-header /usr/share/wayland-protocols/staging/tearing-control/tearing-control-v1.xml ./src/linux/tearing_control_server_protocol.h
+wayland-scanner private-code /usr/share/wayland-protocols/staging/tearing-control/tearing-control-v1.xml ./src/linux/tearing_control_protocol.c
+wayland-scanner client-header /usr/share/wayland-protocols/unstable/relative-pointer/relative-pointer-unstable-v1.xml ./src/linux/relative_pointer_client_protocol.h
+wayland-scanner private-code /usr/share/wayland-protocols/unstable/relative-pointer/relative-pointer-unstable-v1.xml ./src/linux/relative_pointer_protocol.c
+wayland-scanner client-header /usr/share/wayland-protocols/unstable/pointer-constraints/pointer-constraints-unstable-v1.xml ./src/linux/pointer_constraints_client_protocol.h
+wayland-scanner private-code /usr/share/wayland-protocols/unstable/pointer-constraints/pointer-constraints-unstable-v1.xml ./src/linux/pointer_constraints_protocol.c
 
-clang -std=c23 -O0 -g src/linux_main.c -o bin/linux_main -lwayland-client -D_POSIX_C_SOURCE=200809L -DKSO_DEBUG=1 # -DKSO_VDEBUG=1
+clang -std=c23 -O0 -g src/linux_main.c -o bin/linux_main -lwayland-client -lwayland-cursor -lm -pthread -D_POSIX_C_SOURCE=200809L -DKSO_DEBUG=1 # -DKSO_VDEBUG=1
+clang -std=c23 -O2 src/tools/kanso_pack.c -o bin/kanso_pack -pthread -D_POSIX_C_SOURCE=200809L
+clang -std=c23 -O2 src/tools/kanso_stats.c -o bin/kanso_stats -D_POSIX_C_SOURCE=200809L
+clang -std=c23 -O2 src/tools/kanso_compositor.c -o bin/kanso_compositor -lwayland-server -D_POSIX_C_SOURCE=200809L
+clang -std=c23 -O1 -g -fsanitize=address,undefined src/tools/kanso_test.c -o bin/kanso_test -lm -pthread -D_POSIX_C_SOURCE=200809L
+clang -std=c23 -O1 -g -fsanitize=address,undefined src/tools/kanso_test.c -U__SSE2__ -o bin/kanso_test_scalar -lm -pthread -D_POSIX_C_SOURCE=200809L
+clang -std=c23 -O1 -g -fsanitize=address,undefined src/tools/kanso_test.c -mavx2 -o bin/kanso_test_avx2 -lm -pthread -D_POSIX_C_SOURCE=200809L
+clang -std=c23 -O2 src/tools/kanso_bench.c -o bin/kanso_bench -lm -pthread -D_POSIX_C_SOURCE=200809L
+clang -std=c23 -O2 -mavx2 src/tools/kanso_bench.c -o bin/kanso_bench_avx2 -lm -pthread -D_POSIX_C_SOURCE=200809L
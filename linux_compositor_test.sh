@@ -0,0 +1,8 @@
+#!/bin/env bash
+# Runs bin/linux_main against bin/kanso_compositor, no display needed; build it with linux_build.sh.
+# Corre bin/linux_main contra bin/kanso_compositor, sin pantalla; compilar antes con linux_build.sh.
+set -e
+./bin/kanso_compositor frames resize pointer close -- bin/linux_main
+./bin/kanso_compositor latency -- bin/linux_main
+./bin/kanso_compositor latency -- bin/linux_main --tearing
+./bin/kanso_compositor --size 800x600 --first-frame-budget 250 close -- bin/linux_main
@@ -0,0 +1,50 @@
+/* arena.h: linear memory arena | arena lineal de memoria */
+
+#pragma once
+#include "types.h"
+
+/*
+ * [EN] Caller-owned memory handed out linearly, everything is released at once by restoring an
+ * earlier mark.
+ * [ES] Memoria del llamador repartida linealmente, todo se libera a la vez al restaurar una marca
+ * anterior.
+ */
+typedef struct {
+	uint8* base;
+	uint64 size;
+	uint64 used;
+} MemoryArena;
+
+static inline MemoryArena arenaCreate(void* memory, uint64 size)
+{
+	return (MemoryArena){ .base = memory, .size = size, .used = 0 };
+}
+
+/*
+ * [EN] Returns nullptr, leaving the arena untouched, when it doesn't fit. alignment must be a power
+ * of two.
+ * [ES] Regresa nullptr, sin modificar la arena, cuando no cabe. alignment debe ser potencia de dos.
+ */
+static inline void* arenaPush(MemoryArena* arena, uint64 size, uint64 alignment)
+{
+	uint64 address = (uint64)(uintptr_t)(arena->base + arena->used);
+	uint64 padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+	if (padding > arena->size - arena->used || size > arena->size - arena->used - padding) {
+		return nullptr;
+	}
+	void* memory = arena->base + arena->used + padding;
+	arena->used += padding + size;
+	return memory;
+}
+
+static inline uint64 arenaMark(const MemoryArena* arena)
+{
+	return arena->used;
+}
+
+static inline void arenaRestore(MemoryArena* arena, uint64 mark)
+{
+	arena->used = mark;
+}
+
+/* 18/10/2026 - kanso engine */
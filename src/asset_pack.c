@@ -0,0 +1,88 @@
+/* asset_pack.c: asset pack format | formato de paquetes de recursos */
+
+#include "defines.h"
+#include "types.h"
+#include "log.h"
+#include "asset_pack.h"
+
+#include <string.h>
+
+uint64 assetHashName(const char* name)
+{
+	uint64 hash = 0xCBF2'9CE4'8422'2325ull; // FNV-1a 64-bit offset basis
+	for (const char* c = name; *c != '\0'; ++c) {
+		hash ^= (uint8)*c;
+		hash *= 0x0000'0100'0000'01B3ull; // FNV-1a 64-bit prime
+	}
+	return hash;
+}
+
+bool8 assetPackValidate(const uint8* memory, uint64 size)
+{
+	if (size < sizeof(AssetPackHeader)) {
+		logError("Asset pack too small (%llu bytes).", (unsigned long long)size);
+		return false;
+	}
+	const AssetPackHeader* header = (const AssetPackHeader*)memory;
+	if (header->magic != ASSET_PACK_MAGIC) {
+		logError("Not an asset pack, wrong magic number 0x%08X.", header->magic);
+		return false;
+	}
+	if (header->version != ASSET_PACK_VERSION) {
+		logError("Unsupported asset pack version %u, expected %u.", header->version,
+				ASSET_PACK_VERSION);
+		return false;
+	}
+	if (header->file_size != size || header->alignment != ASSET_PACK_ALIGNMENT) {
+		logError("Asset pack truncated or with an unexpected alignment.");
+		return false;
+	}
+	uint64 toc_size = (uint64)header->entry_count * sizeof(AssetPackEntry);
+	if (header->toc_offset % alignof(AssetPackEntry) != 0 || header->toc_offset > size
+			|| toc_size > size - header->toc_offset) {
+		logError("Asset pack table of contents out of bounds.");
+		return false;
+	}
+
+	const AssetPackEntry* entries = (const AssetPackEntry*)(memory + header->toc_offset);
+	for (uint32 i = 0; i < header->entry_count; ++i) {
+		const AssetPackEntry* entry = &entries[i];
+		if (entry->offset % ASSET_PACK_ALIGNMENT != 0 || entry->offset > size
+				|| entry->size > size - entry->offset
+				|| memchr(entry->name, '\0', ASSET_NAME_SIZE) == nullptr
+				|| (i > 0 && entries[i - 1].name_hash > entry->name_hash)) {
+			logError("Asset pack entry %u is invalid.", i);
+			return false;
+		}
+	}
+	return true;
+}
+
+const AssetPackEntry* assetPackFind(const AssetPack* pack, const char* name)
+{
+	uint64 hash = assetHashName(name);
+	// [EN] Binary search for the first entry with the hash | [ES] Búsqueda binaria del primero
+	uint32 low = 0;
+	uint32 high = pack->header->entry_count;
+	while (low < high) {
+		uint32 middle = low + ((high - low) / 2);
+		if (pack->entries[middle].name_hash < hash) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	for (uint32 i = low; i < pack->header->entry_count && pack->entries[i].name_hash == hash; ++i) {
+		if (!strcmp(pack->entries[i].name, name)) { // hash collisions | colisiones de hash
+			return &pack->entries[i];
+		}
+	}
+	return nullptr;
+}
+
+const void* assetPackData(const AssetPack* pack, const AssetPackEntry* entry)
+{
+	return pack->memory + entry->offset;
+}
+
+/* 18/10/2026 - kanso engine */
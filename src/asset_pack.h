@@ -0,0 +1,88 @@
+/* asset_pack.h: asset pack format and loading declarations | formato y carga de paquetes de recursos */
+
+#pragma once
+#include "types.h"
+
+/*
+ * [EN] Pack layout, every integer little endian:
+ *    AssetPackHeader
+ *    AssetPackEntry[entry_count], sorted by name_hash (table of contents)
+ *    data, every asset starts at a multiple of ASSET_PACK_ALIGNMENT
+ * The file is mapped read-only and assets are used in place, without copies. The header and the
+ * table of contents are used in place too, so they are written in host byte order and the format
+ * is only supported on little endian hosts.
+ * [ES] Estructura del paquete, todos los enteros en little endian:
+ *    AssetPackHeader
+ *    AssetPackEntry[entry_count], ordenadas por name_hash (tabla de contenidos)
+ *    datos, cada recurso empieza en un múltiplo de ASSET_PACK_ALIGNMENT
+ * El archivo se mapea como sólo lectura y los recursos se usan en su lugar, sin copias. El
+ * encabezado y la tabla de contenidos también se usan en su lugar, así que se escriben en el orden
+ * de bytes del anfitrión y el formato sólo se admite en anfitriones little endian.
+ */
+#define ASSET_PACK_MAGIC 0x4B50'534Bu // "KSPK"
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_ALIGNMENT 64 // cache line, enough for any SIMD load | suficiente para SIMD
+#define ASSET_NAME_SIZE 40
+
+typedef struct {
+	uint32 magic;
+	uint32 version;
+	uint32 entry_count;
+	uint32 alignment;
+	uint64 toc_offset;
+	uint64 file_size;
+} AssetPackHeader;
+
+typedef struct {
+	uint64 name_hash; // assetHashName(name)
+	uint64 offset; // from the start of the file | desde el inicio del archivo
+	uint64 size;
+	char name[ASSET_NAME_SIZE]; // null-terminated | terminado con el caracter nulo
+} AssetPackEntry;
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "Asset packs need a little endian host");
+static_assert(sizeof(AssetPackHeader) == 32, "Unexpected AssetPackHeader size, check padding");
+static_assert(sizeof(AssetPackEntry) == 64, "Unexpected AssetPackEntry size, check padding");
+
+typedef struct {
+	const uint8* memory; // whole file | archivo completo
+	uint64 size;
+	const AssetPackHeader* header;
+	const AssetPackEntry* entries;
+} AssetPack;
+
+uint64 assetHashName(const char* name); // FNV-1a
+
+/*
+ * [EN] Checks the header and that every entry lies inside the file, before trusting the pack.
+ * [ES] Revisa el encabezado y que cada entrada esté dentro del archivo, antes de confiar en el
+ * paquete.
+ */
+[[nodiscard]] bool8 assetPackValidate(const uint8* memory, uint64 size);
+const AssetPackEntry* assetPackFind(const AssetPack* pack, const char* name);
+const void* assetPackData(const AssetPack* pack, const AssetPackEntry* entry);
+
+/* platform | plataforma */
+[[nodiscard]] bool8 assetPackOpen(AssetPack* pack, const char* path);
+void assetPackClose(AssetPack* pack);
+
+/*
+ * [EN] Background loader: a thread that makes requested assets resident in memory, so using them
+ * never page-faults on the calling thread. Completions are delivered by assetLoaderDispatch() on the
+ * thread that owns the event loop, which should wake up when assetLoaderGetWakeFd() is readable.
+ * [ES] Cargador en segundo plano: un hilo que vuelve residentes en memoria los recursos pedidos, para
+ * que usarlos nunca cause fallos de página en el hilo que llama. Las finalizaciones se entregan con
+ * assetLoaderDispatch() en el hilo dueño del ciclo de eventos, que debería despertar cuando
+ * assetLoaderGetWakeFd() sea legible.
+ */
+typedef struct AssetLoader AssetLoader;
+typedef void AssetLoadedCallback(void* context, const AssetPackEntry* entry, const void* data);
+
+[[nodiscard]] bool8 assetLoaderStart(AssetLoader* loader, const AssetPack* pack);
+void assetLoaderStop(AssetLoader* loader);
+[[nodiscard]] bool8 assetLoaderRequest(AssetLoader* loader, const AssetPackEntry* entry,
+		AssetLoadedCallback* callback, void* context);
+int32 assetLoaderGetWakeFd(const AssetLoader* loader);
+int32 assetLoaderDispatch(AssetLoader* loader); // returns completions delivered | entregadas
+
+/* 18/10/2026 - kanso engine */
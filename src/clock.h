@@ -0,0 +1,29 @@
+/* clock.h: monotonic clock declarations | declaraciones del reloj monotónico */
+
+#pragma once
+#include "types.h"
+
+#define NANOSECONDS_PER_MILLISECOND 1'000'000ull
+#define NANOSECONDS_PER_SECOND 1'000'000'000ull
+
+/*
+ * [EN] Nanoseconds since an unspecified point in the past, never goes backwards.
+ * [ES] Nanosegundos desde un punto no especificado en el pasado, nunca retrocede.
+ */
+uint64 clockNowNanoseconds(void);
+
+/*
+ * [EN] When the process started, on the clockNowNanoseconds() clock. Only as precise as the
+ * platform records it (the scheduler tick on linux, usually 10 ms), 0 when unknown.
+ * [ES] Cuándo inició el proceso, en el reloj de clockNowNanoseconds(). Sólo tan preciso como la
+ * plataforma lo registre (el tick del planificador en linux, normalmente 10 ms), 0 si se
+ * desconoce.
+ */
+uint64 clockProcessStartNanoseconds(void);
+
+static inline float32 clockNanosecondsToMilliseconds(uint64 nanoseconds)
+{
+	return (float32)((float64)nanoseconds / NANOSECONDS_PER_MILLISECOND);
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,75 @@
+/* frame_capture.c: frame capture conversion | conversión de fotogramas capturados */
+
+#include "defines.h"
+#include "types.h"
+#include "render.h"
+#include "frame_capture.h"
+
+uint64 frameCaptureYuv420Size(int32 width, int32 height)
+{
+	uint64 chroma_size = (uint64)((width + 1) / 2) * ((height + 1) / 2);
+	return ((uint64)width * height) + (2 * chroma_size);
+}
+
+/*
+ * [EN] BT.601 full range (JPEG) in 8-bit fixed point, chroma biased by 128 << 8 to stay positive.
+ * [ES] BT.601 de rango completo (JPEG) en punto fijo de 8 bits, el croma se sesga con 128 << 8 para
+ * mantenerse positivo.
+ */
+internal inline uint8 frameCaptureLuma(uint32 pxl)
+{
+	uint32 r = (pxl >> 16) & 0xFF, g = (pxl >> 8) & 0xFF, b = pxl & 0xFF;
+	return (uint8)(((77 * r) + (150 * g) + (29 * b) + 128) >> 8);
+}
+
+internal inline uint8 frameCaptureClamp(int32 value)
+{
+	return (uint8)((value > 255) ? 255 : value);
+}
+
+void frameCaptureConvertToYuv420(const Bitmap* frame, uint8* yuv)
+{
+	int32 width = frame->width;
+	int32 height = frame->height;
+	int32 chroma_width = (width + 1) / 2;
+	int32 chroma_height = (height + 1) / 2;
+	uint8* luma = yuv;
+	uint8* blue_chroma = yuv + ((uint64)width * height);
+	uint8* red_chroma = blue_chroma + ((uint64)chroma_width * chroma_height);
+
+	for (int32 chroma_row = 0; chroma_row < chroma_height; ++chroma_row) {
+		int32 row = 2 * chroma_row;
+		int32 next_row = (row + 1 < height) ? row + 1 : row; // odd heights | alturas impares
+		const uint32* top = (const uint32*)((const uint8*)frame->memory
+				+ ((int64)row * frame->bytes_per_row));
+		const uint32* bottom = (const uint32*)((const uint8*)frame->memory
+				+ ((int64)next_row * frame->bytes_per_row));
+		uint8* top_luma = luma + ((int64)row * width);
+		uint8* bottom_luma = luma + ((int64)next_row * width);
+
+		for (int32 chroma_col = 0; chroma_col < chroma_width; ++chroma_col) {
+			int32 col = 2 * chroma_col;
+			int32 next_col = (col + 1 < width) ? col + 1 : col;
+			uint32 block[4] = { top[col], top[next_col], bottom[col], bottom[next_col] };
+			top_luma[col] = frameCaptureLuma(block[0]);
+			top_luma[next_col] = frameCaptureLuma(block[1]);
+			bottom_luma[col] = frameCaptureLuma(block[2]);
+			bottom_luma[next_col] = frameCaptureLuma(block[3]);
+
+			int32 r = 0, g = 0, b = 0;
+			for (int32 i = 0; i < 4; ++i) {
+				r += (block[i] >> 16) & 0xFF;
+				g += (block[i] >> 8) & 0xFF;
+				b += block[i] & 0xFF;
+			}
+			// [EN] Sums of 4 samples, the extra >> 2 averages them | [ES] El >> 2 extra promedia
+			int32 chroma_index = (chroma_row * chroma_width) + chroma_col;
+			blue_chroma[chroma_index] = frameCaptureClamp(((-43 * r) - (85 * g) + (128 * b)
+						+ (128 << 10) + 512) >> 10);
+			red_chroma[chroma_index] = frameCaptureClamp(((128 * r) - (107 * g) - (21 * b)
+						+ (128 << 10) + 512) >> 10);
+		}
+	}
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,53 @@
+/* frame_capture.h: asynchronous frame capture declarations | declaraciones de captura asíncrona */
+
+#pragma once
+#include "types.h"
+#include "render.h"
+
+#define FRAME_CAPTURE_RING_SIZE 4 // staging buffers | 'buffers' de preparación
+#define FRAME_CAPTURE_FRAME_RATE 60 // nominal, written in the Y4M header | nominal, para Y4M
+
+typedef enum {
+	FRAME_CAPTURE_RAW, // x:R:G:B frames back to back, no header | seguidos, sin encabezado
+	FRAME_CAPTURE_Y4M, // YUV4MPEG2, 4:2:0 full range (C420jpeg)
+} FrameCaptureFormat;
+
+typedef struct {
+	uint64 submitted;
+	uint64 written;
+	uint64 dropped; // ring full or frame size changed | anillo lleno o cambió el tamaño
+} FrameCaptureStats;
+
+/*
+ * [EN] The render loop hands every presented frame to frameCaptureSubmit(), which only copies it
+ * into a free staging buffer; a writer thread converts and streams the staging buffers to disk.
+ * When no staging buffer is free the frame is dropped and counted, the render loop never waits for
+ * the disk. Every frame must have the size of the first one, the staging buffers are allocated
+ * then.
+ * [ES] El ciclo de dibujo entrega cada fotograma presentado a frameCaptureSubmit(), que sólo lo
+ * copia a un 'buffer' de preparación libre; un hilo escritor convierte y envía los 'buffers' al
+ * disco. Cuando no hay un 'buffer' libre el fotograma se descarta y se cuenta, el ciclo de dibujo
+ * nunca espera al disco. Cada fotograma debe tener el tamaño del primero, los 'buffers' se reservan
+ * entonces.
+ */
+typedef struct FrameCapture FrameCapture;
+
+/*
+ * [EN] Converts an x:R:G:B frame to planar 4:2:0, chroma is averaged over 2x2 blocks. yuv holds
+ * width * height luma bytes followed by both chroma planes of
+ * ((width + 1) / 2) * ((height + 1) / 2).
+ * [ES] Convierte un fotograma x:R:G:B a 4:2:0 planar, el croma se promedia en bloques de 2x2. yuv
+ * contiene width * height bytes de luma seguidos de ambos planos de croma de
+ * ((width + 1) / 2) * ((height + 1) / 2).
+ */
+void frameCaptureConvertToYuv420(const Bitmap* frame, uint8* yuv);
+uint64 frameCaptureYuv420Size(int32 width, int32 height);
+
+/* platform | plataforma */
+[[nodiscard]] bool8 frameCaptureStart(FrameCapture* capture, const char* path,
+		FrameCaptureFormat format);
+void frameCaptureStop(FrameCapture* capture); // writes every queued frame | escribe los pendientes
+bool8 frameCaptureSubmit(FrameCapture* capture, const Bitmap* frame); // false when dropped
+FrameCaptureStats frameCaptureGetStats(FrameCapture* capture);
+
+/* 18/10/2026 - kanso engine */
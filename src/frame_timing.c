@@ -0,0 +1,82 @@
+/* frame_timing.c: fixed timestep and frame pacing | paso fijo y ritmo de fotogramas */
+
+#include "defines.h"
+#include "types.h"
+#include "clock.h"
+#include "frame_timing.h"
+
+#define FRAME_PACER_MIN_INTERVAL 4'000'000ull // 250 Hz
+#define FRAME_PACER_MAX_INTERVAL 50'000'000ull // 20 Hz, longer gaps are the window being hidden
+
+void fixedTimestepInitialize(FixedTimestep* timestep, uint32 tick_rate, uint64 now)
+{
+	*timestep = (FixedTimestep){ .tick_duration = NANOSECONDS_PER_SECOND / tick_rate,
+		.last_time = now };
+}
+
+int32 fixedTimestepAdvance(FixedTimestep* timestep, uint64 now)
+{
+	timestep->accumulator += now - timestep->last_time;
+	timestep->last_time = now;
+	uint64 max_accumulated = SIMULATION_MAX_TICKS_PER_FRAME * timestep->tick_duration;
+	if (timestep->accumulator > max_accumulated) { // spiral of death | espiral de la muerte
+		timestep->accumulator = max_accumulated;
+	}
+	int32 ticks = (int32)(timestep->accumulator / timestep->tick_duration);
+	timestep->accumulator -= ticks * timestep->tick_duration;
+	timestep->tick_count += ticks;
+	return ticks;
+}
+
+float32 fixedTimestepAlpha(const FixedTimestep* timestep)
+{
+	return (float32)((float64)timestep->accumulator / (float64)timestep->tick_duration);
+}
+
+void framePacerInitialize(FramePacer* pacer)
+{
+	*pacer = (FramePacer){ .frame_interval = FRAME_PACER_DEFAULT_INTERVAL };
+}
+
+void framePacerFrameDone(FramePacer* pacer, uint64 now)
+{
+	if (pacer->last_frame_done != 0) {
+		uint64 interval = now - pacer->last_frame_done;
+		bool8 missed = interval > pacer->frame_interval + (pacer->frame_interval / 2);
+		if (!missed) {
+			pacer->long_intervals = 0;
+		} else if (pacer->long_intervals < FRAME_PACER_LONG_INTERVALS) {
+			pacer->long_intervals++;
+			interval = 0; // a missed vblank, ignored | un 'vblank' perdido, se ignora
+		}
+		if (interval >= FRAME_PACER_MIN_INTERVAL && interval <= FRAME_PACER_MAX_INTERVAL) {
+			// [EN] Exponential average, 1/8 of the new sample | [ES] Promedio exponencial, 1/8
+			pacer->frame_interval = pacer->frame_interval - (pacer->frame_interval / 8)
+				+ (interval / 8);
+		}
+	}
+	pacer->last_frame_done = now;
+}
+
+void framePacerRecordRenderCost(FramePacer* pacer, uint64 render_cost)
+{
+	if (render_cost > pacer->render_cost) {
+		pacer->render_cost = render_cost;
+	} else {
+		pacer->render_cost -= (pacer->render_cost - render_cost) / 32;
+	}
+}
+
+uint64 framePacerRenderDeadline(const FramePacer* pacer)
+{
+	if (pacer->last_frame_done == 0) {
+		return 0; // no callback yet, render now | sin 'callback' aún, dibujar ya
+	}
+	uint64 lead = pacer->render_cost + FRAME_PACER_MARGIN + FRAME_PACER_WAKE_SLACK;
+	if (lead >= pacer->frame_interval) {
+		return pacer->last_frame_done; // can't be late enough, render right away | dibujar ya
+	}
+	return pacer->last_frame_done + pacer->frame_interval - lead;
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,61 @@
+/* frame_timing.h: fixed timestep and frame pacing declarations | declaraciones de paso fijo */
+
+#pragma once
+#include "types.h"
+
+/*
+ * [EN] The simulation advances in fixed ticks consumed from an accumulator of real time, rendering
+ * interpolates between the last two ticks with alpha = leftover time / tick duration. Speeds are
+ * expressed per tick, 60 Hz keeps the feel of the speeds tuned when the loop was frame based.
+ * [ES] La simulación avanza en pasos fijos consumidos de un acumulador de tiempo real, el dibujo
+ * interpola entre los últimos dos pasos con alpha = tiempo restante / duración del paso. Las
+ * velocidades se expresan por paso, 60 Hz conserva la sensación de las velocidades ajustadas cuando
+ * el ciclo se basaba en fotogramas.
+ */
+#define SIMULATION_TICK_RATE 60
+#define SIMULATION_MAX_TICKS_PER_FRAME 8 // after a stall time is dropped | tras una pausa se pierde
+
+typedef struct {
+	uint64 tick_duration; // nanoseconds
+	uint64 accumulator; // nanoseconds not simulated yet | nanosegundos aún sin simular
+	uint64 last_time; // nanoseconds, clockNowNanoseconds()
+	uint64 tick_count;
+} FixedTimestep;
+
+void fixedTimestepInitialize(FixedTimestep* timestep, uint32 tick_rate, uint64 now);
+int32 fixedTimestepAdvance(FixedTimestep* timestep, uint64 now); // ticks to simulate | pasos
+float32 fixedTimestepAlpha(const FixedTimestep* timestep); // [0, 1)
+
+/*
+ * [EN] Just-in-time pacing: predicts the next frame callback from the previous ones and starts
+ * rendering render_cost + margin before it, so the frame samples input as late as possible. The
+ * render cost estimate rises at once on a slow frame and decays slowly. A frame that misses its
+ * vblank makes the next callback come a refresh late, such intervals don't count until
+ * FRAME_PACER_LONG_INTERVALS come in a row (the refresh rate did change), or a single miss would
+ * teach the pacer a slower rate and it would keep missing.
+ * [ES] Ritmo justo a tiempo: predice el siguiente 'callback' de fotograma a partir de los
+ * anteriores y empieza a dibujar render_cost + margen antes, para que el fotograma lea la entrada
+ * lo más tarde posible. La estimación del costo de dibujo sube de inmediato con un fotograma lento
+ * y baja lentamente. Un fotograma que pierde su 'vblank' hace que el siguiente 'callback' llegue un
+ * refresco tarde, esos intervalos no cuentan hasta que llegan FRAME_PACER_LONG_INTERVALS seguidos
+ * (la tasa de refresco sí cambió), o una sola pérdida le enseñaría al ritmo una tasa más lenta y
+ * seguiría perdiendo.
+ */
+#define FRAME_PACER_MARGIN 2'000'000ull // nanoseconds for the compositor to latch | para latch
+#define FRAME_PACER_WAKE_SLACK 1'000'000ull // poll timeouts round up to milliseconds | redondeo
+#define FRAME_PACER_LONG_INTERVALS 8
+#define FRAME_PACER_DEFAULT_INTERVAL 16'666'667ull
+
+typedef struct {
+	uint64 last_frame_done; // nanoseconds, 0 before the first callback | antes del primero
+	uint64 frame_interval; // nanoseconds, smoothed | suavizado
+	uint64 render_cost; // nanoseconds, estimate | estimación
+	uint32 long_intervals; // in a row | seguidos
+} FramePacer;
+
+void framePacerInitialize(FramePacer* pacer);
+void framePacerFrameDone(FramePacer* pacer, uint64 now);
+void framePacerRecordRenderCost(FramePacer* pacer, uint64 render_cost);
+uint64 framePacerRenderDeadline(const FramePacer* pacer); // when to start to render | cuándo
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,323 @@
+/* hud.c: on-screen performance display | panel de rendimiento en pantalla */
+
+#include "defines.h"
+#include "types.h"
+#include "log.h"
+#include "render.h"
+#include "text.h"
+#include "hud.h"
+#include "perf_counters.h"
+#include "clock.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define HUD_MARGIN 8
+#define HUD_PADDING 6
+#define HUD_TEXT_SCALE 2
+#define HUD_GRAPH_BAR_WIDTH 2
+#define HUD_GRAPH_HEIGHT 48
+#define HUD_GRAPH_MAX_TIME 33.3f // milliseconds at the top of the graph | ms en el tope de la gráfica
+#define HUD_TARGET_FRAME_TIME 16.7f
+#define HUD_MAX_DRAW_TIME 0.1f // budget in milliseconds | presupuesto en milisegundos
+
+#define HUD_TEXT_COLOR 0xFFE0'E0E0
+#define HUD_GOOD_COLOR 0xFF40'C040
+#define HUD_SLOW_COLOR 0xFFE0'C040
+#define HUD_BAD_COLOR 0xFFE0'4040
+#define HUD_TARGET_COLOR 0xFF80'8080
+#define HUD_LAYER_COLOR 0xB000'0000 // premultiplied translucent black | negro translúcido
+
+bool8 hudInitialize(Hud* hud)
+{
+	*hud = (Hud){ 0 };
+	if (!textAtlasCreate(&hud->atlas, HUD_TEXT_SCALE)) {
+		return false;
+	}
+	hud->initialized = true;
+	return true;
+}
+
+void hudDestroy(Hud* hud)
+{
+	if (hud->initialized) {
+		textAtlasDestroy(&hud->atlas);
+		hud->initialized = false;
+	}
+}
+
+void hudToggle(Hud* hud)
+{
+	hud->visible = !hud->visible && hud->initialized;
+	hud->max_draw_time = 0;
+}
+
+void hudRecordFrameTime(Hud* hud, float32 frame_time)
+{
+	hud->frame_times[hud->next_frame_time] = frame_time;
+	hud->next_frame_time = (hud->next_frame_time + 1) % HUD_GRAPH_SAMPLES;
+	hud->frames_recorded++;
+	if (hud->frame_time_count < HUD_GRAPH_SAMPLES) {
+		hud->frame_time_count++;
+	}
+}
+
+/*
+ * [EN] Halves the brightness of a clipped rectangle, cheaper than a real blend.
+ * [ES] Reduce a la mitad el brillo de un rectángulo recortado, más barato que una mezcla real.
+ */
+internal void hudDarkenRectangle(Bitmap* target, int32 x, int32 y, int32 width, int32 height)
+{
+	int32 last_col = (x + width < target->width) ? x + width : target->width;
+	int32 last_row = (y + height < target->height) ? y + height : target->height;
+	for (int32 row = (y > 0) ? y : 0; row < last_row; ++row) {
+		uint32* pxl = (uint32*)((uint8*)target->memory + ((int64)row * target->bytes_per_row));
+		for (int32 col = (x > 0) ? x : 0; col < last_col; ++col) {
+			pxl[col] = (pxl[col] >> 1) & 0x007F'7F7F;
+		}
+	}
+}
+
+internal void hudFillRectangle(Bitmap* target, int32 x, int32 y, int32 width, int32 height,
+		uint32 color)
+{
+	int32 last_col = (x + width < target->width) ? x + width : target->width;
+	int32 last_row = (y + height < target->height) ? y + height : target->height;
+	for (int32 row = (y > 0) ? y : 0; row < last_row; ++row) {
+		uint32* pxl = (uint32*)((uint8*)target->memory + ((int64)row * target->bytes_per_row));
+		for (int32 col = (x > 0) ? x : 0; col < last_col; ++col) {
+			pxl[col] = color;
+		}
+	}
+}
+
+internal void hudDrawGraph(Hud* hud, Bitmap* target, int32 x, int32 y)
+{
+	int32 target_line = y + HUD_GRAPH_HEIGHT
+		- (int32)((HUD_TARGET_FRAME_TIME / HUD_GRAPH_MAX_TIME) * HUD_GRAPH_HEIGHT);
+	hudFillRectangle(target, x, target_line, HUD_GRAPH_SAMPLES * HUD_GRAPH_BAR_WIDTH, 1,
+			HUD_TARGET_COLOR);
+
+	// [EN] Oldest sample on the left | [ES] La muestra más antigua a la izquierda
+	int32 first = (hud->next_frame_time - hud->frame_time_count + HUD_GRAPH_SAMPLES)
+		% HUD_GRAPH_SAMPLES;
+	int32 bar_x = x + ((HUD_GRAPH_SAMPLES - hud->frame_time_count) * HUD_GRAPH_BAR_WIDTH);
+	for (int32 i = 0; i < hud->frame_time_count; ++i) {
+		float32 frame_time = hud->frame_times[(first + i) % HUD_GRAPH_SAMPLES];
+		int32 bar_height = (int32)((frame_time / HUD_GRAPH_MAX_TIME) * HUD_GRAPH_HEIGHT);
+		if (bar_height > HUD_GRAPH_HEIGHT) {
+			bar_height = HUD_GRAPH_HEIGHT;
+		} else if (bar_height < 1) {
+			bar_height = 1;
+		}
+		uint32 color = HUD_GOOD_COLOR;
+		if (frame_time > HUD_GRAPH_MAX_TIME) {
+			color = HUD_BAD_COLOR;
+		} else if (frame_time > HUD_TARGET_FRAME_TIME + 1.0f) {
+			color = HUD_SLOW_COLOR;
+		}
+		hudFillRectangle(target, bar_x, y + HUD_GRAPH_HEIGHT - bar_height, HUD_GRAPH_BAR_WIDTH - 1,
+				bar_height, color);
+		bar_x += HUD_GRAPH_BAR_WIDTH;
+	}
+}
+
+internal int32 hudPanelWidth(const Hud* hud)
+{
+	int32 graph_width = HUD_GRAPH_SAMPLES * HUD_GRAPH_BAR_WIDTH;
+	int32 text_width = HUD_TEXT_COLUMNS * hud->atlas.advance;
+	return 2 * HUD_PADDING + ((graph_width > text_width) ? graph_width : text_width);
+}
+
+internal int32 hudPanelHeight(const Hud* hud, int32 line_count)
+{
+	return (2 * HUD_PADDING) + (line_count * hud->atlas.line_height) + HUD_GRAPH_HEIGHT;
+}
+
+internal void hudFormatLines(const Hud* hud, const HudBufferStats* stats, HudLines* formatted)
+{
+	float32 last = 0;
+	float32 sum = 0;
+	float32 max = 0;
+	for (int32 i = 0; i < hud->frame_time_count; ++i) {
+		float32 frame_time = hud->frame_times[i];
+		sum += frame_time;
+		max = (frame_time > max) ? frame_time : max;
+	}
+	if (hud->frame_time_count > 0) {
+		last = hud->frame_times[(hud->next_frame_time + HUD_GRAPH_SAMPLES - 1) % HUD_GRAPH_SAMPLES];
+	}
+	float32 average = (hud->frame_time_count > 0) ? sum / hud->frame_time_count : 0;
+
+	// [EN] Formats fit HUD_TEXT_COLUMNS, snprintf() cuts the rare value that doesn't
+	// [ES] Los formatos caben en HUD_TEXT_COLUMNS, snprintf() corta el raro valor que no cabe
+	char (*lines)[HUD_TEXT_COLUMNS + 1] = formatted->text;
+	snprintf(lines[0], sizeof(lines[0]), "FRAME %6.2f MS %6.1f FPS", last,
+			(average > 0) ? 1000.0f / average : 0);
+	snprintf(lines[1], sizeof(lines[1]), "AVG %6.2f  MAX %6.2f MS", average, max);
+	snprintf(lines[2], sizeof(lines[2]), "RENDER %6.2f MS", stats->render_time);
+	snprintf(lines[3], sizeof(lines[3]), "LATENCY %6.2f MS %s", stats->presentation_latency,
+			stats->tearing ? "ASYNC" : "VSYNC");
+	snprintf(lines[4], sizeof(lines[4]), "BUF %d/%d %dX%d %dB", stats->buffer_index + 1,
+			stats->buffer_count, stats->width, stats->height, stats->bytes_per_row);
+	snprintf(lines[5], sizeof(lines[5]), "EVENTS %5.0f/S MAX %5.3f", stats->events_per_second,
+			stats->max_event_dispatch_time);
+	int32 line_count = 6;
+	if (stats->raw_pointer) {
+		snprintf(lines[line_count++], sizeof(lines[0]), "POINTER %5.0f/S %3u/FRAME",
+				stats->pointer_event_rate, stats->pointer_events);
+	}
+	const PerfFrameStats* perf = stats->perf;
+	if (perf && perf->mode == PERF_COUNTERS_HARDWARE) { // misses per 1000 instructions | por mil
+		snprintf(lines[line_count++], sizeof(lines[0]), "IPC %4.2f LLC%5.1f TLB%5.1f",
+				perf->instructions_per_cycle, perf->llc_misses_per_kilo_instruction,
+				perf->dtlb_misses_per_kilo_instruction);
+	} else if (perf && perf->mode == PERF_COUNTERS_SOFTWARE) {
+		snprintf(lines[line_count++], sizeof(lines[0]), "SOFTWARE COUNTERS ONLY");
+	}
+	if (perf && perf->mode != PERF_COUNTERS_OFF) {
+		snprintf(lines[line_count++], sizeof(lines[0]), "CPU %6.2f MS FAULTS %4llu",
+				perf->cpu_time, (unsigned long long)perf->page_faults);
+	}
+	snprintf(lines[line_count++], sizeof(lines[0]), "HUD %5.3f MS MAX %5.3f", hud->draw_time,
+			hud->max_draw_time);
+	formatted->count = line_count;
+	formatted->over_budget = hud->max_draw_time > HUD_MAX_DRAW_TIME;
+}
+
+/*
+ * [EN] Text of lines and the graph, with the panel's top-left corner at (x, y). Lines outside
+ * target are skipped, the rest is clipped.
+ * [ES] Texto de lines y la gráfica, con la esquina superior izquierda del panel en (x, y). Las
+ * líneas fuera de target se saltan, el resto se recorta.
+ */
+internal void hudDrawContents(Hud* hud, const HudLines* lines, Bitmap* target, int32 x, int32 y)
+{
+	x += HUD_PADDING;
+	y += HUD_PADDING;
+	for (int32 i = 0; i < lines->count; ++i) {
+		if (y < target->height && y + hud->atlas.line_height > 0) {
+			bool8 over_budget = i == lines->count - 1 && lines->over_budget;
+			textDraw(target, &hud->atlas, x, y, lines->text[i],
+					over_budget ? HUD_BAD_COLOR : HUD_TEXT_COLOR);
+		}
+		y += hud->atlas.line_height;
+	}
+	if (y < target->height && y + HUD_GRAPH_HEIGHT > 0) {
+		hudDrawGraph(hud, target, x, y);
+	}
+}
+
+internal void hudRecordDrawTime(Hud* hud, uint64 start)
+{
+	hud->draw_time = clockNanosecondsToMilliseconds(clockNowNanoseconds() - start);
+	if (hud->draw_time > hud->max_draw_time) {
+		hud->max_draw_time = hud->draw_time;
+	}
+}
+
+void hudDraw(Hud* hud, Bitmap* target, const HudBufferStats* stats)
+{
+	if (!hud->visible) {
+		return;
+	}
+	uint64 start = clockNowNanoseconds();
+	HudLines lines;
+	hudFormatLines(hud, stats, &lines);
+	hudDarkenRectangle(target, HUD_MARGIN, HUD_MARGIN, hudPanelWidth(hud),
+			hudPanelHeight(hud, lines.count));
+	hudDrawContents(hud, &lines, target, HUD_MARGIN, HUD_MARGIN);
+	hudRecordDrawTime(hud, start);
+}
+
+void hudLayerSize(const Hud* hud, int32* width, int32* height)
+{
+	*width = HUD_MARGIN + hudPanelWidth(hud);
+	*height = HUD_MARGIN + hudPanelHeight(hud, HUD_TEXT_LINES);
+}
+
+HudLayerChanges hudUpdateLayer(Hud* hud, const HudBufferStats* stats)
+{
+	HudLines previous = hud->layer_lines;
+	HudLines* lines = &hud->layer_lines;
+	hudFormatLines(hud, stats, lines);
+
+	// [EN] Another line count moves the graph and resizes the panel
+	// [ES] Otra cantidad de líneas mueve la gráfica y cambia el tamaño del panel
+	HudLayerChanges changes = { 0 };
+	if (lines->count != previous.count) {
+		hudLayerSize(hud, &changes.areas[0].width, &changes.areas[0].height);
+		changes.count = 1;
+		hud->layer_frames_recorded = hud->frames_recorded;
+		return changes;
+	}
+
+	int32 x = HUD_MARGIN + HUD_PADDING;
+	int32 y = HUD_MARGIN + HUD_PADDING;
+	for (int32 i = 0; i < lines->count; ++i, y += hud->atlas.line_height) {
+		int32 length = (int32)strlen(lines->text[i]);
+		int32 previous_length = (int32)strlen(previous.text[i]);
+		int32 first = -1;
+		int32 last = -1;
+		for (int32 col = 0; col < length || col < previous_length; ++col) {
+			char now = (col < length) ? lines->text[i][col] : '\0';
+			char before = (col < previous_length) ? previous.text[i][col] : '\0';
+			if (now != before) {
+				first = (first < 0) ? col : first;
+				last = col;
+			}
+		}
+		if (i == lines->count - 1 && lines->over_budget != previous.over_budget) {
+			first = 0; // color changed | cambió el color
+			last = HUD_TEXT_COLUMNS - 1;
+		}
+		if (first >= 0) {
+			changes.areas[changes.count++] = (HudRectangle){ x + (first * hud->atlas.advance),
+				y, (last - first + 1) * hud->atlas.advance, hud->atlas.line_height };
+		}
+	}
+	if (hud->frames_recorded != hud->layer_frames_recorded) {
+		changes.areas[changes.count++] = (HudRectangle){ x, y,
+			HUD_GRAPH_SAMPLES * HUD_GRAPH_BAR_WIDTH, HUD_GRAPH_HEIGHT };
+		hud->layer_frames_recorded = hud->frames_recorded;
+	}
+	return changes;
+}
+
+/*
+ * [EN] Each area is drawn into a view of itself alone, with the panel moved by -x and -y, so every
+ * primitive clips against it for free.
+ * [ES] Cada área se dibuja en una vista de sólo ella, con el panel movido por -x y -y, así cada
+ * primitiva recorta contra ella sin costo extra.
+ */
+void hudDrawLayer(Hud* hud, Bitmap* layer, const HudRectangle* areas, int32 area_count)
+{
+	if (!hud->visible) {
+		return;
+	}
+	uint64 start = clockNowNanoseconds();
+	for (int32 i = 0; i < area_count; ++i) {
+		HudRectangle area = areas[i];
+		int32 right = (area.x + area.width < layer->width) ? area.x + area.width : layer->width;
+		int32 bottom = (area.y + area.height < layer->height) ? area.y + area.height
+			: layer->height;
+		area.x = (area.x > 0) ? area.x : 0;
+		area.y = (area.y > 0) ? area.y : 0;
+		if (right <= area.x || bottom <= area.y) {
+			continue;
+		}
+		Bitmap view = { .memory = (uint8*)layer->memory + ((int64)area.y * layer->bytes_per_row)
+			+ ((int64)area.x * sizeof(uint32)), .width = right - area.x,
+			.height = bottom - area.y, .bytes_per_row = layer->bytes_per_row };
+
+		int32 panel_x = HUD_MARGIN - area.x;
+		int32 panel_y = HUD_MARGIN - area.y;
+		hudFillRectangle(&view, 0, 0, view.width, view.height, 0); // transparent
+		hudFillRectangle(&view, panel_x, panel_y, hudPanelWidth(hud),
+				hudPanelHeight(hud, hud->layer_lines.count), HUD_LAYER_COLOR);
+		hudDrawContents(hud, &hud->layer_lines, &view, panel_x, panel_y);
+	}
+	hudRecordDrawTime(hud, start);
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,110 @@
+/* hud.h: on-screen performance display declarations | declaraciones del panel de rendimiento */
+
+#pragma once
+#include "types.h"
+#include "render.h"
+#include "text.h"
+#include "perf_counters.h"
+
+#define HUD_GRAPH_SAMPLES 120
+#define HUD_TEXT_LINES 10 // at most | a lo más
+#define HUD_TEXT_COLUMNS 26 // longer lines are cut | las líneas más largas se cortan
+#define HUD_LAYER_CHANGES (HUD_TEXT_LINES + 1) // a run of characters per line and the graph
+
+/*
+ * [EN] Stats of the buffer being drawn and of the window system events, provided by the platform
+ * layer.
+ * [ES] Estadísticas del 'buffer' que se dibuja y de los eventos del sistema de ventanas, provistas
+ * por la capa de plataforma.
+ */
+typedef struct {
+	int32 width;
+	int32 height;
+	int32 bytes_per_row;
+	int32 buffer_index;
+	int32 buffer_count;
+	float32 render_time; // milliseconds | milisegundos
+	float32 events_per_second;
+	float32 max_event_dispatch_time; // milliseconds | milisegundos
+	float32 presentation_latency; // milliseconds, state sampled to frame attached | hasta 'attach'
+	bool8 tearing; // async presentation, frames don't wait for vsync | sin esperar a vsync
+	bool8 raw_pointer; // relative pointer motion is available | hay movimiento relativo
+	uint32 pointer_events; // relative motion events since the previous frame | desde el anterior
+	float32 pointer_event_rate; // per second, pointerMotionEventRate() | por segundo
+	const PerfFrameStats* perf; // previous frame, nullptr without counters | sin contadores
+} HudBufferStats;
+
+typedef struct {
+	int32 x;
+	int32 y;
+	int32 width; // empty when <= 0 | vacío cuando <= 0
+	int32 height;
+} HudRectangle;
+
+typedef struct {
+	HudRectangle areas[HUD_LAYER_CHANGES];
+	int32 count;
+} HudLayerChanges;
+
+typedef struct {
+	char text[HUD_TEXT_LINES][HUD_TEXT_COLUMNS + 1];
+	int32 count;
+	bool8 over_budget; // the last line is drawn in red | la última línea se dibuja en rojo
+} HudLines;
+
+typedef struct {
+	TextAtlas atlas;
+	float32 frame_times[HUD_GRAPH_SAMPLES]; // milliseconds, ring buffer | anillo
+	int32 next_frame_time;
+	int32 frame_time_count;
+	uint32 frames_recorded; // the graph changed when this did | la gráfica cambió cuando esto
+	uint32 layer_frames_recorded; // as of the last hudUpdateLayer() | al último hudUpdateLayer()
+	HudLines layer_lines; // what the layer shows | lo que muestra la capa
+	float32 draw_time; // cost of the previous draw | costo del dibujo anterior
+	float32 max_draw_time;
+	bool8 initialized;
+	bool8 visible;
+} Hud;
+
+[[nodiscard]] bool8 hudInitialize(Hud* hud);
+void hudDestroy(Hud* hud);
+void hudToggle(Hud* hud);
+void hudRecordFrameTime(Hud* hud, float32 frame_time);
+
+/*
+ * [EN] Draws the panel over the top-left corner of target when visible, and measures its own cost.
+ * [ES] Dibuja el panel sobre la esquina superior izquierda de target cuando es visible, y mide su
+ * propio costo.
+ */
+void hudDraw(Hud* hud, Bitmap* target, const HudBufferStats* stats);
+
+/*
+ * [EN] Size of a layer that holds only the panel, with room for every line. The layer sits over the
+ * top-left corner of the frame.
+ * [ES] Tamaño de una capa que sólo contiene el panel, con espacio para todas las líneas. La capa
+ * está sobre la esquina superior izquierda del fotograma.
+ */
+void hudLayerSize(const Hud* hud, int32* width, int32* height);
+
+/*
+ * [EN] Formats stats for the layer and returns the parts of it that changed since the previous
+ * call: on each line the run of characters that differ, and the graph when frames were recorded.
+ * No areas when nothing did, the whole layer when the line count changed.
+ * [ES] Formatea stats para la capa y regresa las partes de ella que cambiaron desde la llamada
+ * anterior: en cada línea la secuencia de caracteres que difieren, y la gráfica cuando se
+ * registraron fotogramas. Ninguna área cuando nada cambió, toda la capa cuando cambió la cantidad
+ * de líneas.
+ */
+HudLayerChanges hudUpdateLayer(Hud* hud, const HudBufferStats* stats);
+
+/*
+ * [EN] Redraws the areas of layer, a premultiplied A:R:G:B bitmap of hudLayerSize(), from the last
+ * hudUpdateLayer(): the panel over a translucent background, transparent around it. Pixels outside
+ * the areas aren't touched.
+ * [ES] Redibuja las áreas de layer, un 'bitmap' A:R:G:B premultiplicado de hudLayerSize(), a partir
+ * del último hudUpdateLayer(): el panel sobre un fondo translúcido, transparente alrededor. Los
+ * píxeles fuera de las áreas no se tocan.
+ */
+void hudDrawLayer(Hud* hud, Bitmap* layer, const HudRectangle* areas, int32 area_count);
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,824 @@
+/* image.c: QOI and PNG decoding | decodificación de QOI y PNG */
+
+#include "defines.h"
+#include "types.h"
+#include "log.h"
+#include "render.h"
+#include "arena.h"
+#include "image.h"
+
+#include <string.h>
+
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+#endif
+
+#define IMAGE_MAX_DIMENSION 16384
+#define IMAGE_OPAQUE 0xFF00'0000u
+
+internal inline uint32 imageReadBigEndian32(const uint8* bytes)
+{
+	return ((uint32)bytes[0] << 24) | ((uint32)bytes[1] << 16) | ((uint32)bytes[2] << 8) | bytes[3];
+}
+
+internal inline uint32 imagePack(uint32 r, uint32 g, uint32 b, uint32 a)
+{
+	return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+[[nodiscard]] internal bool8 imageAllocate(MemoryArena* arena, uint32 width, uint32 height,
+		Bitmap* image)
+{
+	if (width == 0 || height == 0 || width > IMAGE_MAX_DIMENSION || height > IMAGE_MAX_DIMENSION) {
+		logError("Unsupported image size %ux%u.", width, height);
+		return false;
+	}
+	image->memory = arenaPush(arena, (uint64)width * height * sizeof(uint32), 64);
+	if (!image->memory) {
+		logError("Image arena too small for a %ux%u image.", width, height);
+		return false;
+	}
+	image->width = (int32)width;
+	image->height = (int32)height;
+	image->bytes_per_row = (int32)(width * sizeof(uint32));
+	return true;
+}
+
+/* QOI: https://qoiformat.org/qoi-specification.pdf */
+
+#define QOI_HEADER_SIZE 14
+#define QOI_PADDING_SIZE 8
+#define QOI_OP_INDEX 0x00
+#define QOI_OP_DIFF 0x40
+#define QOI_OP_LUMA 0x80
+#define QOI_OP_RUN 0xC0
+#define QOI_OP_RGB 0xFE
+#define QOI_OP_RGBA 0xFF
+#define QOI_MASK_2 0xC0
+
+bool8 imageDecodeQoi(const uint8* data, uint64 size, MemoryArena* arena, Bitmap* image)
+{
+	if (size < QOI_HEADER_SIZE + QOI_PADDING_SIZE || memcmp(data, "qoif", 4) != 0) {
+		logError("Not a QOI image.");
+		return false;
+	}
+	uint64 mark = arenaMark(arena);
+	if (!imageAllocate(arena, imageReadBigEndian32(data + 4), imageReadBigEndian32(data + 8),
+				image)) {
+		return false;
+	}
+
+	uint32 index[64] = { 0 }; // previously seen pixels, packed | píxeles ya vistos, empacados
+	uint8 r = 0, g = 0, b = 0, a = 255;
+	uint32 pxl_value = imagePack(r, g, b, a);
+	uint32* pxl = image->memory;
+	uint64 pxl_count = (uint64)image->width * image->height;
+	uint64 p = QOI_HEADER_SIZE;
+	uint64 chunks_end = size - QOI_PADDING_SIZE;
+	int32 run = 0;
+
+	for (uint64 i = 0; i < pxl_count; ++i) {
+		if (run > 0) {
+			run--;
+		} else {
+			if (p >= chunks_end) {
+				logError("Truncated QOI image.");
+				arenaRestore(arena, mark);
+				return false;
+			}
+			uint8 op = data[p++];
+			if (op == QOI_OP_RGB) {
+				r = data[p];
+				g = data[p + 1];
+				b = data[p + 2];
+				p += 3;
+			} else if (op == QOI_OP_RGBA) {
+				r = data[p];
+				g = data[p + 1];
+				b = data[p + 2];
+				a = data[p + 3];
+				p += 4;
+			} else if ((op & QOI_MASK_2) == QOI_OP_INDEX) {
+				pxl_value = index[op];
+				r = (uint8)(pxl_value >> 16);
+				g = (uint8)(pxl_value >> 8);
+				b = (uint8)pxl_value;
+				a = (uint8)(pxl_value >> 24);
+			} else if ((op & QOI_MASK_2) == QOI_OP_DIFF) {
+				r += ((op >> 4) & 0x03) - 2;
+				g += ((op >> 2) & 0x03) - 2;
+				b += (op & 0x03) - 2;
+			} else if ((op & QOI_MASK_2) == QOI_OP_LUMA) {
+				uint8 second = data[p++];
+				int32 green_difference = (op & 0x3F) - 32;
+				r += green_difference - 8 + ((second >> 4) & 0x0F);
+				g += green_difference;
+				b += green_difference - 8 + (second & 0x0F);
+			} else { // QOI_OP_RUN
+				run = op & 0x3F; // bias of -1 already applied by this pixel | sesgo de -1 aplicado
+			}
+			pxl_value = imagePack(r, g, b, a);
+			index[((r * 3) + (g * 5) + (b * 7) + (a * 11)) % 64] = pxl_value;
+		}
+		pxl[i] = pxl_value;
+	}
+	return true;
+}
+
+/*
+ * [EN] Inflate (RFC 1951) with a 9-bit fast lookup table per huffman code, the output size is
+ * known beforehand so it writes into a fixed buffer.
+ * [ES] Inflate (RFC 1951) con una tabla rápida de 9 bits por código huffman, el tamaño de la salida
+ * se conoce de antemano así que escribe en un 'buffer' fijo.
+ */
+#define INFLATE_FAST_BITS 9
+#define INFLATE_FAST_MASK ((1 << INFLATE_FAST_BITS) - 1)
+#define INFLATE_MAX_SYMBOLS 288
+
+typedef struct {
+	uint16 fast[1 << INFLATE_FAST_BITS]; // (code length << 9) | symbol, 0 if longer than 9 bits
+	uint16 first_code[16];
+	int32 max_code[17];
+	uint16 first_symbol[16];
+	uint8 sizes[INFLATE_MAX_SYMBOLS];
+	uint16 values[INFLATE_MAX_SYMBOLS];
+} InflateHuffman;
+
+typedef struct {
+	const uint8* input;
+	const uint8* input_end;
+	uint64 bit_buffer;
+	int32 bit_count;
+	bool8 overrun;
+	uint8* output;
+	uint64 output_size;
+	uint64 output_used;
+	InflateHuffman length_codes;
+	InflateHuffman distance_codes;
+} Inflate;
+
+global_variable const uint16 inflate_length_base[31] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17,
+	19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258, 0, 0 };
+global_variable const uint8 inflate_length_extra[31] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2,
+	2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0, 0, 0 };
+global_variable const uint16 inflate_distance_base[32] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49,
+	65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385,
+	24577, 0, 0 };
+global_variable const uint8 inflate_distance_extra[32] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5,
+	5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 0, 0 };
+
+internal inline uint32 inflateReverseBits(uint32 value, int32 bit_count)
+{
+	uint32 result = 0;
+	for (int32 i = 0; i < bit_count; ++i) {
+		result = (result << 1) | (value & 1);
+		value >>= 1;
+	}
+	return result;
+}
+
+internal inline void inflateRefill(Inflate* inflate)
+{
+	while (inflate->bit_count <= 56) {
+		uint64 byte = 0;
+		if (inflate->input < inflate->input_end) {
+			byte = *inflate->input++;
+		} else if (inflate->bit_count < 0) {
+			inflate->overrun = true; // consumed bits that were never there | bits inexistentes
+			return;
+		} else {
+			inflate->overrun = inflate->overrun || (inflate->bit_count == 0);
+			return;
+		}
+		inflate->bit_buffer |= byte << inflate->bit_count;
+		inflate->bit_count += 8;
+	}
+}
+
+internal inline uint32 inflateBits(Inflate* inflate, int32 count)
+{
+	if (inflate->bit_count < count) {
+		inflateRefill(inflate);
+		if (inflate->bit_count < count) {
+			inflate->overrun = true;
+			return 0;
+		}
+	}
+	uint32 value = (uint32)(inflate->bit_buffer & ((1ull << count) - 1));
+	inflate->bit_buffer >>= count;
+	inflate->bit_count -= count;
+	return value;
+}
+
+[[nodiscard]] internal bool8 inflateBuildHuffman(InflateHuffman* huffman, const uint8* code_sizes,
+		int32 symbol_count)
+{
+	int32 sizes[17] = { 0 };
+	int32 next_code[16];
+	memset(huffman->fast, 0, sizeof(huffman->fast));
+	for (int32 i = 0; i < symbol_count; ++i) {
+		sizes[code_sizes[i]]++;
+	}
+	sizes[0] = 0;
+	for (int32 i = 1; i < 16; ++i) {
+		if (sizes[i] > (1 << i)) {
+			return false;
+		}
+	}
+	int32 code = 0;
+	int32 symbol = 0;
+	for (int32 i = 1; i < 16; ++i) {
+		next_code[i] = code;
+		huffman->first_code[i] = (uint16)code;
+		huffman->first_symbol[i] = (uint16)symbol;
+		code += sizes[i];
+		if (sizes[i] && code - 1 >= (1 << i)) {
+			return false; // over-subscribed | sobre-suscrito
+		}
+		huffman->max_code[i] = code << (16 - i); // preshifted for the slow path
+		code <<= 1;
+		symbol += sizes[i];
+	}
+	huffman->max_code[16] = 0x10000;
+	for (int32 i = 0; i < symbol_count; ++i) {
+		int32 size = code_sizes[i];
+		if (size == 0) {
+			continue;
+		}
+		int32 slot = next_code[size] - huffman->first_code[size] + huffman->first_symbol[size];
+		huffman->sizes[slot] = (uint8)size;
+		huffman->values[slot] = (uint16)i;
+		if (size <= INFLATE_FAST_BITS) {
+			for (uint32 j = inflateReverseBits(next_code[size], size); j < (1 << INFLATE_FAST_BITS);
+					j += (1 << size)) {
+				huffman->fast[j] = (uint16)((size << 9) | i);
+			}
+		}
+		next_code[size]++;
+	}
+	return true;
+}
+
+internal int32 inflateDecodeSymbol(Inflate* inflate, const InflateHuffman* huffman)
+{
+	if (inflate->bit_count < 16) {
+		inflateRefill(inflate);
+	}
+	uint32 fast = huffman->fast[inflate->bit_buffer & INFLATE_FAST_MASK];
+	if (fast) {
+		int32 size = fast >> 9;
+		inflate->bit_buffer >>= size;
+		inflate->bit_count -= size;
+		return fast & 511;
+	}
+
+	// [EN] Slow path, codes longer than the fast table | [ES] Ruta lenta, códigos largos
+	uint32 reversed = inflateReverseBits((uint32)(inflate->bit_buffer & 0xFFFF), 16);
+	int32 size = INFLATE_FAST_BITS + 1;
+	while (size < 16 && (int32)reversed >= huffman->max_code[size]) {
+		size++;
+	}
+	if (size >= 16) {
+		return -1;
+	}
+	int32 slot = (int32)(reversed >> (16 - size)) - huffman->first_code[size]
+		+ huffman->first_symbol[size];
+	if (slot >= INFLATE_MAX_SYMBOLS || huffman->sizes[slot] != size) {
+		return -1;
+	}
+	inflate->bit_buffer >>= size;
+	inflate->bit_count -= size;
+	return huffman->values[slot];
+}
+
+[[nodiscard]] internal bool8 inflateDynamicCodes(Inflate* inflate)
+{
+	persist const uint8 code_length_order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11,
+		4, 12, 3, 13, 2, 14, 1, 15 };
+	int32 length_count = inflateBits(inflate, 5) + 257;
+	int32 distance_count = inflateBits(inflate, 5) + 1;
+	int32 code_length_count = inflateBits(inflate, 4) + 4;
+
+	uint8 code_length_sizes[19] = { 0 };
+	for (int32 i = 0; i < code_length_count; ++i) {
+		code_length_sizes[code_length_order[i]] = (uint8)inflateBits(inflate, 3);
+	}
+	InflateHuffman code_lengths;
+	if (!inflateBuildHuffman(&code_lengths, code_length_sizes, 19)) {
+		return false;
+	}
+
+	uint8 sizes[286 + 32];
+	int32 total = length_count + distance_count;
+	int32 n = 0;
+	while (n < total) {
+		int32 symbol = inflateDecodeSymbol(inflate, &code_lengths);
+		if (symbol < 0 || symbol > 18) {
+			return false;
+		}
+		if (symbol < 16) {
+			sizes[n++] = (uint8)symbol;
+			continue;
+		}
+		uint8 fill = 0;
+		int32 repeat;
+		if (symbol == 16) {
+			if (n == 0) {
+				return false;
+			}
+			repeat = inflateBits(inflate, 2) + 3;
+			fill = sizes[n - 1];
+		} else if (symbol == 17) {
+			repeat = inflateBits(inflate, 3) + 3;
+		} else {
+			repeat = inflateBits(inflate, 7) + 11;
+		}
+		if (total - n < repeat) {
+			return false;
+		}
+		memset(sizes + n, fill, repeat);
+		n += repeat;
+	}
+	return inflateBuildHuffman(&inflate->length_codes, sizes, length_count)
+		&& inflateBuildHuffman(&inflate->distance_codes, sizes + length_count, distance_count);
+}
+
+[[nodiscard]] internal bool8 inflateFixedCodes(Inflate* inflate)
+{
+	uint8 sizes[INFLATE_MAX_SYMBOLS];
+	memset(sizes, 8, 144);
+	memset(sizes + 144, 9, 256 - 144);
+	memset(sizes + 256, 7, 280 - 256);
+	memset(sizes + 280, 8, INFLATE_MAX_SYMBOLS - 280);
+	uint8 distance_sizes[32];
+	memset(distance_sizes, 5, sizeof(distance_sizes));
+	return inflateBuildHuffman(&inflate->length_codes, sizes, INFLATE_MAX_SYMBOLS)
+		&& inflateBuildHuffman(&inflate->distance_codes, distance_sizes, 32);
+}
+
+[[nodiscard]] internal bool8 inflateHuffmanBlock(Inflate* inflate)
+{
+	uint8* output = inflate->output;
+	uint64 used = inflate->output_used;
+	while (true) {
+		int32 symbol = inflateDecodeSymbol(inflate, &inflate->length_codes);
+		if (symbol < 256) {
+			if (symbol < 0 || used >= inflate->output_size) {
+				return false;
+			}
+			output[used++] = (uint8)symbol;
+			continue;
+		}
+		if (symbol == 256) { // end of block | fin de bloque
+			inflate->output_used = used;
+			return !inflate->overrun;
+		}
+		symbol -= 257;
+		if (symbol >= 29) {
+			return false;
+		}
+		uint32 length = inflate_length_base[symbol] + inflateBits(inflate, inflate_length_extra[symbol]);
+		int32 distance_symbol = inflateDecodeSymbol(inflate, &inflate->distance_codes);
+		if (distance_symbol < 0 || distance_symbol >= 30) {
+			return false;
+		}
+		uint32 distance = inflate_distance_base[distance_symbol]
+			+ inflateBits(inflate, inflate_distance_extra[distance_symbol]);
+		if (distance > used || length > inflate->output_size - used) {
+			return false;
+		}
+		const uint8* source = output + used - distance;
+		uint8* destination = output + used;
+		if (distance >= length) {
+			memcpy(destination, source, length);
+		} else { // overlapping run | repetición superpuesta
+			for (uint32 i = 0; i < length; ++i) {
+				destination[i] = source[i];
+			}
+		}
+		used += length;
+	}
+}
+
+[[nodiscard]] internal bool8 inflateStoredBlock(Inflate* inflate)
+{
+	inflateBits(inflate, inflate->bit_count & 7); // byte alignment | alineación a byte
+	uint32 length = inflateBits(inflate, 16);
+	uint32 inverse_length = inflateBits(inflate, 16);
+	if ((length ^ 0xFFFF) != inverse_length || length > inflate->output_size - inflate->output_used) {
+		return false;
+	}
+	// [EN] Drain the whole bytes still in the bit buffer, then copy straight from the input
+	// [ES] Vaciar los bytes completos aún en el 'buffer' de bits, después copiar de la entrada
+	while (length > 0 && inflate->bit_count >= 8) {
+		inflate->output[inflate->output_used++] = (uint8)inflateBits(inflate, 8);
+		length--;
+	}
+	if (length > (uint64)(inflate->input_end - inflate->input)) {
+		return false;
+	}
+	memcpy(inflate->output + inflate->output_used, inflate->input, length);
+	inflate->input += length;
+	inflate->output_used += length;
+	return true;
+}
+
+/*
+ * [EN] Inflates a zlib stream (RFC 1950) into output, which must be exactly as big as the
+ * uncompressed data. The adler32 checksum is not verified.
+ * [ES] Descomprime un flujo zlib (RFC 1950) en output, que debe ser exactamente del tamaño de los
+ * datos descomprimidos. La suma adler32 no se verifica.
+ */
+[[nodiscard]] internal bool8 inflateZlib(Inflate* inflate, const uint8* input, uint64 input_size,
+		uint8* output, uint64 output_size)
+{
+	if (input_size < 2) {
+		return false;
+	}
+	uint32 method = input[0];
+	uint32 flags = input[1];
+	if ((method & 0x0F) != 8 || ((method << 8) | flags) % 31 != 0 || (flags & 0x20)) {
+		return false; // not deflate, bad check or preset dictionary | no deflate o diccionario
+	}
+	inflate->input = input + 2;
+	inflate->input_end = input + input_size;
+	inflate->bit_buffer = 0;
+	inflate->bit_count = 0;
+	inflate->overrun = false;
+	inflate->output = output;
+	inflate->output_size = output_size;
+	inflate->output_used = 0;
+
+	bool8 last_block = false;
+	while (!last_block) {
+		last_block = inflateBits(inflate, 1);
+		uint32 type = inflateBits(inflate, 2);
+		bool8 succeeded;
+		if (type == 0) {
+			succeeded = inflateStoredBlock(inflate);
+		} else if (type == 1) {
+			succeeded = inflateFixedCodes(inflate) && inflateHuffmanBlock(inflate);
+		} else if (type == 2) {
+			succeeded = inflateDynamicCodes(inflate) && inflateHuffmanBlock(inflate);
+		} else {
+			succeeded = false;
+		}
+		if (!succeeded || inflate->overrun) {
+			return false;
+		}
+	}
+	return inflate->output_used == output_size;
+}
+
+/* PNG: https://www.w3.org/TR/png/ */
+
+#define PNG_COLOR_GRAY 0
+#define PNG_COLOR_RGB 2
+#define PNG_COLOR_PALETTE 3
+#define PNG_COLOR_GRAY_ALPHA 4
+#define PNG_COLOR_RGBA 6
+#define PNG_MAX_PALETTE_SIZE 256 // entries, the most an 8-bit index reaches | entradas
+
+#define PNG_FILTER_NONE 0
+#define PNG_FILTER_SUB 1
+#define PNG_FILTER_UP 2
+#define PNG_FILTER_AVERAGE 3
+#define PNG_FILTER_PAETH 4
+
+internal inline uint8 pngPaeth(int32 a, int32 b, int32 c)
+{
+	int32 p = a + b - c;
+	int32 pa = (p > a) ? p - a : a - p;
+	int32 pb = (p > b) ? p - b : b - p;
+	int32 pc = (p > c) ? p - c : c - p;
+	if (pa <= pb && pa <= pc) {
+		return (uint8)a;
+	}
+	return (uint8)((pb <= pc) ? b : c);
+}
+
+#if defined(__SSE2__)
+/*
+ * [EN] Rows start after their filter byte so pixels are unaligned, memcpy compiles to a movd.
+ * [ES] Las filas empiezan después de su byte de filtro así que los píxeles no están alineados,
+ * memcpy se compila a un movd.
+ */
+internal inline __m128i pngLoadPixel(const uint8* bytes)
+{
+	int32 value;
+	memcpy(&value, bytes, sizeof(value));
+	return _mm_cvtsi32_si128(value);
+}
+
+internal inline void pngStorePixel(uint8* bytes, __m128i pxl)
+{
+	int32 value = _mm_cvtsi128_si32(pxl);
+	memcpy(bytes, &value, sizeof(value));
+}
+
+/*
+ * [EN] Paeth on 4 pixels of 16-bit lanes, branchless version of pngPaeth().
+ * [ES] Paeth en 4 píxeles de carriles de 16 bits, versión sin saltos de pngPaeth().
+ */
+internal inline __m128i pngPaethEpi16(__m128i a, __m128i b, __m128i c)
+{
+	__m128i pa = _mm_sub_epi16(b, c); // p - a = b - c
+	__m128i pb = _mm_sub_epi16(a, c); // p - b = a - c
+	__m128i pc = _mm_add_epi16(pa, pb); // p - c
+	pa = _mm_max_epi16(pa, _mm_sub_epi16(_mm_setzero_si128(), pa)); // absolute values
+	pb = _mm_max_epi16(pb, _mm_sub_epi16(_mm_setzero_si128(), pb));
+	pc = _mm_max_epi16(pc, _mm_sub_epi16(_mm_setzero_si128(), pc));
+	__m128i smallest = _mm_min_epi16(_mm_min_epi16(pa, pb), pc);
+	__m128i pick_a = _mm_cmpeq_epi16(smallest, pa);
+	__m128i pick_b = _mm_cmpeq_epi16(smallest, pb);
+	__m128i result = _mm_or_si128(_mm_and_si128(pick_b, b), _mm_andnot_si128(pick_b, c));
+	return _mm_or_si128(_mm_and_si128(pick_a, a), _mm_andnot_si128(pick_a, result));
+}
+#endif
+
+/*
+ * [EN] Reverses the row filter in place. previous is the already reconstructed row above, or a
+ * row of zeros for the first one. The 4-bytes-per-pixel case has SSE2 versions of every filter.
+ * [ES] Revierte el filtro de la fila en su lugar. previous es la fila de arriba ya reconstruida, o
+ * una fila de ceros para la primera. El caso de 4 bytes por píxel tiene versiones SSE2 de cada
+ * filtro.
+ */
+[[nodiscard]] internal bool8 pngUnfilterRow(uint8 filter, uint8* row, const uint8* previous,
+		int32 row_bytes, int32 pxl_bytes)
+{
+	int32 i = 0;
+	switch (filter) {
+	case PNG_FILTER_NONE:
+		break;
+	case PNG_FILTER_SUB:
+#if defined(__SSE2__)
+		if (pxl_bytes == 4) {
+			__m128i left = _mm_setzero_si128();
+			for (; i + 4 <= row_bytes; i += 4) {
+				left = _mm_add_epi8(left, pngLoadPixel(row + i));
+				pngStorePixel(row + i, left);
+			}
+		}
+#endif
+		for (i = (i > pxl_bytes) ? i : pxl_bytes; i < row_bytes; ++i) {
+			row[i] += row[i - pxl_bytes];
+		}
+		break;
+	case PNG_FILTER_UP:
+#if defined(__SSE2__)
+		for (; i + 16 <= row_bytes; i += 16) {
+			__m128i sum = _mm_add_epi8(_mm_loadu_si128((const __m128i*)(row + i)),
+					_mm_loadu_si128((const __m128i*)(previous + i)));
+			_mm_storeu_si128((__m128i*)(row + i), sum);
+		}
+#endif
+		for (; i < row_bytes; ++i) {
+			row[i] += previous[i];
+		}
+		break;
+	case PNG_FILTER_AVERAGE:
+#if defined(__SSE2__)
+		if (pxl_bytes == 4) {
+			__m128i zero = _mm_setzero_si128();
+			__m128i left = zero;
+			for (; i + 4 <= row_bytes; i += 4) {
+				__m128i up = _mm_unpacklo_epi8(pngLoadPixel(previous + i), zero);
+				__m128i average = _mm_srli_epi16(_mm_add_epi16(left, up), 1);
+				__m128i value = _mm_unpacklo_epi8(pngLoadPixel(row + i), zero);
+				left = _mm_and_si128(_mm_add_epi16(value, average), _mm_set1_epi16(0xFF));
+				pngStorePixel(row + i, _mm_packus_epi16(left, left));
+			}
+		}
+#endif
+		for (; i < pxl_bytes && i < row_bytes; ++i) {
+			row[i] += previous[i] >> 1;
+		}
+		for (; i < row_bytes; ++i) {
+			row[i] += (uint8)((row[i - pxl_bytes] + previous[i]) >> 1);
+		}
+		break;
+	case PNG_FILTER_PAETH:
+#if defined(__SSE2__)
+		if (pxl_bytes == 4) {
+			__m128i zero = _mm_setzero_si128();
+			__m128i left = zero;
+			__m128i up_left = zero;
+			for (; i + 4 <= row_bytes; i += 4) {
+				__m128i up = _mm_unpacklo_epi8(pngLoadPixel(previous + i), zero);
+				__m128i value = _mm_unpacklo_epi8(pngLoadPixel(row + i), zero);
+				left = _mm_and_si128(_mm_add_epi16(value, pngPaethEpi16(left, up, up_left)),
+						_mm_set1_epi16(0xFF));
+				up_left = up;
+				pngStorePixel(row + i, _mm_packus_epi16(left, left));
+			}
+		}
+#endif
+		for (; i < pxl_bytes && i < row_bytes; ++i) {
+			row[i] += previous[i]; // paeth(0, up, 0) is up | paeth(0, arriba, 0) es arriba
+		}
+		for (; i < row_bytes; ++i) {
+			row[i] += pngPaeth(row[i - pxl_bytes], previous[i], previous[i - pxl_bytes]);
+		}
+		break;
+	default:
+		return false;
+	}
+	return true;
+}
+
+/*
+ * [EN] Converts a reconstructed row to A:R:G:B while it is still in cache.
+ * [ES] Convierte una fila reconstruida a A:R:G:B mientras sigue en caché.
+ */
+internal void pngConvertRow(const uint8* row, uint32* pxl, int32 width, uint8 color_type,
+		const uint32* palette)
+{
+	int32 col = 0;
+	switch (color_type) {
+	case PNG_COLOR_GRAY:
+		for (; col < width; ++col) {
+			pxl[col] = IMAGE_OPAQUE | (row[col] * 0x01'0101u);
+		}
+		break;
+	case PNG_COLOR_GRAY_ALPHA:
+		for (; col < width; ++col) {
+			pxl[col] = ((uint32)row[2 * col + 1] << 24) | (row[2 * col] * 0x01'0101u);
+		}
+		break;
+	case PNG_COLOR_PALETTE:
+		for (; col < width; ++col) {
+			pxl[col] = palette[row[col]];
+		}
+		break;
+	case PNG_COLOR_RGB:
+		for (; col < width; ++col) {
+			const uint8* rgb = row + (3 * col);
+			pxl[col] = imagePack(rgb[0], rgb[1], rgb[2], 0xFF);
+		}
+		break;
+	case PNG_COLOR_RGBA:
+		// [EN] Bytes R,G,B,A read as little endian 0xAABBGGRR, swap R and B
+		// [ES] Bytes R,G,B,A leídos en little endian como 0xAABBGGRR, intercambiar R y B
+#if defined(__SSE2__)
+		for (; col + 4 <= width; col += 4) {
+			__m128i rgba = _mm_loadu_si128((const __m128i*)(row + (4 * col)));
+			__m128i green_alpha = _mm_and_si128(rgba, _mm_set1_epi32((int32)0xFF00'FF00));
+			__m128i red = _mm_and_si128(_mm_slli_epi32(rgba, 16), _mm_set1_epi32(0x00FF'0000));
+			__m128i blue = _mm_and_si128(_mm_srli_epi32(rgba, 16), _mm_set1_epi32(0x0000'00FF));
+			_mm_storeu_si128((__m128i*)(pxl + col), _mm_or_si128(green_alpha, _mm_or_si128(red, blue)));
+		}
+#endif
+		for (; col < width; ++col) {
+			const uint8* rgba = row + (4 * col);
+			pxl[col] = imagePack(rgba[0], rgba[1], rgba[2], rgba[3]);
+		}
+		break;
+	}
+}
+
+bool8 imageDecodePng(const uint8* data, uint64 size, MemoryArena* arena, Bitmap* image)
+{
+	persist const uint8 png_signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+	if (size < 8 + 25 || memcmp(data, png_signature, 8) != 0) {
+		logError("Not a PNG image.");
+		return false;
+	}
+
+	/* chunks | bloques */
+	uint32 width = 0, height = 0;
+	uint8 color_type = 0;
+	uint32 palette[PNG_MAX_PALETTE_SIZE];
+	uint32 palette_size = 0;
+	const uint8* idat = nullptr; // first IDAT, used in place when it is the only one
+	uint64 idat_size = 0;
+	uint32 idat_count = 0;
+	for (uint64 p = 8; p + 12 <= size;) {
+		uint32 length = imageReadBigEndian32(data + p);
+		const uint8* type = data + p + 4;
+		const uint8* chunk = data + p + 8;
+		if (length > size - p - 12) {
+			logError("Truncated PNG chunk.");
+			return false;
+		}
+		if (!memcmp(type, "IHDR", 4) && length == 13) {
+			width = imageReadBigEndian32(chunk);
+			height = imageReadBigEndian32(chunk + 4);
+			color_type = chunk[9];
+			if (chunk[8] != 8 || chunk[10] != 0 || chunk[11] != 0 || chunk[12] != 0
+					|| color_type == 1 || color_type == 5 || color_type > PNG_COLOR_RGBA) {
+				logError("Unsupported PNG: bit depth %u, color type %u, interlace %u.", chunk[8],
+						color_type, chunk[12]);
+				return false;
+			}
+		} else if (!memcmp(type, "PLTE", 4)) {
+			if (length == 0 || length % 3 != 0 || length > 3 * PNG_MAX_PALETTE_SIZE) {
+				logError("Invalid PNG palette of %u bytes.", length);
+				return false;
+			}
+			palette_size = length / 3;
+			for (uint32 i = 0; i < palette_size; ++i) {
+				palette[i] = imagePack(chunk[3 * i], chunk[3 * i + 1], chunk[3 * i + 2], 0xFF);
+			}
+		} else if (!memcmp(type, "tRNS", 4) && color_type == PNG_COLOR_PALETTE) {
+			for (uint32 i = 0; i < length && i < palette_size && i < PNG_MAX_PALETTE_SIZE; ++i) {
+				palette[i] = (palette[i] & 0x00FF'FFFF) | ((uint32)chunk[i] << 24);
+			}
+		} else if (!memcmp(type, "IDAT", 4)) {
+			if (idat_count++ == 0) {
+				idat = chunk;
+			}
+			idat_size += length;
+		} else if (!memcmp(type, "IEND", 4)) {
+			break;
+		}
+		p += 12 + (uint64)length;
+	}
+	if (width == 0 || idat_count == 0 || (color_type == PNG_COLOR_PALETTE && palette_size == 0)) {
+		logError("PNG without header, data or palette.");
+		return false;
+	}
+	for (uint32 i = palette_size; i < PNG_MAX_PALETTE_SIZE; ++i) { // out of range indices | índices fuera de rango
+		palette[i] = IMAGE_OPAQUE;
+	}
+
+	uint64 mark = arenaMark(arena);
+	if (!imageAllocate(arena, width, height, image)) {
+		return false;
+	}
+
+	/* [EN] Several IDAT chunks are joined in scratch memory | [ES] Varios IDAT se juntan */
+	if (idat_count > 1) {
+		uint8* joined = arenaPush(arena, idat_size, 1);
+		if (!joined) {
+			logError("Image arena too small for the PNG data.");
+			arenaRestore(arena, mark);
+			return false;
+		}
+		uint64 joined_size = 0;
+		for (uint64 p = 8; p + 12 <= size;) {
+			uint32 length = imageReadBigEndian32(data + p);
+			if (!memcmp(data + p + 4, "IDAT", 4)) {
+				memcpy(joined + joined_size, data + p + 8, length);
+				joined_size += length;
+			} else if (!memcmp(data + p + 4, "IEND", 4)) {
+				break;
+			}
+			p += 12 + (uint64)length;
+		}
+		idat = joined;
+	}
+
+	int32 pxl_bytes = 1;
+	if (color_type == PNG_COLOR_RGB) {
+		pxl_bytes = 3;
+	} else if (color_type == PNG_COLOR_GRAY_ALPHA) {
+		pxl_bytes = 2;
+	} else if (color_type == PNG_COLOR_RGBA) {
+		pxl_bytes = 4;
+	}
+	int32 row_bytes = (int32)width * pxl_bytes;
+	uint64 filtered_size = (uint64)height * (1 + row_bytes);
+	uint8* filtered = arenaPush(arena, filtered_size, 16);
+	uint8* zero_row = arenaPush(arena, row_bytes, 16);
+	Inflate* inflate = arenaPush(arena, sizeof(Inflate), alignof(Inflate));
+	if (!filtered || !zero_row || !inflate) {
+		logError("Image arena too small for the PNG scratch memory.");
+		arenaRestore(arena, mark);
+		return false;
+	}
+	if (!inflateZlib(inflate, idat, idat_size, filtered, filtered_size)) {
+		logError("Corrupted PNG data.");
+		arenaRestore(arena, mark);
+		return false;
+	}
+
+	memset(zero_row, 0, row_bytes);
+	const uint8* previous = zero_row;
+	for (uint32 row = 0; row < height; ++row) {
+		uint8* current = filtered + ((uint64)row * (1 + row_bytes));
+		if (!pngUnfilterRow(current[0], current + 1, previous, row_bytes, pxl_bytes)) {
+			logError("Invalid PNG filter %u.", current[0]);
+			arenaRestore(arena, mark);
+			return false;
+		}
+		uint32* pxl = (uint32*)((uint8*)image->memory + ((uint64)row * image->bytes_per_row));
+		pngConvertRow(current + 1, pxl, (int32)width, color_type, palette);
+		previous = current + 1;
+	}
+
+	// [EN] Release the scratch memory, the pixels were allocated first
+	// [ES] Liberar la memoria temporal, los píxeles se reservaron primero
+	arenaRestore(arena, (uint64)((uint8*)image->memory - arena->base)
+			+ ((uint64)image->bytes_per_row * image->height));
+	return true;
+}
+
+bool8 imageDecode(const uint8* data, uint64 size, MemoryArena* arena, Bitmap* image)
+{
+	if (size >= 4 && !memcmp(data, "qoif", 4)) {
+		return imageDecodeQoi(data, size, arena, image);
+	}
+	return imageDecodePng(data, size, arena, image);
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,36 @@
+/* image.h: image decoding declarations | declaraciones de decodificación de imágenes */
+
+#pragma once
+#include "types.h"
+#include "render.h"
+#include "arena.h"
+
+/*
+ * [EN] Decoders write straight into the renderer's 32-bit layout, with the alpha channel (0xFF for
+ * opaque formats) in the x byte: [31:0] A:R:G:B. Pixels and any temporary memory come from arena;
+ * the temporary memory is released before returning, the pixels stay. bytes_per_row is width * 4.
+ * On failure nothing stays allocated in the arena.
+ * [ES] Los decodificadores escriben directamente en el formato de 32 bits del renderizador, con el
+ * canal alfa (0xFF para formatos opacos) en el byte x: [31:0] A:R:G:B. Los píxeles y cualquier
+ * memoria temporal salen de arena; la memoria temporal se libera antes de regresar, los píxeles se
+ * quedan. bytes_per_row es width * 4. Si falla nada queda reservado en la arena.
+ */
+[[nodiscard]] bool8 imageDecodeQoi(const uint8* data, uint64 size, MemoryArena* arena,
+		Bitmap* image);
+
+/*
+ * [EN] Non-interlaced PNG with 8 bits per channel: grayscale, RGB, palette, grayscale with alpha
+ * and RGBA.
+ * [ES] PNG no entrelazado con 8 bits por canal: escala de grises, RGB, paleta, escala de grises
+ * con alfa y RGBA.
+ */
+[[nodiscard]] bool8 imageDecodePng(const uint8* data, uint64 size, MemoryArena* arena,
+		Bitmap* image);
+
+/*
+ * [EN] Picks the decoder from the file signature.
+ * [ES] Elige el decodificador a partir de la firma del archivo.
+ */
+[[nodiscard]] bool8 imageDecode(const uint8* data, uint64 size, MemoryArena* arena, Bitmap* image);
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,84 @@
+/* input_log.c: input log format and replay | formato del registro de entrada y repetición */
+
+#include "defines.h"
+#include "types.h"
+#include "log.h"
+#include "input_log.h"
+
+#include <string.h>
+
+bool8 inputLogValidate(const uint8* memory, uint64 size)
+{
+	if (size < sizeof(InputLogHeader)) {
+		logError("Input log too small (%llu bytes).", (unsigned long long)size);
+		return false;
+	}
+	const InputLogHeader* header = (const InputLogHeader*)memory;
+	if (header->magic != INPUT_LOG_MAGIC) {
+		logError("Not an input log, wrong magic number 0x%08X.", header->magic);
+		return false;
+	}
+	if (header->version != INPUT_LOG_VERSION || header->event_size != sizeof(InputEvent)) {
+		logError("Unsupported input log version %u, expected %u.", header->version,
+				INPUT_LOG_VERSION);
+		return false;
+	}
+	if ((size - sizeof(InputLogHeader)) % sizeof(InputEvent) != 0) {
+		// [EN] A crash while recording leaves a partial event | [ES] Un fallo deja uno parcial
+		logWarn("Input log ends with a partial event, it will be ignored.");
+	}
+	return true;
+}
+
+const InputEvent* inputReplayNext(InputReplay* replay, uint32 elapsed_time)
+{
+	while (replay->next_event < replay->event_count) {
+		const InputEvent* event = &replay->events[replay->next_event];
+		if (event->type == INPUT_EVENT_FRAME) {
+			if (replay->mode == INPUT_REPLAY_BY_FRAME) {
+				return nullptr; // inputReplayTakeFrame()
+			}
+			replay->next_event++;
+			continue;
+		}
+		if (replay->mode == INPUT_REPLAY_BY_TIME
+				&& event->time - replay->events[0].time > elapsed_time) { // wraps | sin error
+			return nullptr;
+		}
+		replay->next_event++;
+		return event;
+	}
+	return nullptr;
+}
+
+bool8 inputReplayTakeFrame(InputReplay* replay, int32* ticks, float32* interpolation)
+{
+	if (replay->mode != INPUT_REPLAY_BY_FRAME || replay->next_event >= replay->event_count
+			|| replay->events[replay->next_event].type != INPUT_EVENT_FRAME) {
+		return false;
+	}
+	const InputEvent* event = &replay->events[replay->next_event++];
+	*ticks = event->x;
+	memcpy(interpolation, &event->y, sizeof(*interpolation));
+	return true;
+}
+
+bool8 inputReplayFinished(const InputReplay* replay)
+{
+	return replay->next_event >= replay->event_count;
+}
+
+void inputEventSetRelativeTime(InputEvent* event, uint64 time)
+{
+	event->code = (uint16)time;
+	event->state = (uint8)(time >> 16);
+}
+
+uint64 inputEventRelativeTime(const InputEvent* event, uint64 previous)
+{
+	uint32 time = ((uint32)event->state << 16) | event->code;
+	uint32 elapsed = (time - (uint32)previous) & INPUT_LOG_RELATIVE_TIME_MASK; // wraps | sin error
+	return previous + elapsed;
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,133 @@
+/* input_log.h: input recording and replay declarations | declaraciones de grabación de entrada */
+
+#pragma once
+#include "types.h"
+
+/*
+ * [EN] Log layout, every integer little endian:
+ *    InputLogHeader
+ *    InputEvent[], in arrival order, as many as fit in the rest of the file
+ * Events keep the compositor timestamp (milliseconds, undefined base) and the number of frames
+ * rendered before they arrived. Every step of the simulation adds an INPUT_EVENT_FRAME after the
+ * events it saw, with the ticks it ran and the interpolation it rendered with: the clock of the
+ * recorded session, a replay by frame runs on it instead of its own.
+ * A relative pointer motion takes two events in a row, INPUT_EVENT_RELATIVE_MOTION and
+ * INPUT_EVENT_RELATIVE_MOTION_UNACCELERATED. Its device timestamp keeps 24 bits of microseconds,
+ * enough to rebuild the time between two motions up to 16 s apart.
+ * [ES] Estructura del registro, todos los enteros en little endian:
+ *    InputLogHeader
+ *    InputEvent[], en orden de llegada, tantos como quepan en el resto del archivo
+ * Los eventos guardan la marca de tiempo del compositor (milisegundos, base indefinida) y el número
+ * de fotogramas dibujados antes de su llegada. Cada paso de la simulación agrega un
+ * INPUT_EVENT_FRAME después de los eventos que vio, con los pasos que corrió y la interpolación con
+ * la que dibujó: el reloj de la sesión grabada, una repetición por fotograma corre con él en lugar
+ * del suyo.
+ * Un movimiento relativo del puntero ocupa dos eventos seguidos, INPUT_EVENT_RELATIVE_MOTION e
+ * INPUT_EVENT_RELATIVE_MOTION_UNACCELERATED. Su marca de tiempo del dispositivo guarda 24 bits de
+ * microsegundos, suficiente para reconstruir el tiempo entre dos movimientos de hasta 16 s.
+ */
+#define INPUT_LOG_MAGIC 0x4C49'534Bu // "KSIL"
+#define INPUT_LOG_VERSION 3
+#define INPUT_LOG_RELATIVE_TIME_MASK 0xFF'FFFFu // microseconds | microsegundos
+
+typedef enum {
+	INPUT_EVENT_POINTER_ENTER, // x, y: surface coordinates, wl_fixed_t
+	INPUT_EVENT_POINTER_LEAVE,
+	INPUT_EVENT_POINTER_MOTION, // x, y: surface coordinates, wl_fixed_t
+	INPUT_EVENT_POINTER_BUTTON, // code: evdev button, state: 1 pressed 0 released
+	INPUT_EVENT_POINTER_AXIS, // code: axis, x: value, wl_fixed_t
+	INPUT_EVENT_KEY, // code: evdev key, state: 1 pressed 0 released
+	INPUT_EVENT_FRAME, // x: simulation ticks, y: interpolation, float32 bits | bits de float32
+	INPUT_EVENT_RELATIVE_MOTION, // x, y: deltas, wl_fixed_t, code, state: device time, 24 bits
+	INPUT_EVENT_RELATIVE_MOTION_UNACCELERATED, // x, y: deltas, wl_fixed_t, code: window slot
+	INPUT_EVENT_TYPE_COUNT,
+} InputEventType;
+
+typedef struct {
+	uint32 magic;
+	uint32 version;
+	uint32 event_size; // sizeof(InputEvent)
+	uint32 reserved;
+} InputLogHeader;
+
+typedef struct {
+	uint32 frame;
+	uint32 time; // compositor milliseconds, the last seen one for events without it
+	int32 x;
+	int32 y;
+	uint16 code;
+	uint8 type; // InputEventType
+	uint8 state;
+} InputEvent;
+
+static_assert(sizeof(InputLogHeader) == 16, "Unexpected InputLogHeader size, check padding");
+static_assert(sizeof(InputEvent) == 20, "Unexpected InputEvent size, check padding");
+
+#define INPUT_RECORDER_BUFFERED_EVENTS 256
+
+/*
+ * [EN] Events are buffered and written in blocks, a full buffer costs a single write().
+ * [ES] Los eventos se acumulan y escriben en bloques, un 'buffer' lleno cuesta un solo write().
+ */
+typedef struct {
+	InputEvent events[INPUT_RECORDER_BUFFERED_EVENTS];
+	int32 event_count;
+	int32 fd;
+	uint64 total_events;
+} InputRecorder;
+
+typedef enum {
+	INPUT_REPLAY_BY_FRAME, // events are due up to the next INPUT_EVENT_FRAME | por fotograma
+	INPUT_REPLAY_BY_TIME, // an event is due once its relative timestamp is reached | por tiempo
+} InputReplayMode;
+
+typedef struct {
+	const InputEvent* events;
+	uint64 event_count;
+	uint64 next_event;
+	const uint8* memory; // whole file | archivo completo
+	uint64 size;
+	InputReplayMode mode;
+} InputReplay;
+
+/*
+ * [EN] Returns the next event that is due, nullptr when none is due yet. By frame every event up to
+ * the next INPUT_EVENT_FRAME is due, by time every event up to elapsed_time (milliseconds since the
+ * replay started, relative to the first event). INPUT_EVENT_FRAME is never returned.
+ * [ES] Regresa el siguiente evento que toca, nullptr cuando aún no toca ninguno. Por fotograma toca
+ * cada evento hasta el siguiente INPUT_EVENT_FRAME, por tiempo cada evento hasta elapsed_time
+ * (milisegundos desde que empezó la repetición, relativos al primer evento). Nunca regresa
+ * INPUT_EVENT_FRAME.
+ */
+const InputEvent* inputReplayNext(InputReplay* replay, uint32 elapsed_time);
+
+/*
+ * [EN] By frame, once inputReplayNext() returned nullptr, takes the INPUT_EVENT_FRAME that ends the
+ * current step: the ticks and interpolation the recorded session used. False by time or when the
+ * log has no step left, the caller keeps its own clock.
+ * [ES] Por fotograma, una vez que inputReplayNext() regresó nullptr, toma el INPUT_EVENT_FRAME que
+ * cierra el paso actual: los pasos y la interpolación que usó la sesión grabada. Falso por tiempo o
+ * cuando al registro no le quedan pasos, quien llama conserva su propio reloj.
+ */
+bool8 inputReplayTakeFrame(InputReplay* replay, int32* ticks, float32* interpolation);
+bool8 inputReplayFinished(const InputReplay* replay);
+
+/*
+ * [EN] Keeps the low 24 bits of a microsecond timestamp in code and state, and takes previous
+ * forward to them: the time of the next motion as long as less than 16 s went by.
+ * [ES] Guarda los 24 bits bajos de una marca de tiempo en microsegundos en code y state, y lleva
+ * previous hacia adelante hasta ellos: el tiempo del siguiente movimiento mientras pasen menos de
+ * 16 s.
+ */
+void inputEventSetRelativeTime(InputEvent* event, uint64 time);
+uint64 inputEventRelativeTime(const InputEvent* event, uint64 previous);
+[[nodiscard]] bool8 inputLogValidate(const uint8* memory, uint64 size);
+
+/* platform | plataforma */
+[[nodiscard]] bool8 inputRecorderOpen(InputRecorder* recorder, const char* path);
+void inputRecorderWrite(InputRecorder* recorder, const InputEvent* event);
+void inputRecorderClose(InputRecorder* recorder); // flushes | vacía el 'buffer'
+[[nodiscard]] bool8 inputReplayOpen(InputReplay* replay, const char* path, InputReplayMode mode);
+void inputReplayClose(InputReplay* replay);
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,237 @@
+/* linux_asset_pack.c: linux platform asset pack mapping and loader | mapeo y cargador de paquetes */
+
+#include "../defines.h"
+#include "../types.h"
+#include "../log.h"
+#include "../asset_pack.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define ASSET_LOADER_QUEUE_SIZE 256 // power of two | potencia de dos
+
+typedef struct {
+	const AssetPackEntry* entry;
+	AssetLoadedCallback* callback;
+	void* context;
+} AssetLoadRequest;
+
+/*
+ * [EN] Ring of requests, the read and write counters only grow and are masked on access.
+ * [ES] Anillo de peticiones, los contadores de lectura y escritura sólo crecen y se enmascaran al
+ * accederse.
+ */
+typedef struct {
+	AssetLoadRequest requests[ASSET_LOADER_QUEUE_SIZE];
+	uint32 read;
+	uint32 write;
+} AssetLoadQueue;
+
+struct AssetLoader {
+	const AssetPack* pack;
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	pthread_cond_t pending_available;
+	AssetLoadQueue pending; // main thread -> loader thread
+	AssetLoadQueue completed; // loader thread -> main thread
+	int32 wake_fd; // eventfd, readable when there are completions | legible cuando hay terminadas
+	bool8 quit;
+	bool8 started;
+};
+
+bool8 assetPackOpen(AssetPack* pack, const char* path)
+{
+	*pack = (AssetPack){ 0 };
+	int32 fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		logInfo("No asset pack at %s (%s).", path, strerror(errno));
+		return false;
+	}
+	struct stat file_status;
+	if (fstat(fd, &file_status) < 0 || file_status.st_size <= 0) {
+		logError("Failed to get the size of the asset pack %s.", path);
+		close(fd);
+		return false;
+	}
+	uint64 size = (uint64)file_status.st_size;
+	void* memory = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd); // the mapping keeps the file alive | el mapeo mantiene vivo el archivo
+	if (memory == MAP_FAILED) {
+		logError("Failed to map the asset pack %s (%s).", path, strerror(errno));
+		return false;
+	}
+	if (!assetPackValidate(memory, size)) {
+		munmap(memory, size);
+		return false;
+	}
+
+	pack->memory = memory;
+	pack->size = size;
+	pack->header = memory;
+	pack->entries = (const AssetPackEntry*)(pack->memory + pack->header->toc_offset);
+	logInfo("Opened asset pack %s, %u assets in %llu bytes.", path, pack->header->entry_count,
+			(unsigned long long)size);
+	return true;
+}
+
+void assetPackClose(AssetPack* pack)
+{
+	if (pack->memory) {
+		munmap((void*)pack->memory, pack->size);
+	}
+	*pack = (AssetPack){ 0 };
+}
+
+/*
+ * [EN] Hints the kernel to start reading the pages in (readahead), then touches one byte per page
+ * so the pages are resident before the completion is reported.
+ * [ES] Indica al kernel que empiece a leer las páginas (lectura anticipada), después toca un byte
+ * por página para que estén residentes antes de reportar la finalización.
+ */
+internal void linuxAssetPrefetch(const AssetPack* pack, const AssetPackEntry* entry)
+{
+	if (entry->size == 0) {
+		return;
+	}
+	uint64 page_size = (uint64)sysconf(_SC_PAGESIZE);
+	uint64 first_page = entry->offset & ~(page_size - 1);
+	uint64 end = entry->offset + entry->size;
+	posix_madvise((void*)(pack->memory + first_page), end - first_page, POSIX_MADV_WILLNEED);
+
+	volatile uint8 sink = 0;
+	for (uint64 offset = first_page; offset < end; offset += page_size) {
+		sink += pack->memory[offset];
+	}
+	(void)sink;
+}
+
+internal void* linuxAssetLoaderEntry(void* data)
+{
+	AssetLoader* loader = data;
+	pthread_mutex_lock(&loader->mutex);
+	while (true) {
+		while (!loader->quit && loader->pending.read == loader->pending.write) {
+			pthread_cond_wait(&loader->pending_available, &loader->mutex);
+		}
+		if (loader->quit) {
+			break;
+		}
+		AssetLoadRequest request =
+			loader->pending.requests[loader->pending.read++ % ASSET_LOADER_QUEUE_SIZE];
+		pthread_mutex_unlock(&loader->mutex);
+
+		linuxAssetPrefetch(loader->pack, request.entry);
+
+		pthread_mutex_lock(&loader->mutex);
+		// [EN] Never overflows: completed + pending are bounded by the queue size on request
+		// [ES] Nunca se desborda: terminadas + pendientes se limitan al tamaño de la cola al pedir
+		loader->completed.requests[loader->completed.write++ % ASSET_LOADER_QUEUE_SIZE] = request;
+		uint64 one = 1;
+		if (write(loader->wake_fd, &one, sizeof(one)) < 0) {
+			logWarn("Linux platform: couldn't wake up the event loop (%s).", strerror(errno));
+		}
+	}
+	pthread_mutex_unlock(&loader->mutex);
+	return nullptr;
+}
+
+bool8 assetLoaderStart(AssetLoader* loader, const AssetPack* pack)
+{
+	*loader = (AssetLoader){ 0 };
+	loader->pack = pack;
+	loader->wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+	if (loader->wake_fd < 0) {
+		logError("Failed to create the asset loader eventfd (%s).", strerror(errno));
+		return false;
+	}
+	pthread_mutex_init(&loader->mutex, nullptr);
+	pthread_cond_init(&loader->pending_available, nullptr);
+	if (pthread_create(&loader->thread, nullptr, linuxAssetLoaderEntry, loader) != 0) {
+		logError("Failed to create the asset loader thread.");
+		pthread_cond_destroy(&loader->pending_available);
+		pthread_mutex_destroy(&loader->mutex);
+		close(loader->wake_fd);
+		loader->wake_fd = -1;
+		return false;
+	}
+	loader->started = true;
+	return true;
+}
+
+void assetLoaderStop(AssetLoader* loader)
+{
+	if (!loader->started) {
+		return;
+	}
+	pthread_mutex_lock(&loader->mutex);
+	loader->quit = true;
+	pthread_cond_signal(&loader->pending_available);
+	pthread_mutex_unlock(&loader->mutex);
+	pthread_join(loader->thread, nullptr);
+
+	pthread_cond_destroy(&loader->pending_available);
+	pthread_mutex_destroy(&loader->mutex);
+	close(loader->wake_fd);
+	loader->wake_fd = -1;
+	loader->started = false;
+}
+
+bool8 assetLoaderRequest(AssetLoader* loader, const AssetPackEntry* entry,
+		AssetLoadedCallback* callback, void* context)
+{
+	pthread_mutex_lock(&loader->mutex);
+	uint32 in_flight = (loader->pending.write - loader->pending.read)
+		+ (loader->completed.write - loader->completed.read);
+	if (in_flight >= ASSET_LOADER_QUEUE_SIZE) {
+		pthread_mutex_unlock(&loader->mutex);
+		logWarn("Asset loader queue full, request for %s rejected.", entry->name);
+		return false;
+	}
+	loader->pending.requests[loader->pending.write++ % ASSET_LOADER_QUEUE_SIZE] =
+		(AssetLoadRequest){ .entry = entry, .callback = callback, .context = context };
+	pthread_cond_signal(&loader->pending_available);
+	pthread_mutex_unlock(&loader->mutex);
+	return true;
+}
+
+int32 assetLoaderGetWakeFd(const AssetLoader* loader)
+{
+	return loader->started ? loader->wake_fd : -1;
+}
+
+int32 assetLoaderDispatch(AssetLoader* loader)
+{
+	if (!loader->started) {
+		return 0;
+	}
+	uint64 wake_count;
+	if (read(loader->wake_fd, &wake_count, sizeof(wake_count)) < 0) { // resets the eventfd
+		return 0; // EAGAIN, nothing completed | nada terminado
+	}
+
+	int32 delivered = 0;
+	while (true) {
+		pthread_mutex_lock(&loader->mutex);
+		if (loader->completed.read == loader->completed.write) {
+			pthread_mutex_unlock(&loader->mutex);
+			break;
+		}
+		AssetLoadRequest request =
+			loader->completed.requests[loader->completed.read++ % ASSET_LOADER_QUEUE_SIZE];
+		pthread_mutex_unlock(&loader->mutex);
+
+		// [EN] Callbacks run unlocked so they can request more assets
+		// [ES] Los callbacks se ejecutan sin candado para que puedan pedir más recursos
+		request.callback(request.context, request.entry, assetPackData(loader->pack, request.entry));
+		delivered++;
+	}
+	return delivered;
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,59 @@
+/* linux_clock.c: linux platform monotonic clock | reloj monotónico de la plataforma linux */
+
+#include "../defines.h"
+#include "../types.h"
+#include "../clock.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CLOCK_STARTTIME_FIELD 22 // of /proc/self/stat | de /proc/self/stat
+
+uint64 clockNowNanoseconds(void)
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time); // always available | siempre disponible
+	return ((uint64)time.tv_sec * NANOSECONDS_PER_SECOND) + (uint64)time.tv_nsec;
+}
+
+/*
+ * [EN] /proc/self/stat keeps the start in clock ticks since boot, CLOCK_BOOTTIME shares its origin.
+ * The command name (field 2) may hold spaces, fields are counted from its closing parenthesis.
+ * [ES] /proc/self/stat guarda el inicio en ticks de reloj desde el arranque, CLOCK_BOOTTIME
+ * comparte su origen. El nombre del comando (campo 2) puede tener espacios, los campos se cuentan
+ * desde su paréntesis de cierre.
+ */
+uint64 clockProcessStartNanoseconds(void)
+{
+	char stat[1024];
+	FILE* file = fopen("/proc/self/stat", "r");
+	if (!file) {
+		return 0;
+	}
+	uint64 length = fread(stat, 1, sizeof(stat) - 1, file);
+	fclose(file);
+	stat[length] = '\0';
+
+	char* field = strrchr(stat, ')');
+	for (int32 i = 2; field && i < CLOCK_STARTTIME_FIELD; ++i) {
+		field = strchr(field + 1, ' ');
+	}
+	unsigned long long start_ticks;
+	long ticks_per_second = sysconf(_SC_CLK_TCK);
+	if (!field || ticks_per_second <= 0 || sscanf(field, " %llu", &start_ticks) != 1) {
+		return 0;
+	}
+
+	struct timespec boot_time;
+	clock_gettime(CLOCK_BOOTTIME, &boot_time);
+	uint64 now = clockNowNanoseconds();
+	uint64 since_boot = ((uint64)boot_time.tv_sec * NANOSECONDS_PER_SECOND)
+		+ (uint64)boot_time.tv_nsec;
+	uint64 start = (uint64)start_ticks * (NANOSECONDS_PER_SECOND / (uint64)ticks_per_second);
+	uint64 age = since_boot - start;
+	return (start <= since_boot && age < now) ? now - age : 0;
+}
+
+/* 18/10/2026 - kanso engine */
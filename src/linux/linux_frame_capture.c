@@ -0,0 +1,260 @@
+/* linux_frame_capture.c: linux platform frame capture writer | escritor de captura de fotogramas */
+
+#include "../defines.h"
+#include "../types.h"
+#include "../log.h"
+#include "../render.h"
+#include "../frame_capture.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define FRAME_CAPTURE_SYNC_BYTES (64ull * 1024 * 1024) // between page cache drops | entre vaciados
+#define FRAME_CAPTURE_ALIGNMENT 64
+#define FRAME_CAPTURE_Y4M_HEADER "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n"
+
+/*
+ * [EN] Same ring as the asset loader: read and write only grow and are masked on access. Slots
+ * between read and write are queued for the writer thread; the slot at write belongs to the render
+ * thread while it is free.
+ * [ES] El mismo anillo que el cargador de recursos: read y write sólo crecen y se enmascaran al
+ * accederse. Las ranuras entre read y write esperan al hilo escritor; la ranura en write pertenece
+ * al hilo de dibujo mientras esté libre.
+ */
+struct FrameCapture {
+	uint32* staging[FRAME_CAPTURE_RING_SIZE];
+	uint32 read;
+	uint32 write;
+	int32 width;
+	int32 height;
+	uint8* yuv; // writer thread conversion buffer | 'buffer' de conversión del hilo escritor
+	FrameCaptureFormat format;
+	int32 fd;
+	uint64 file_offset;
+	uint64 synced_offset;
+	FrameCaptureStats stats;
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	pthread_cond_t frame_available;
+	bool8 quit;
+	bool8 started;
+};
+
+[[nodiscard]] internal bool8 linuxCaptureWrite(FrameCapture* capture, const void* data, uint64 size)
+{
+	const uint8* bytes = data;
+	while (size > 0) {
+		ssize_t written = write(capture->fd, bytes, size);
+		if (written < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			logError("Frame capture: write failed (%s).", strerror(errno));
+			return false;
+		}
+		bytes += written;
+		size -= (uint64)written;
+		capture->file_offset += (uint64)written;
+	}
+
+	/*
+	 * [EN] A capture is never read back, so written pages are dropped from the page cache once they
+	 * reach the disk instead of evicting the engine's working set (what O_DIRECT would avoid).
+	 * [ES] Una captura nunca se vuelve a leer, así que las páginas escritas se sacan del caché de
+	 * páginas al llegar al disco en vez de desalojar la memoria de trabajo del motor (lo que
+	 * O_DIRECT evitaría).
+	 */
+	if (capture->file_offset - capture->synced_offset >= FRAME_CAPTURE_SYNC_BYTES) {
+		fdatasync(capture->fd);
+		posix_fadvise(capture->fd, (off_t)capture->synced_offset,
+				(off_t)(capture->file_offset - capture->synced_offset), POSIX_FADV_DONTNEED);
+		capture->synced_offset = capture->file_offset;
+	}
+	return true;
+}
+
+[[nodiscard]] internal bool8 linuxCaptureWriteFrame(FrameCapture* capture, uint32* staging)
+{
+	int32 width = capture->width;
+	int32 height = capture->height;
+	if (capture->format == FRAME_CAPTURE_RAW) {
+		return linuxCaptureWrite(capture, staging, (uint64)width * height * sizeof(uint32));
+	}
+
+	if (capture->file_offset == 0) {
+		char header[96];
+		int32 length = snprintf(header, sizeof(header), FRAME_CAPTURE_Y4M_HEADER, width, height,
+				FRAME_CAPTURE_FRAME_RATE);
+		if (!linuxCaptureWrite(capture, header, (uint64)length)) {
+			return false;
+		}
+	}
+	Bitmap frame = { .memory = staging, .width = width, .height = height,
+		.bytes_per_row = width * (int32)sizeof(uint32) };
+	frameCaptureConvertToYuv420(&frame, capture->yuv);
+	return linuxCaptureWrite(capture, "FRAME\n", 6)
+		&& linuxCaptureWrite(capture, capture->yuv, frameCaptureYuv420Size(width, height));
+}
+
+internal void* linuxCaptureWriterEntry(void* data)
+{
+	FrameCapture* capture = data;
+	bool8 failed = false;
+	pthread_mutex_lock(&capture->mutex);
+	while (true) {
+		while (!capture->quit && capture->read == capture->write) {
+			pthread_cond_wait(&capture->frame_available, &capture->mutex);
+		}
+		if (capture->read == capture->write) { // quit with everything written | todo escrito
+			break;
+		}
+		uint32* staging = capture->staging[capture->read % FRAME_CAPTURE_RING_SIZE];
+		pthread_mutex_unlock(&capture->mutex);
+
+		// [EN] After a failure queued frames are consumed as dropped, the ring never stays full
+		// [ES] Después de un fallo los pendientes se consumen como descartados, el anillo se vacía
+		bool8 written = !failed && linuxCaptureWriteFrame(capture, staging);
+		failed = failed || !written;
+
+		pthread_mutex_lock(&capture->mutex);
+		capture->read++;
+		if (written) {
+			capture->stats.written++;
+		} else {
+			capture->stats.dropped++;
+		}
+	}
+	pthread_mutex_unlock(&capture->mutex);
+	return nullptr;
+}
+
+bool8 frameCaptureStart(FrameCapture* capture, const char* path, FrameCaptureFormat format)
+{
+	*capture = (FrameCapture){ .format = format };
+	capture->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+			S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+	if (capture->fd < 0) {
+		logError("Failed to create the capture file %s (%s).", path, strerror(errno));
+		return false;
+	}
+	pthread_mutex_init(&capture->mutex, nullptr);
+	pthread_cond_init(&capture->frame_available, nullptr);
+	if (pthread_create(&capture->thread, nullptr, linuxCaptureWriterEntry, capture) != 0) {
+		logError("Failed to create the frame capture thread.");
+		pthread_cond_destroy(&capture->frame_available);
+		pthread_mutex_destroy(&capture->mutex);
+		close(capture->fd);
+		capture->fd = -1;
+		return false;
+	}
+	capture->started = true;
+	return true;
+}
+
+void frameCaptureStop(FrameCapture* capture)
+{
+	if (!capture->started) {
+		return;
+	}
+	pthread_mutex_lock(&capture->mutex);
+	capture->quit = true;
+	pthread_cond_signal(&capture->frame_available);
+	pthread_mutex_unlock(&capture->mutex);
+	pthread_join(capture->thread, nullptr);
+
+	fdatasync(capture->fd);
+	close(capture->fd);
+	for (int32 i = 0; i < FRAME_CAPTURE_RING_SIZE; ++i) {
+		free(capture->staging[i]);
+	}
+	free(capture->yuv);
+	pthread_cond_destroy(&capture->frame_available);
+	pthread_mutex_destroy(&capture->mutex);
+	logInfo("Frame capture: %llu frames written, %llu dropped.",
+			(unsigned long long)capture->stats.written, (unsigned long long)capture->stats.dropped);
+	*capture = (FrameCapture){ .fd = -1 };
+}
+
+/*
+ * [EN] The staging ring is sized by the first frame, it's the only allocation on the render thread.
+ * [ES] El anillo se dimensiona con el primer fotograma, es la única reserva en el hilo de dibujo.
+ */
+[[nodiscard]] internal bool8 linuxCaptureAllocate(FrameCapture* capture, int32 width, int32 height)
+{
+	uint64 frame_size = (uint64)width * height * sizeof(uint32);
+	for (int32 i = 0; i < FRAME_CAPTURE_RING_SIZE; ++i) {
+		void* memory = nullptr;
+		if (posix_memalign(&memory, FRAME_CAPTURE_ALIGNMENT, frame_size) != 0) {
+			return false;
+		}
+		capture->staging[i] = memory;
+	}
+	if (capture->format == FRAME_CAPTURE_Y4M) {
+		capture->yuv = malloc(frameCaptureYuv420Size(width, height));
+		if (!capture->yuv) {
+			return false;
+		}
+	}
+	capture->width = width;
+	capture->height = height;
+	return true;
+}
+
+bool8 frameCaptureSubmit(FrameCapture* capture, const Bitmap* frame)
+{
+	if (!capture->started) {
+		return false;
+	}
+	if (capture->width == 0 && !linuxCaptureAllocate(capture, frame->width, frame->height)) {
+		logError("Frame capture: out of memory for the staging buffers, capture disabled.");
+		frameCaptureStop(capture);
+		return false;
+	}
+
+	pthread_mutex_lock(&capture->mutex);
+	capture->stats.submitted++;
+	bool8 full = (capture->write - capture->read) >= FRAME_CAPTURE_RING_SIZE;
+	if (full || frame->width != capture->width || frame->height != capture->height) {
+		capture->stats.dropped++;
+		pthread_mutex_unlock(&capture->mutex);
+		return false;
+	}
+	uint32* staging = capture->staging[capture->write % FRAME_CAPTURE_RING_SIZE];
+	pthread_mutex_unlock(&capture->mutex);
+
+	// [EN] The free slot is owned by this thread, copy unlocked | [ES] La ranura libre es nuestra
+	uint64 row_size = (uint64)frame->width * sizeof(uint32);
+	if (row_size == (uint64)frame->bytes_per_row) { // packed, a single copy | una sola copia
+		memcpy(staging, frame->memory, row_size * frame->height);
+	} else {
+		for (int32 row = 0; row < frame->height; ++row) {
+			memcpy((uint8*)staging + (row * row_size),
+					(const uint8*)frame->memory + ((int64)row * frame->bytes_per_row), row_size);
+		}
+	}
+
+	pthread_mutex_lock(&capture->mutex);
+	capture->write++;
+	pthread_cond_signal(&capture->frame_available);
+	pthread_mutex_unlock(&capture->mutex);
+	return true;
+}
+
+FrameCaptureStats frameCaptureGetStats(FrameCapture* capture)
+{
+	if (!capture->started) {
+		return (FrameCaptureStats){ 0 };
+	}
+	pthread_mutex_lock(&capture->mutex);
+	FrameCaptureStats stats = capture->stats;
+	pthread_mutex_unlock(&capture->mutex);
+	return stats;
+}
+
+/* 18/10/2026 - kanso engine */
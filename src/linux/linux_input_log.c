@@ -0,0 +1,131 @@
+/* linux_input_log.c: linux platform input log files | archivos de registro de entrada */
+
+#include "../defines.h"
+#include "../types.h"
+#include "../log.h"
+#include "../input_log.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+[[nodiscard]] internal bool8 linuxWriteAll(int32 fd, const void* data, uint64 size)
+{
+	const uint8* bytes = data;
+	while (size > 0) {
+		ssize_t written = write(fd, bytes, size);
+		if (written < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		bytes += written;
+		size -= (uint64)written;
+	}
+	return true;
+}
+
+bool8 inputRecorderOpen(InputRecorder* recorder, const char* path)
+{
+	recorder->event_count = 0;
+	recorder->total_events = 0;
+	recorder->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+			S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+	if (recorder->fd < 0) {
+		logError("Failed to create the input log %s (%s).", path, strerror(errno));
+		return false;
+	}
+	InputLogHeader header = { .magic = INPUT_LOG_MAGIC, .version = INPUT_LOG_VERSION,
+		.event_size = sizeof(InputEvent) };
+	if (!linuxWriteAll(recorder->fd, &header, sizeof(header))) {
+		logError("Failed to write the input log %s (%s).", path, strerror(errno));
+		close(recorder->fd);
+		recorder->fd = -1;
+		return false;
+	}
+	return true;
+}
+
+internal void linuxInputRecorderFlush(InputRecorder* recorder)
+{
+	if (recorder->event_count == 0) {
+		return;
+	}
+	if (!linuxWriteAll(recorder->fd, recorder->events,
+				(uint64)recorder->event_count * sizeof(InputEvent))) {
+		logError("Failed to write %d input events (%s), they are lost.", recorder->event_count,
+				strerror(errno));
+	}
+	recorder->event_count = 0;
+}
+
+void inputRecorderWrite(InputRecorder* recorder, const InputEvent* event)
+{
+	if (recorder->fd < 0) {
+		return;
+	}
+	recorder->events[recorder->event_count++] = *event;
+	recorder->total_events++;
+	if (recorder->event_count == INPUT_RECORDER_BUFFERED_EVENTS) {
+		linuxInputRecorderFlush(recorder);
+	}
+}
+
+void inputRecorderClose(InputRecorder* recorder)
+{
+	if (recorder->fd < 0) {
+		return;
+	}
+	linuxInputRecorderFlush(recorder);
+	close(recorder->fd);
+	recorder->fd = -1;
+	logInfo("Recorded %llu input events.", (unsigned long long)recorder->total_events);
+}
+
+bool8 inputReplayOpen(InputReplay* replay, const char* path, InputReplayMode mode)
+{
+	*replay = (InputReplay){ .mode = mode };
+	int32 fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		logError("Failed to open the input log %s (%s).", path, strerror(errno));
+		return false;
+	}
+	struct stat file_status;
+	if (fstat(fd, &file_status) < 0 || file_status.st_size <= 0) {
+		logError("Failed to get the size of the input log %s.", path);
+		close(fd);
+		return false;
+	}
+	uint64 size = (uint64)file_status.st_size;
+	void* memory = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd); // the mapping keeps the file alive | el mapeo mantiene vivo el archivo
+	if (memory == MAP_FAILED) {
+		logError("Failed to map the input log %s (%s).", path, strerror(errno));
+		return false;
+	}
+	if (!inputLogValidate(memory, size)) {
+		munmap(memory, size);
+		return false;
+	}
+
+	replay->memory = memory;
+	replay->size = size;
+	replay->events = (const InputEvent*)(replay->memory + sizeof(InputLogHeader));
+	replay->event_count = (size - sizeof(InputLogHeader)) / sizeof(InputEvent);
+	logInfo("Replaying %llu input events from %s.", (unsigned long long)replay->event_count, path);
+	return true;
+}
+
+void inputReplayClose(InputReplay* replay)
+{
+	if (replay->memory) {
+		munmap((void*)replay->memory, replay->size);
+	}
+	*replay = (InputReplay){ 0 };
+}
+
+/* 18/10/2026 - kanso engine */
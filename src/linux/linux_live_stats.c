@@ -0,0 +1,89 @@
+/* linux_live_stats.c: linux platform live metrics segment | segmento de métricas en vivo linux */
+
+#include "../defines.h"
+#include "../types.h"
+#include "../log.h"
+#include "../live_stats.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool8 liveStatsCreate(LiveStatsSegment* segment)
+{
+	*segment = (LiveStatsSegment){ 0 };
+	snprintf(segment->name, sizeof(segment->name), LIVE_STATS_NAME_FORMAT, (int32)getpid());
+	int32 fd = -1;
+	if (!linuxCreateNamedShmObject(segment->name, sizeof(LiveStatsPage), &fd)) {
+		return false;
+	}
+	void* memory = mmap(nullptr, sizeof(LiveStatsPage), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd); // the mapping keeps the object | el mapeo conserva el objeto
+	if (memory == MAP_FAILED) {
+		logError("Failed to map the live stats page (%s).", strerror(errno));
+		shm_unlink(segment->name);
+		return false;
+	}
+
+	// [EN] ftruncate() zero filled it, magic goes last | [ES] Ya en ceros, la firma va al final
+	segment->page = memory;
+	segment->page->size = sizeof(LiveStatsPage);
+	segment->page->version = LIVE_STATS_VERSION;
+	segment->page->pid = (int32)getpid();
+	atomic_thread_fence(memory_order_release);
+	segment->page->magic = LIVE_STATS_MAGIC;
+	segment->owner = true;
+	return true;
+}
+
+bool8 liveStatsAttach(LiveStatsSegment* segment, int32 pid)
+{
+	*segment = (LiveStatsSegment){ 0 };
+	snprintf(segment->name, sizeof(segment->name), LIVE_STATS_NAME_FORMAT, pid);
+	int32 fd = shm_open(segment->name, O_RDONLY, 0);
+	if (fd < 0) {
+		logError("No live stats for pid %d (%s).", pid, strerror(errno));
+		return false;
+	}
+	struct stat status;
+	if (fstat(fd, &status) != 0 || status.st_size < (off_t)sizeof(LiveStatsPage)) {
+		logError("The live stats object %s is too small, different engine version?", segment->name);
+		close(fd);
+		return false;
+	}
+	void* memory = mmap(nullptr, sizeof(LiveStatsPage), PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (memory == MAP_FAILED) {
+		logError("Failed to map %s (%s).", segment->name, strerror(errno));
+		return false;
+	}
+
+	const LiveStatsPage* page = memory;
+	if (page->magic != LIVE_STATS_MAGIC || page->version != LIVE_STATS_VERSION
+			|| page->size != sizeof(LiveStatsPage)) {
+		logError("%s has version %u, expected %u.", segment->name, page->version,
+				LIVE_STATS_VERSION);
+		munmap(memory, sizeof(LiveStatsPage));
+		return false;
+	}
+	segment->page = memory;
+	return true;
+}
+
+void liveStatsClose(LiveStatsSegment* segment)
+{
+	if (!segment->page) {
+		return;
+	}
+	munmap(segment->page, sizeof(LiveStatsPage));
+	if (segment->owner) {
+		shm_unlink(segment->name);
+	}
+	*segment = (LiveStatsSegment){ 0 };
+}
+
+/* 18/10/2026 - kanso engine */
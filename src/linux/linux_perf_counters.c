@@ -0,0 +1,153 @@
+/* linux_perf_counters.c: linux platform performance counters | contadores de rendimiento linux */
+
+#include "../defines.h"
+#include "../types.h"
+#include "../log.h"
+#include "../perf_counters.h"
+
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+long syscall(long number, ...); // not declared under _POSIX_C_SOURCE | no declarada
+
+#define PERF_COUNTERS_READ_FORMAT (PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED \
+		| PERF_FORMAT_TOTAL_TIME_RUNNING)
+#define PERF_COUNTERS_CACHE_READ_MISS(cache) ((cache) | (PERF_COUNT_HW_CACHE_OP_READ << 8) \
+		| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+typedef struct {
+	uint32 type;
+	uint64 config;
+} LinuxPerfEvent;
+
+global_variable const LinuxPerfEvent perf_events[PERF_COUNTER_COUNT] = {
+	[PERF_COUNTER_CYCLES] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+	[PERF_COUNTER_INSTRUCTIONS] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+	[PERF_COUNTER_LLC_MISSES] = { PERF_TYPE_HW_CACHE,
+		PERF_COUNTERS_CACHE_READ_MISS(PERF_COUNT_HW_CACHE_LL) },
+	[PERF_COUNTER_DTLB_MISSES] = { PERF_TYPE_HW_CACHE,
+		PERF_COUNTERS_CACHE_READ_MISS(PERF_COUNT_HW_CACHE_DTLB) },
+	[PERF_COUNTER_PAGE_FAULTS] = { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS },
+	[PERF_COUNTER_TASK_CLOCK] = { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK },
+};
+
+/*
+ * [EN] Every counter belongs to the group of the first one opened, a single read() of the leader
+ * returns all of them taken at the same instant, in the order they were opened.
+ * [ES] Cada contador pertenece al grupo del primero abierto, un solo read() del líder los devuelve
+ * todos tomados en el mismo instante, en el orden en que se abrieron.
+ */
+struct PerfCounters {
+	int32 fds[PERF_COUNTER_COUNT]; // opening order, fds[0] leads | orden de apertura, fds[0] lidera
+	PerfCounter counters[PERF_COUNTER_COUNT];
+	int32 count;
+	PerfCountersMode mode;
+	PerfSample previous;
+};
+
+internal int32 linuxPerfEventOpen(PerfCounter counter, int32 group_fd)
+{
+	struct perf_event_attr attr = { 0 };
+	attr.size = sizeof(attr);
+	attr.type = perf_events[counter].type;
+	attr.config = perf_events[counter].config;
+	attr.read_format = PERF_COUNTERS_READ_FORMAT;
+	attr.exclude_hv = 1;
+
+	// [EN] pid 0 and cpu -1: the calling thread on any core | [ES] El hilo que llama en todo núcleo
+	int32 fd = (int32)syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC);
+	if (fd < 0 && (errno == EACCES || errno == EPERM)) { // perf_event_paranoid >= 2
+		attr.exclude_kernel = 1;
+		fd = (int32)syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC);
+	}
+	return fd;
+}
+
+[[nodiscard]] internal bool8 linuxPerfCountersRead(PerfCounters* counters, PerfSample* sample)
+{
+	uint64 data[3 + PERF_COUNTER_COUNT]; // count, time enabled, time running, values
+	ssize_t size = read(counters->fds[0], data, sizeof(data));
+	if (size < (ssize_t)(3 * sizeof(uint64)) || data[0] != (uint64)counters->count) {
+		return false;
+	}
+
+	// [EN] Scaled up when the kernel multiplexed the group | [ES] Escalado si se multiplexó
+	uint64 enabled = data[1];
+	uint64 running = data[2];
+	*sample = (PerfSample){ 0 };
+	for (int32 i = 0; i < counters->count; ++i) {
+		uint64 value = data[3 + i];
+		if (running > 0 && running < enabled) {
+			value = (uint64)((float64)value * ((float64)enabled / (float64)running));
+		}
+		sample->values[counters->counters[i]] = value;
+		sample->available |= 1u << counters->counters[i];
+	}
+	return true;
+}
+
+bool8 perfCountersOpen(PerfCounters* counters)
+{
+	*counters = (PerfCounters){ .mode = PERF_COUNTERS_HARDWARE };
+	PerfCounter leader = PERF_COUNTER_CYCLES;
+	int32 leader_fd = linuxPerfEventOpen(leader, -1);
+	if (leader_fd < 0) {
+		logWarn("Hardware performance counters unavailable (%s), using software counters.",
+				strerror(errno));
+		counters->mode = PERF_COUNTERS_SOFTWARE;
+		leader = PERF_COUNTER_TASK_CLOCK;
+		leader_fd = linuxPerfEventOpen(leader, -1);
+		if (leader_fd < 0) {
+			logError("Failed to open the performance counters (%s).", strerror(errno));
+			counters->mode = PERF_COUNTERS_OFF;
+			return false;
+		}
+	}
+	counters->fds[counters->count] = leader_fd;
+	counters->counters[counters->count++] = leader;
+
+	for (PerfCounter counter = 0; counter < PERF_COUNTER_COUNT; ++counter) {
+		bool8 hardware = perf_events[counter].type != PERF_TYPE_SOFTWARE;
+		if (counter == leader || (hardware && counters->mode == PERF_COUNTERS_SOFTWARE)) {
+			continue;
+		}
+		int32 fd = linuxPerfEventOpen(counter, leader_fd);
+		if (fd < 0) { // some cores lack an event, the rest still count | el resto aún cuenta
+			logWarn("Performance counter %d unavailable (%s).", counter, strerror(errno));
+			continue;
+		}
+		counters->fds[counters->count] = fd;
+		counters->counters[counters->count++] = counter;
+	}
+
+	if (!linuxPerfCountersRead(counters, &counters->previous)) {
+		logError("Failed to read the performance counters.");
+		perfCountersClose(counters);
+		return false;
+	}
+	return true;
+}
+
+void perfCountersClose(PerfCounters* counters)
+{
+	for (int32 i = counters->count - 1; i >= 0; --i) { // leader last | el líder al final
+		close(counters->fds[i]);
+	}
+	*counters = (PerfCounters){ .mode = PERF_COUNTERS_OFF };
+}
+
+PerfFrameStats perfCountersSampleFrame(PerfCounters* counters)
+{
+	PerfSample sample;
+	if (counters->mode == PERF_COUNTERS_OFF || !linuxPerfCountersRead(counters, &sample)) {
+		return (PerfFrameStats){ .mode = PERF_COUNTERS_OFF };
+	}
+	PerfFrameStats stats = perfFrameStatsCompute(&counters->previous, &sample, counters->mode);
+	counters->previous = sample;
+	return stats;
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,112 @@
+/* linux_shm.c: linux platform POSIX shared memory objects | objetos de memoria compartida POSIX */
+
+#include "../defines.h"
+#include "../types.h"
+#include "../log.h"
+#include "../clock.h"
+#include "../random.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*
+ * [EN] Takes a null-character terminated string and replaces every occurrence of the
+ * char_to_replace in the string with a letter from 'A' to 'P' or 'a' to 'p'. Each letter takes 5
+ * bits, a 64-bit number covers 12 of them.
+ * [ES] Toma un string finalizado con el caracter nulo y reemplaza cada aparición del caracter
+ * char_to_replace por una letra desde 'A' hasta 'P', o bien, desde 'a' hasta 'p'. Cada letra toma
+ * 5 bits, un número de 64 bits cubre 12 de ellas.
+ */
+internal void linuxRandomizeCharacterInString(Random* random, char string[], char char_to_replace)
+{
+	uint64 bits = 0;
+	int32 bits_left = 0;
+	for (char* c = string; *c != '\0'; ++c) {
+		if (*c == char_to_replace) {
+			if (bits_left < 5) {
+				bits = randomNext(random);
+				bits_left = 64;
+			}
+			*c = 'A' + (0b0010'0000 & bits) + (0b0000'1111 & bits); // A-P o a-p
+			bits >>= 5;
+			bits_left -= 5;
+		}
+	}
+}
+
+/*
+ * [EN] Creates the shared memory object name with size bytes, failing if it already exists.
+ * [ES] Crea el objeto de memoria compartida name con size bytes, falla si ya existe.
+ */
+[[nodiscard]] internal bool8 linuxOpenNewShmObject(const char* name, int64 size, int32* fd)
+{
+	*fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+	if (*fd < 0) {
+		return false;
+	}
+	if (ftruncate(*fd, size) != 0) {
+		logError("Linux platform: ftruncate() of %s failed (%s).", name, strerror(errno));
+		close(*fd);
+		shm_unlink(name);
+		*fd = -1;
+		return false;
+	}
+	return true;
+}
+
+/*
+ * [EN] Anonymous object for pixel buffers: the name is unlinked right away, the file descriptor is
+ * the only reference.
+ * [ES] Objeto anónimo para 'buffers' de píxeles: el nombre se desvincula de inmediato, el
+ * descriptor de archivo es la única referencia.
+ */
+[[nodiscard]] bool8 linuxCreateShmObject(int64 size, int32* fd)
+{
+	int32 retries = 16; // number of times the shm_open operation could fail before it stops trying
+	const char shm_name_template[] = "/kanso_shm_$$$$";
+	char shm_name[sizeof(shm_name_template)];
+	// [EN] Time and pid keep two processes apart | [ES] Tiempo y pid separan a dos procesos
+	Random random;
+	randomSeed(&random, clockNowNanoseconds() ^ ((uint64)getpid() << 32));
+	*fd = -1;
+	while (retries > 0) {
+		memcpy(shm_name, shm_name_template, sizeof(shm_name));
+		linuxRandomizeCharacterInString(&random, shm_name, '$');
+		if (linuxOpenNewShmObject(shm_name, size, fd)) {
+			break;
+		}
+		retries--;
+	};
+
+	if (*fd < 0) {
+		logError("Linux platform: couldn't create a shared memory object (%s).", strerror(errno));
+		return false;
+	}
+	shm_unlink(shm_name);
+
+	return true;
+}
+
+/*
+ * [EN] Named object other processes can open with shm_open(name). A leftover object with the same
+ * name (a crashed instance with a reused pid) is replaced. The owner unlinks it when done.
+ * [ES] Objeto con nombre que otros procesos pueden abrir con shm_open(name). Un objeto sobrante con
+ * el mismo nombre (una instancia que falló con un pid reutilizado) se reemplaza. El dueño lo
+ * desvincula al terminar.
+ */
+[[nodiscard]] bool8 linuxCreateNamedShmObject(const char* name, int64 size, int32* fd)
+{
+	shm_unlink(name);
+	if (!linuxOpenNewShmObject(name, size, fd)) {
+		logError("Linux platform: couldn't create the shared memory object %s (%s).", name,
+				strerror(errno));
+		return false;
+	}
+	return true;
+}
+
+/* 18/10/2026 - kanso engine */
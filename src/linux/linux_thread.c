@@ -0,0 +1,502 @@
+/* linux_thread.c: linux platform threading primitives | primitivas de hilos de la plataforma linux */
+
+#include "../defines.h"
+#include "../types.h"
+#include "../log.h"
+#include "../thread.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*
+ * [EN] glibc only declares syscall() with _DEFAULT_SOURCE, the build defines _POSIX_C_SOURCE. It's
+ * used for sched_setaffinity, whose wrapper and cpu_set_t need _GNU_SOURCE.
+ * [ES] glibc sólo declara syscall() con _DEFAULT_SOURCE, la compilación define _POSIX_C_SOURCE. Se
+ * usa para sched_setaffinity, cuyo envoltorio y cpu_set_t requieren _GNU_SOURCE.
+ */
+long syscall(long number, ...);
+
+#define JOB_CACHE_LINE_SIZE 64
+#define JOB_SPIN_COUNT 256 // failed searches before a worker sleeps | búsquedas antes de dormir
+#define JOB_AFFINITY_MASK_WORDS 16 // 1024 cores
+
+typedef struct Job Job;
+struct Job {
+	JobFunction* function;
+	void* context;
+	JobCounter* counter;
+	JobCounter* dependency;
+	Job* next_deferred;
+	atomic_bool unfinished; // from jobRunAfter() until it ran | hasta que se ejecutó
+};
+
+/*
+ * [EN] Chase-Lev deque with the C11 memory orderings of Lê et al. (2013), fixed size. Only the
+ * owner touches bottom; thieves race on top with a CAS, and so does the owner for the last job.
+ * [ES] Cola doble de Chase-Lev con los órdenes de memoria de C11 de Lê et al. (2013), de tamaño
+ * fijo. Sólo el dueño toca bottom; los ladrones compiten por top con un CAS, y también el dueño por
+ * el último trabajo.
+ */
+typedef struct {
+	alignas(JOB_CACHE_LINE_SIZE) atomic_llong top;
+	alignas(JOB_CACHE_LINE_SIZE) atomic_llong bottom;
+	alignas(JOB_CACHE_LINE_SIZE) _Atomic(Job*) jobs[JOB_QUEUE_SIZE];
+} LinuxJobQueue;
+
+typedef struct {
+	LinuxJobQueue queue;
+	Job jobs[JOB_QUEUE_SIZE]; // ring, owner only | anillo, sólo del dueño
+	uint32 next_job;
+	uint32 random; // victim selection | selección de víctima
+	int32 index;
+	pthread_t thread;
+	bool8 started;
+} LinuxJobWorker;
+
+typedef struct {
+	LinuxJobWorker* workers; // [0] is the thread that started the system | el hilo que lo inició
+	int32 thread_count;
+	JobAffinity affinity;
+	atomic_bool quit;
+	atomic_int sleeping;
+	pthread_mutex_t mutex;
+	pthread_cond_t work_available;
+	pthread_mutex_t deferred_mutex;
+	Job* deferred; // waiting for a dependency | esperando una dependencia
+	atomic_int deferred_count;
+	bool8 started;
+} LinuxJobSystem;
+
+global_variable LinuxJobSystem job_system;
+internal thread_local LinuxJobWorker* job_worker; // nullptr outside the pool | fuera del grupo
+
+#define MAX_PARALLEL_FOR_THREADS JOB_MAX_THREADS
+
+typedef struct {
+	ThreadRangeTask* task;
+	void* context;
+	int32 begin;
+	int32 end;
+} LinuxThreadRange;
+
+internal void linuxThreadRangeEntry(void* data)
+{
+	LinuxThreadRange* range = data;
+	range->task(range->context, range->begin, range->end);
+}
+
+int32 threadGetCoreCount(void)
+{
+	persist int32 core_count = 0;
+	if (core_count == 0) {
+		int64 online_cores = sysconf(_SC_NPROCESSORS_ONLN);
+		core_count = (online_cores > 0) ? (int32)online_cores : 1;
+	}
+	return core_count;
+}
+
+void threadParallelFor(int32 count, int32 min_batch_size, ThreadRangeTask* task, void* context)
+{
+	if (count <= 0) {
+		return;
+	}
+	if (min_batch_size < 1) {
+		min_batch_size = 1;
+	}
+
+	// [EN] Rounded down, so the even split never makes a range below min_batch_size
+	// [ES] Redondeado hacia abajo, la división pareja nunca hace un rango menor a min_batch_size
+	int32 thread_count = jobSystemGetThreadCount();
+	int32 batch_count = count / min_batch_size;
+	if (thread_count > batch_count) {
+		thread_count = batch_count;
+	}
+	if (thread_count > MAX_PARALLEL_FOR_THREADS) {
+		thread_count = MAX_PARALLEL_FOR_THREADS;
+	}
+	if (thread_count <= 1) { // not worth a job | no vale la pena un trabajo
+		task(context, 0, count);
+		return;
+	}
+
+	LinuxThreadRange ranges[MAX_PARALLEL_FOR_THREADS];
+	for (int32 i = 0; i < thread_count; ++i) {
+		ranges[i].task = task;
+		ranges[i].context = context;
+		ranges[i].begin = (int32)(((int64)count * i) / thread_count);
+		ranges[i].end = (int32)(((int64)count * (i + 1)) / thread_count);
+	}
+
+	// [EN] Range 0 runs on the calling thread | [ES] El rango 0 se ejecuta en el hilo que llama
+	JobCounter counter = { 0 };
+	for (int32 i = 1; i < thread_count; ++i) {
+		jobRun(linuxThreadRangeEntry, &ranges[i], &counter);
+	}
+	linuxThreadRangeEntry(&ranges[0]);
+	jobWait(&counter);
+}
+
+[[nodiscard]] internal bool8 linuxJobPush(LinuxJobQueue* queue, Job* job)
+{
+	int64 bottom = atomic_load_explicit(&queue->bottom, memory_order_relaxed);
+	int64 top = atomic_load_explicit(&queue->top, memory_order_acquire);
+	if (bottom - top >= JOB_QUEUE_SIZE) {
+		return false;
+	}
+	atomic_store_explicit(&queue->jobs[bottom & (JOB_QUEUE_SIZE - 1)], job, memory_order_relaxed);
+	atomic_store_explicit(&queue->bottom, bottom + 1, memory_order_release); // publishes the job
+	return true;
+}
+
+internal Job* linuxJobPop(LinuxJobQueue* queue)
+{
+	int64 bottom = atomic_load_explicit(&queue->bottom, memory_order_relaxed) - 1;
+	atomic_store_explicit(&queue->bottom, bottom, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+	int64 top = atomic_load_explicit(&queue->top, memory_order_relaxed);
+	if (top > bottom) { // empty | vacía
+		atomic_store_explicit(&queue->bottom, bottom + 1, memory_order_relaxed);
+		return nullptr;
+	}
+	Job* job = atomic_load_explicit(&queue->jobs[bottom & (JOB_QUEUE_SIZE - 1)],
+			memory_order_relaxed);
+	if (top == bottom) { // last job, thieves may want it too | último, los ladrones también
+		if (!atomic_compare_exchange_strong_explicit(&queue->top, &top, top + 1,
+					memory_order_seq_cst, memory_order_relaxed)) {
+			job = nullptr;
+		}
+		atomic_store_explicit(&queue->bottom, bottom + 1, memory_order_relaxed);
+	}
+	return job;
+}
+
+internal Job* linuxJobSteal(LinuxJobQueue* queue)
+{
+	int64 top = atomic_load_explicit(&queue->top, memory_order_acquire);
+	atomic_thread_fence(memory_order_seq_cst);
+	int64 bottom = atomic_load_explicit(&queue->bottom, memory_order_acquire);
+	if (top >= bottom) {
+		return nullptr;
+	}
+	Job* job = atomic_load_explicit(&queue->jobs[top & (JOB_QUEUE_SIZE - 1)],
+			memory_order_relaxed);
+	if (!atomic_compare_exchange_strong_explicit(&queue->top, &top, top + 1,
+				memory_order_seq_cst, memory_order_relaxed)) {
+		return nullptr; // lost the race | perdió la carrera
+	}
+	return job;
+}
+
+/*
+ * [EN] Own deque first, then one steal attempt per other deque starting at a random victim so
+ * thieves don't all hit worker 0.
+ * [ES] Primero la cola propia, luego un intento de robo por cada otra cola empezando en una
+ * víctima aleatoria para que los ladrones no vayan todos al trabajador 0.
+ */
+internal Job* linuxJobFind(LinuxJobWorker* self)
+{
+	if (self) {
+		Job* job = linuxJobPop(&self->queue);
+		if (job) {
+			return job;
+		}
+	}
+	int32 thread_count = job_system.thread_count;
+	uint32 random = self ? self->random : (uint32)(uintptr_t)&thread_count;
+	random ^= random << 13; // xorshift32
+	random ^= random >> 17;
+	random ^= random << 5;
+	if (self) {
+		self->random = random;
+	}
+	for (int32 i = 0; i < thread_count; ++i) {
+		LinuxJobWorker* victim = &job_system.workers[(random + (uint32)i) % (uint32)thread_count];
+		if (victim != self) {
+			Job* job = linuxJobSteal(&victim->queue);
+			if (job) {
+				return job;
+			}
+		}
+	}
+	return nullptr;
+}
+
+internal bool8 linuxJobAvailable(void)
+{
+	for (int32 i = 0; i < job_system.thread_count; ++i) {
+		LinuxJobQueue* queue = &job_system.workers[i].queue;
+		if (atomic_load(&queue->top) < atomic_load(&queue->bottom)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+internal void linuxJobExecute(Job* job);
+
+/*
+ * [EN] Queues a job whose dependency is done, or runs it right away when the deque is full or the
+ * thread has no deque.
+ * [ES] Encola un trabajo cuya dependencia terminó, o lo ejecuta de inmediato cuando la cola está
+ * llena o el hilo no tiene cola.
+ */
+internal void linuxJobSubmit(Job* job)
+{
+	if (!job_worker || !linuxJobPush(&job_worker->queue, job)) {
+		Job copy = *job; // the ring slot may be reused meanwhile | la ranura puede reutilizarse
+		atomic_store_explicit(&job->unfinished, false, memory_order_relaxed);
+		linuxJobExecute(&copy);
+		return;
+	}
+	/*
+	 * [EN] The push only releases bottom, without the fence the load below may move before it: a
+	 * worker could then see no job and go to sleep while this thread sees no sleeper.
+	 * [ES] El 'push' sólo libera bottom, sin la barrera la lectura de abajo puede adelantarse: un
+	 * trabajador podría entonces no ver el trabajo y dormirse mientras este hilo no ve a nadie
+	 * dormido.
+	 */
+	atomic_thread_fence(memory_order_seq_cst);
+	if (atomic_load(&job_system.sleeping) > 0) {
+		pthread_mutex_lock(&job_system.mutex);
+		pthread_cond_signal(&job_system.work_available);
+		pthread_mutex_unlock(&job_system.mutex);
+	}
+}
+
+internal void linuxJobReleaseDeferred(void)
+{
+	Job* released = nullptr;
+	pthread_mutex_lock(&job_system.deferred_mutex);
+	Job** link = &job_system.deferred;
+	while (*link) {
+		Job* job = *link;
+		if (atomic_load(&job->dependency->pending) == 0) {
+			*link = job->next_deferred;
+			job->next_deferred = released;
+			released = job;
+			atomic_fetch_sub(&job_system.deferred_count, 1);
+		} else {
+			link = &job->next_deferred;
+		}
+	}
+	pthread_mutex_unlock(&job_system.deferred_mutex);
+
+	while (released) {
+		Job* next = released->next_deferred;
+		linuxJobSubmit(released);
+		released = next;
+	}
+}
+
+internal void linuxJobExecute(Job* job)
+{
+	JobCounter* counter = job->counter;
+	job->function(job->context);
+	atomic_store_explicit(&job->unfinished, false, memory_order_release);
+	if (counter && atomic_fetch_sub(&counter->pending, 1) == 1
+			&& atomic_load(&job_system.deferred_count) > 0) {
+		linuxJobReleaseDeferred();
+	}
+}
+
+/*
+ * [EN] Pins the calling thread to a single core with the raw sched_setaffinity system call.
+ * [ES] Fija el hilo que llama a un solo núcleo con la llamada al sistema sched_setaffinity.
+ */
+internal void linuxThreadPin(int32 core)
+{
+	uint64 mask[JOB_AFFINITY_MASK_WORDS] = { 0 };
+	if (core < 0 || core >= JOB_AFFINITY_MASK_WORDS * 64) {
+		return;
+	}
+	mask[core / 64] = 1ull << (core % 64);
+	if (syscall(SYS_sched_setaffinity, 0, sizeof(mask), mask) != 0) {
+		logWarn("Linux platform: failed to pin a thread to core %d.", core);
+	}
+}
+
+internal void* linuxJobWorkerEntry(void* data)
+{
+	LinuxJobWorker* worker = data;
+	job_worker = worker;
+	if (job_system.affinity == JOB_AFFINITY_PINNED) {
+		linuxThreadPin(1 + ((worker->index - 1) % (threadGetCoreCount() - 1)));
+	}
+
+	int32 failed_searches = 0;
+	while (!atomic_load(&job_system.quit)) {
+		Job* job = linuxJobFind(worker);
+		if (job) {
+			linuxJobExecute(job);
+			failed_searches = 0;
+			continue;
+		}
+		if (++failed_searches < JOB_SPIN_COUNT) {
+			sched_yield();
+			continue;
+		}
+
+		// [EN] Pushers signal under the mutex when sleeping > 0, checked after the increment
+		// [ES] Quien encola avisa bajo el mutex si sleeping > 0, se revisa tras el incremento
+		pthread_mutex_lock(&job_system.mutex);
+		atomic_fetch_add(&job_system.sleeping, 1);
+		atomic_thread_fence(memory_order_seq_cst); // see linuxJobSubmit() | ver linuxJobSubmit()
+		while (!atomic_load(&job_system.quit) && !linuxJobAvailable()) {
+			pthread_cond_wait(&job_system.work_available, &job_system.mutex);
+		}
+		atomic_fetch_sub(&job_system.sleeping, 1);
+		pthread_mutex_unlock(&job_system.mutex);
+		failed_searches = 0;
+	}
+	job_worker = nullptr;
+	return nullptr;
+}
+
+bool8 jobSystemStart(int32 worker_count, JobAffinity affinity)
+{
+	int32 core_count = threadGetCoreCount();
+	if (worker_count <= 0) {
+		worker_count = core_count - 1;
+	}
+	if (worker_count > JOB_MAX_THREADS - 1) {
+		worker_count = JOB_MAX_THREADS - 1;
+	}
+	if (affinity == JOB_AFFINITY_PINNED && core_count < 2) {
+		logWarn("Linux platform: a single core, threads are not pinned.");
+		affinity = JOB_AFFINITY_NONE;
+	}
+
+	job_system = (LinuxJobSystem){ .thread_count = worker_count + 1, .affinity = affinity };
+	void* memory = nullptr;
+	uint64 size = sizeof(LinuxJobWorker) * (uint64)job_system.thread_count;
+	if (posix_memalign(&memory, JOB_CACHE_LINE_SIZE, size) != 0) {
+		logError("Linux platform: out of memory for the job system.");
+		return false;
+	}
+	job_system.workers = memory;
+	for (int32 i = 0; i < job_system.thread_count; ++i) {
+		LinuxJobWorker* worker = &job_system.workers[i];
+		atomic_init(&worker->queue.top, 0);
+		atomic_init(&worker->queue.bottom, 0);
+		worker->next_job = 0;
+		worker->random = 0x9E37'79B9u * (uint32)(i + 1);
+		worker->index = i;
+		worker->started = false;
+	}
+	pthread_mutex_init(&job_system.mutex, nullptr);
+	pthread_cond_init(&job_system.work_available, nullptr);
+	pthread_mutex_init(&job_system.deferred_mutex, nullptr);
+
+	job_worker = &job_system.workers[0];
+	if (affinity == JOB_AFFINITY_PINNED) {
+		linuxThreadPin(0);
+	}
+	job_system.started = true;
+	for (int32 i = 1; i < job_system.thread_count; ++i) {
+		LinuxJobWorker* worker = &job_system.workers[i];
+		worker->started = !pthread_create(&worker->thread, nullptr, linuxJobWorkerEntry, worker);
+		if (!worker->started) {
+			// [EN] Its deque stays empty, the others never find work there
+			// [ES] Su cola queda vacía, los demás nunca encuentran trabajo ahí
+			logWarn("Linux platform: pthread_create() failed for job worker %d.", i);
+		}
+	}
+	return true;
+}
+
+void jobSystemStop(void)
+{
+	if (!job_system.started) {
+		return;
+	}
+	pthread_mutex_lock(&job_system.mutex);
+	atomic_store(&job_system.quit, true);
+	pthread_cond_broadcast(&job_system.work_available);
+	pthread_mutex_unlock(&job_system.mutex);
+	for (int32 i = 1; i < job_system.thread_count; ++i) {
+		if (job_system.workers[i].started) {
+			pthread_join(job_system.workers[i].thread, nullptr);
+		}
+	}
+	pthread_mutex_destroy(&job_system.deferred_mutex);
+	pthread_cond_destroy(&job_system.work_available);
+	pthread_mutex_destroy(&job_system.mutex);
+	free(job_system.workers);
+	job_worker = nullptr;
+	job_system = (LinuxJobSystem){ 0 };
+}
+
+int32 jobSystemGetThreadCount(void)
+{
+	return job_system.started ? job_system.thread_count : 1;
+}
+
+void jobRun(JobFunction* function, void* context, JobCounter* counter)
+{
+	jobRunAfter(function, context, counter, nullptr);
+}
+
+void jobRunAfter(JobFunction* function, void* context, JobCounter* counter,
+		JobCounter* dependency)
+{
+	if (counter) {
+		atomic_fetch_add(&counter->pending, 1);
+	}
+	if (!job_worker) { // no deque, run here | sin cola, ejecutar aquí
+		if (dependency) {
+			jobWait(dependency);
+		}
+		Job job = { .function = function, .context = context, .counter = counter };
+		linuxJobExecute(&job);
+		return;
+	}
+
+	/*
+	 * [EN] A slot comes back after JOB_QUEUE_SIZE jobs. One still deferred or running means too
+	 * many jobs in flight, overwriting it would lose a job or corrupt the deferred list.
+	 * [ES] Una ranura vuelve después de JOB_QUEUE_SIZE trabajos. Si sigue diferido o en ejecución
+	 * hay demasiados trabajos en curso, sobrescribirlo perdería un trabajo o corrompería la lista
+	 * de diferidos.
+	 */
+	Job* job = &job_worker->jobs[job_worker->next_job++ & (JOB_QUEUE_SIZE - 1)];
+	assert(!atomic_load_explicit(&job->unfinished, memory_order_acquire),
+			"More than JOB_QUEUE_SIZE jobs in flight on one thread");
+	*job = (Job){ .function = function, .context = context, .counter = counter,
+		.dependency = dependency, .unfinished = true };
+	if (dependency && atomic_load(&dependency->pending) > 0) {
+		pthread_mutex_lock(&job_system.deferred_mutex);
+		job->next_deferred = job_system.deferred;
+		job_system.deferred = job;
+		atomic_fetch_add(&job_system.deferred_count, 1);
+		pthread_mutex_unlock(&job_system.deferred_mutex);
+
+		/*
+		 * [EN] The dependency may have finished before the job was listed, its last job then saw no
+		 * deferred jobs. Seen from here or from there, either side releases it.
+		 * [ES] La dependencia pudo terminar antes de que el trabajo se listara, su último trabajo
+		 * no vio trabajos diferidos entonces. Visto desde aquí o desde allá, algún lado lo libera.
+		 */
+		if (atomic_load(&dependency->pending) == 0) {
+			linuxJobReleaseDeferred();
+		}
+		return;
+	}
+	linuxJobSubmit(job);
+}
+
+void jobWait(JobCounter* counter)
+{
+	while (atomic_load_explicit(&counter->pending, memory_order_acquire) > 0) {
+		Job* job = job_system.started ? linuxJobFind(job_worker) : nullptr;
+		if (job) {
+			linuxJobExecute(job);
+		} else {
+			sched_yield();
+		}
+	}
+}
+
+/* 18/10/2026 - kanso engine */
@@ -4,21 +4,48 @@
 #include "../types.h"
 #include "../log.h"
 #include "../render.h"
+#include "../clock.h"
+#include "../hud.h"
+#include "../input_log.h"
+#include "../frame_capture.h"
+#include "../perf_counters.h"
+#include "../frame_timing.h"
+#include "../live_stats.h"
+#include "../thread.h"
+#include "../startup_timeline.h"
+#include "../pointer_motion.h"
+#include "../shm_blocks.h"
 
 // needed for wayland client's presentation
+#include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <time.h>
+#include <poll.h>
+#include <errno.h>
+
+// [EN] Not declared under _POSIX_C_SOURCE | [ES] No declarados bajo _POSIX_C_SOURCE
+int madvise(void* address, size_t length, int advice);
+#ifndef MADV_POPULATE_WRITE
+	#define MADV_POPULATE_WRITE 23 // linux 5.14
+#endif
 
 // needed for wayland client's input processing
 #include <linux/input-event-codes.h>
 
 #include <wayland-client.h>
+#include <wayland-cursor.h>
 #include "xdg_shell_client_protocol.h"
 #include "xdg_shell_protocol.c"
+#include "tearing_control_client_protocol.h"
+#include "tearing_control_protocol.c"
+#include "relative_pointer_client_protocol.h"
+#include "relative_pointer_protocol.c"
+#include "pointer_constraints_client_protocol.h"
+#include "pointer_constraints_protocol.c"
 
 #define MIN_WLCOMPOSITOR_VERSION 4 // 3 if not using HiDPI support, 1 if not needing screen rotation
 #define MAX_WLCOMPOSITOR_VERSION 6
@@ -28,11 +55,33 @@
 #define MAX_SEAT_VERSION 10
 #define MIN_XDGWMBASE_VERSION 5
 #define MAX_XDGWMBASE_VERSION 7
+#define MIN_SUBCOMPOSITOR_VERSION 1
+#define MAX_SUBCOMPOSITOR_VERSION 1
+#define MIN_TEARING_CONTROL_VERSION 1
+#define MAX_TEARING_CONTROL_VERSION 1
+#define MIN_RELATIVE_POINTER_VERSION 1
+#define MAX_RELATIVE_POINTER_VERSION 1
+#define MIN_POINTER_CONSTRAINTS_VERSION 1
+#define MAX_POINTER_CONSTRAINTS_VERSION 1
 
 #define STD_WIDTH 1280
 #define STD_HEIGHT 720
 #define BYTES_PER_PXL 4
 #define NUMBER_OF_BUFFERS 3
+#define MAX_WAKE_FDS 4 // other file descriptors the event loop waits on | otros descriptores
+#define EVENT_STATS_WINDOW NANOSECONDS_PER_SECOND
+#define CURSOR_DEFAULT_SIZE 24 // pixels, when XCURSOR_SIZE is not set | si XCURSOR_SIZE no existe
+#define CURSOR_NAME "left_ptr"
+#define CURSOR_FALLBACK_NAME "default" // newer themes | temas más nuevos
+#define LAYER_BUFFER_COUNT 2
+#define LAYER_DAMAGE_AREAS 16 // more grow the last one | más agrandan la última
+#define MAX_WINDOWS 4
+#define SHM_ARENA_INITIAL_SIZE (16 * 1024 * 1024) // the main window and its layers | y sus capas
+#define SHM_ARENA_MAX_SIZE (1024 * 1024 * 1024) // address space, not memory | no es memoria
+#define SHM_ARENA_RETIRED_BUFFERS (MAX_WINDOWS * (NUMBER_OF_BUFFERS + LAYER_BUFFER_COUNT))
+#define HUD_LAYER_REFRESH_INTERVAL (250 * NANOSECONDS_PER_MILLISECOND) // text must stay readable
+
+typedef struct WaylandState WaylandState;
 
 typedef struct {
 	struct wl_registry_listener wl_registry;
@@ -41,10 +90,33 @@ typedef struct {
 	struct xdg_surface_listener xdg_surface;
 	struct xdg_toplevel_listener xdg_toplevel;
 	struct wl_callback_listener wl_surface_frame_listener;
+	struct wl_callback_listener wl_cursor_frame_listener;
 	struct wl_seat_listener wl_seat;
 	struct wl_pointer_listener wl_pointer;
+	struct wl_keyboard_listener wl_keyboard;
+	struct wl_buffer_listener wl_buffer;
+	struct zwp_relative_pointer_v1_listener zwp_relative_pointer;
+	struct zwp_locked_pointer_v1_listener zwp_locked_pointer;
+	struct zwp_confined_pointer_v1_listener zwp_confined_pointer;
 } WaylandListeners;
 
+/*
+ * [EN] Client-side event handling cost, measured from the moment poll() wakes up until every queued
+ * event went through its listener. Rates and maximums cover the last complete window.
+ * [ES] Costo del manejo de eventos del lado del cliente, medido desde que poll() despierta hasta que
+ * cada evento acumulado pasó por su 'listener'. Tasas y máximos cubren la última ventana completa.
+ */
+typedef struct {
+	uint64 total_events;
+	uint64 window_start; // nanoseconds, clockNowNanoseconds()
+	uint32 window_events;
+	float32 window_max_dispatch_time;
+	float32 events_per_second;
+	float32 dispatch_time; // milliseconds, last wake up that handled events
+	float32 max_dispatch_time; // milliseconds
+	uint32 queue_depth; // events, last wake up that handled events | eventos del último despertar
+} WaylandEventStats;
+
 typedef struct {
 	struct wl_display* wl_display;
 	struct wl_registry* wl_registry;
@@ -52,111 +124,382 @@ typedef struct {
 	struct wl_seat* wl_seat;
 	struct xdg_wm_base* xdg_wm_base;
 	struct wl_shm* wl_shm;
+	struct wl_subcompositor* wl_subcompositor; // optional, nullptr without layers | opcional
+	// [EN] Optional, nullptr: every frame waits for vsync | [ES] Opcional, nullptr: espera a vsync
+	struct wp_tearing_control_manager_v1* wp_tearing_control_manager;
+	// [EN] Optional, nullptr: no raw motion | [ES] Opcional, nullptr: sin movimiento crudo
+	struct zwp_relative_pointer_manager_v1* zwp_relative_pointer_manager;
+	struct zwp_pointer_constraints_v1* zwp_pointer_constraints; // optional | opcional
 	WaylandListeners listeners;
+	WaylandEventStats events;
 } WaylandServerState;
 
+typedef struct WaylandShmArena WaylandShmArena;
+
 typedef struct {
 	int32 width;
 	int32 height;
 	int32 bytes_per_row; // stride
 	int32 size;
-	int32 fd;
-	struct wl_shm_pool* wl_shm_pool;
+	int32 offset; // inside the shm arena | dentro de la arena shm
+	void* memory; // nullptr when not allocated | nullptr cuando no está reservado
 	struct wl_buffer* wl_buffer;
+	WaylandShmArena* arena; // where memory comes from | de donde viene memory
+	bool8 busy; // attached and not released by the compositor yet | sin liberar aún
 } WaylandBuffer;
 
+/*
+ * [EN] One shm object and one wl_shm_pool shared by the buffers of every window and layer. The
+ * whole SHM_ARENA_MAX_SIZE is mapped up front, so the arena grows (ftruncate() and
+ * wl_shm_pool_resize()) without moving the buffers already handed out, blocks says where they
+ * are. A buffer given back while the compositor may still read it is retired: it keeps its
+ * wl_buffer and its block until wl_buffer.release, or the next buffer would draw over what's on
+ * screen.
+ * [ES] Un objeto shm y un wl_shm_pool compartidos por los 'buffers' de cada ventana y capa. Todo
+ * SHM_ARENA_MAX_SIZE se mapea desde el inicio, así la arena crece (ftruncate() y
+ * wl_shm_pool_resize()) sin mover los 'buffers' ya entregados, blocks dice dónde están. Un
+ * 'buffer' devuelto mientras el compositor aún puede leerlo se retira: conserva su wl_buffer y su
+ * bloque hasta wl_buffer.release, o el siguiente 'buffer' dibujaría sobre lo que está en pantalla.
+ */
+struct WaylandShmArena {
+	int32 fd;
+	uint8* memory; // SHM_ARENA_MAX_SIZE bytes reserved | bytes reservados
+	struct wl_shm_pool* wl_shm_pool; // nullptr until connected | nullptr hasta conectar
+	JobCounter prefault; // the initial size | el tamaño inicial
+	ShmBlocks blocks; // blocks.size bytes are backed by the shm object | respaldados
+	WaylandBuffer retired[SHM_ARENA_RETIRED_BUFFERS]; // nullptr wl_buffer: free | libre
+};
+
+typedef struct {
+	int32 x;
+	int32 y;
+	int32 width; // empty when <= 0 | vacío cuando <= 0
+	int32 height;
+} WaylandRectangle;
+
+/*
+ * [EN] Changed areas of a layer, kept apart so that two far ones don't become a rectangle holding
+ * everything between them. Past LAYER_DAMAGE_AREAS new ones grow the last.
+ * [ES] Áreas cambiadas de una capa, separadas para que dos lejanas no se vuelvan un rectángulo con
+ * todo lo que hay entre ellas. Después de LAYER_DAMAGE_AREAS las nuevas agrandan la última.
+ */
+typedef struct {
+	WaylandRectangle areas[LAYER_DAMAGE_AREAS];
+	int32 count;
+} WaylandDamage;
+
+/*
+ * [EN] Redraws at least areas of target, a premultiplied A:R:G:B bitmap the size of the layer.
+ * [ES] Redibuja al menos areas de target, un 'bitmap' A:R:G:B premultiplicado del tamaño de la
+ * capa.
+ */
+typedef void WaylandLayerRender(void* context, Bitmap* target, const WaylandRectangle* areas,
+		int32 area_count);
+
+/*
+ * [EN] A render layer on its own wl_subsurface over the main surface, with its own buffers and
+ * damage. Layers are only rendered and committed when something marked them dirty, the compositor
+ * composites them with whatever the main surface shows. Subsurfaces start in synchronized mode, a
+ * layer commit is applied together with the next commit of the main surface, so both always show
+ * the same frame. Each buffer remembers the areas that changed since it was last rendered (it may
+ * be two commits behind), only those are redrawn, and only the areas changed since the last commit
+ * are damaged.
+ * [ES] Una capa de dibujo en su propia wl_subsurface sobre la superficie principal, con sus propios
+ * 'buffers' y daño. Las capas sólo se dibujan y confirman cuando algo las marcó como sucias, el
+ * compositor las compone con lo que muestre la superficie principal. Las subsuperficies empiezan en
+ * modo sincronizado, una confirmación de la capa se aplica junto con la siguiente confirmación de
+ * la superficie principal, así ambas siempre muestran el mismo fotograma. Cada 'buffer' recuerda
+ * las áreas que cambiaron desde que se dibujó por última vez (puede ir dos confirmaciones atrás),
+ * sólo esas se redibujan, y sólo se dañan las áreas cambiadas desde la última confirmación.
+ */
+typedef struct {
+	struct wl_surface* wl_surface;
+	struct wl_subsurface* wl_subsurface;
+	WaylandBuffer buffers[LAYER_BUFFER_COUNT];
+	WaylandDamage stale[LAYER_BUFFER_COUNT]; // out of date areas of each buffer | desactualizadas
+	WaylandDamage damage; // changed since the last commit | cambió desde la última confirmación
+	WaylandLayerRender* render;
+	void* context;
+	bool8 visible;
+	bool8 mapped; // a buffer is attached | hay un 'buffer' asignado
+} WaylandLayer;
+
+/*
+ * [EN] The pointer image lives on its own wl_surface, set with wl_pointer_set_cursor(). The
+ * compositor composites it over the window, so pointer motion never needs a new frame of the main
+ * surface. The theme owns one shm pool with a buffer per image of each cursor loaded, images are
+ * only attached. Animated cursors advance from frame callbacks of the cursor surface.
+ * [ES] La imagen del puntero vive en su propia wl_surface, asignada con wl_pointer_set_cursor(). El
+ * compositor la compone sobre la ventana, así el movimiento del puntero nunca requiere un nuevo
+ * fotograma de la superficie principal. El tema es dueño de un 'pool' shm con un 'buffer' por
+ * imagen de cada cursor cargado, las imágenes sólo se asignan. Los cursores animados avanzan con
+ * los 'callbacks' de fotograma de la superficie del cursor.
+ */
+typedef struct {
+	struct wl_cursor_theme* theme;
+	struct wl_cursor* cursor;
+	struct wl_surface* wl_surface;
+	struct wl_callback* wl_callback; // pending frame of an animated cursor | fotograma pendiente
+	const struct wl_callback_listener* frame_listener;
+	int32 image_index; // attached image, -1 for none | imagen asignada, -1 para ninguna
+	uint64 animation_start; // nanoseconds, clockNowNanoseconds()
+} WaylandCursor;
+
+/*
+ * [EN] Pointer constraints for camera and drag control, requested per window. A locked pointer
+ * stays where it is and only reports relative motion, a confined one can't leave the window. The
+ * compositor activates a constraint while the window has the pointer focus and may refuse it,
+ * both keep the relative motion flowing.
+ * [ES] Restricciones del puntero para control de cámara y arrastre, pedidas por ventana. Un
+ * puntero bloqueado se queda donde está y sólo reporta movimiento relativo, uno confinado no puede
+ * salir de la ventana. El compositor activa una restricción mientras la ventana tiene el foco del
+ * puntero y puede rechazarla, ambas mantienen el flujo del movimiento relativo.
+ */
+typedef enum {
+	WAYLAND_POINTER_FREE,
+	WAYLAND_POINTER_LOCKED,
+	WAYLAND_POINTER_CONFINED,
+	WAYLAND_POINTER_CONSTRAINT_COUNT,
+} WaylandPointerConstraint;
+
+/*
+ * [EN] A toplevel window, it draws on its own schedule driven by the frame callbacks of its
+ * surface. Window listeners get the window as user data, and its wl_surface carries it too
+ * (wl_surface_get_user_data()), so seat events find the window they target.
+ * [ES] Una ventana de nivel superior, dibuja a su propio ritmo guiado por los 'callbacks' de
+ * fotograma de su superficie. Los 'listeners' de la ventana reciben la ventana como datos de
+ * usuario, y su wl_surface también la lleva (wl_surface_get_user_data()), así los eventos del
+ * asiento encuentran la ventana a la que van dirigidos.
+ */
 typedef struct {
+	WaylandState* state;
 	struct wl_surface* wl_surface;
 	struct xdg_surface* xdg_surface;
 	struct xdg_toplevel* xdg_toplevel;
 	struct wl_callback* wl_surface_frame;
-	struct wl_keyboard* wl_keyboard;
-	struct wl_pointer* wl_pointer;
+	struct wp_tearing_control_v1* wp_tearing_control; // nullptr: vsync paced | al ritmo de vsync
 	WaylandBuffer buffers[NUMBER_OF_BUFFERS];
 	int32 last_rendered_buffer_index; // ready to be shown on screen | listo para presentarse en pantalla
 	int32 active_buffer_index;
-	uint32 animation_speed;
+	uint64 last_frame_time; // nanoseconds, clockNowNanoseconds()
+	float32 frame_time; // milliseconds, between the last two presents | entre las dos últimas
+	float32 render_time; // milliseconds
+	FramePacer pacer;
+	uint64 frame_sample_time; // nanoseconds, the ready frame sampled the state | lectura del estado
+	float32 presentation_latency; // milliseconds, sampling to attach | de la lectura al 'attach'
+	bool8 frame_ready; // rendered and not attached yet | dibujado y aún sin 'attach'
+	bool8 mapped; // a buffer was committed | se confirmó un 'buffer'
+	bool8 configured; // the first configure was acked | se respondió la primera configuración
+	bool8 open;
+	Hud hud;
+	WaylandLayer hud_layer; // without a subcompositor the HUD is drawn into every frame | sin capa
+	uint64 hud_layer_draw_time; // nanoseconds, clockNowNanoseconds()
+	WaylandPointerConstraint pointer_constraint; // requested | pedida
+	struct zwp_locked_pointer_v1* zwp_locked_pointer;
+	struct zwp_confined_pointer_v1* zwp_confined_pointer;
+	bool8 pointer_constraint_active; // applied by the compositor | aplicada por el compositor
+	PointerMotion pointer_motion; // adding up, while the window has the pointer focus | con foco
+	PointerMotion frame_pointer_motion; // taken when the last frame started rendering | al dibujar
+} WaylandWindow;
+
+/*
+ * [EN] windows[0] is the main window: closing it ends the program, and it drives the capture, the
+ * performance counters and the live stats.
+ * [ES] windows[0] es la ventana principal: cerrarla termina el programa, y guía la captura, los
+ * contadores de rendimiento y las estadísticas en vivo.
+ */
+typedef struct {
+	struct wl_keyboard* wl_keyboard;
+	struct wl_pointer* wl_pointer;
+	struct zwp_relative_pointer_v1* zwp_relative_pointer; // nullptr without the protocol
+	WaylandCursor cursor;
+	WaylandShmArena shm_arena;
+	WaylandWindow windows[MAX_WINDOWS]; // closed windows free their slot | liberan su ranura
+	WaylandWindow* pointer_focus; // nullptr when outside every window | fuera de toda ventana
+	WaylandWindow* keyboard_focus;
+	uint32 animation_speed; // gradient offset per simulation tick | desplazamiento por paso
+	int32 gradient_offset;
+	int32 previous_gradient_offset; // one tick behind, for interpolation | un paso atrás
+	uint32 frame_index; // frames rendered by the main window | dibujados por la ventana principal
+	uint32 last_input_time; // compositor milliseconds | milisegundos del compositor
+	InputEvent relative_motion; // first half, until the unaccelerated one | primera mitad
+	uint64 relative_motion_time; // microseconds, rebuilt from the logged bits | reconstruidos
+	InputRecorder* input_recorder; // optional | opcional
+	InputReplay* input_replay; // optional, live input is ignored until it ends | opcional
+	FrameCapture* frame_capture; // optional, gets every presented frame | opcional
+	PerfCounters* perf_counters; // optional, sampled at every frame boundary | opcional
+	PerfFrameStats perf_stats; // previous frame | fotograma anterior
+	LiveStatsPage* live_stats; // optional, published every frame | opcional
+	StartupTimeline* startup; // optional, milestones of the main window | opcional
+	uint64 replay_start; // nanoseconds, clockNowNanoseconds(), once replay_started
+	bool8 replay_started;
+	bool8 tearing; // asked for, set before waylandClientInitialize() | pedido, antes de iniciar
 	bool8 running;
 } WaylandClientState;
 
-typedef struct {
+struct WaylandState {
 	WaylandServerState server;
 	WaylandClientState client;
-} WaylandState;
+};
 
 /*
- * [EN] Takes a null-character terminated string and replaces every occurrence of the
- * char_to_replace in the string with a letter from 'A' to 'P' or 'a' to 'p'.
- * [ES] Toma un string finalizado con el caracter nulo y reemplaza cada aparición del caracter
- * char_to_replace por una letra desde 'A' hasta 'P', o bien, desde 'a' hasta 'p'.
+ * [EN] Faults in the pages of [offset, offset + size) before anything draws there, so frame 0
+ * doesn't pay for them. MADV_POPULATE_WRITE does it in one call, older kernels get a write per
+ * page, which is only valid on memory no buffer holds yet.
+ * [ES] Provoca las fallas de las páginas de [offset, offset + size) antes de que algo dibuje ahí,
+ * así el fotograma 0 no las paga. MADV_POPULATE_WRITE lo hace en una llamada, los núcleos más
+ * viejos reciben una escritura por página, lo que sólo es válido en memoria que ningún 'buffer'
+ * tiene aún.
  */
-[[nodiscard]] internal bool8 linuxRandomizeCharacterInString(char string[], char char_to_replace)
+internal void waylandShmArenaPrefault(WaylandShmArena* arena, int64 offset, int64 size)
 {
-	struct timespec time;
-	uint64 random = 0;
-	for (char* c = string; *c != '\0'; ++c) {
-		if (random <= 0b0010'0000) {
-			if (clock_gettime(CLOCK_REALTIME, &time) < 0) {
-				logWarn("Linux platform: couldn't get time from clock_gettime().");
-				return false;
-			} else {
-				random = time.tv_nsec * time.tv_nsec;
-			}
-		}
-		if (*c == char_to_replace) {
-			*c = 'A' + (0b0010'0000 & random) + (0b0000'1111 & random); // A-P o a-p
-			random >>= 5;
-		}
+	uint8* memory = arena->memory + offset;
+	if (madvise(memory, (uint64)size, MADV_POPULATE_WRITE) == 0) {
+		return;
+	}
+	int64 page_size = sysconf(_SC_PAGESIZE);
+	for (int64 i = 0; i < size; i += page_size) {
+		((volatile uint8*)memory)[i] = 0;
+	}
+}
+
+internal void waylandShmArenaPrefaultJob(void* context)
+{
+	WaylandShmArena* arena = context;
+	waylandShmArenaPrefault(arena, 0, arena->blocks.size);
+}
+
+/*
+ * [EN] Needs no compositor: maps the arena and prefaults its initial size on the job system, both
+ * overlap the registry roundtrip. MAP_POPULATE is no option, most of the mapping lies past the end
+ * of the object. waylandShmArenaConnect() creates the pool once wl_shm is bound.
+ * [ES] No necesita compositor: mapea la arena y prefalla su tamaño inicial en el sistema de
+ * trabajos, ambos se traslapan con el 'roundtrip' del registro. MAP_POPULATE no es opción, casi
+ * todo el mapeo queda más allá del final del objeto. waylandShmArenaConnect() crea el 'pool' una
+ * vez vinculado wl_shm.
+ */
+[[nodiscard]] internal bool8 waylandShmArenaCreate(WaylandShmArena* arena)
+{
+	*arena = (WaylandShmArena){ .fd = -1 };
+	if (!linuxCreateShmObject(SHM_ARENA_INITIAL_SIZE, &arena->fd)) {
+		logFatal("Failed to open a POSIX shared memory object for pixel buffer allocation.");
+		return false;
+	}
+	// [EN] Pages past the end of the object are never touched | [ES] Nunca se tocan
+	void* memory = mmap(nullptr, SHM_ARENA_MAX_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED,
+			arena->fd, 0);
+	if (memory == MAP_FAILED) {
+		logFatal("Failed to map the pixel buffer arena.");
+		close(arena->fd);
+		arena->fd = -1;
+		return false;
 	}
+	arena->memory = memory;
+	arena->blocks = (ShmBlocks){ .size = SHM_ARENA_INITIAL_SIZE, .max_size = SHM_ARENA_MAX_SIZE };
+	jobRun(waylandShmArenaPrefaultJob, arena, &arena->prefault);
 	return true;
 }
 
+internal void waylandShmArenaConnect(WaylandShmArena* arena, struct wl_shm* wl_shm)
+{
+	jobWait(&arena->prefault);
+	arena->wl_shm_pool = wl_shm_create_pool(wl_shm, arena->fd, arena->blocks.size);
+}
 
-// TODO(vluis): Move to platform_linux.c
-[[nodiscard]] bool8 linuxCreateShmObject(int64 size, int32* fd)
+internal void waylandShmArenaDestroy(WaylandShmArena* arena)
 {
-	int32 retries = 16; // number of times the shm_open operation could fail before it stops trying
-	char shm_name[] = "/kanso_shm_$$$$";
-	while (retries > 0) {
-		if (!linuxRandomizeCharacterInString(shm_name, '$')) {
-			retries--;
-			continue;
-		}
-		*fd = shm_open(shm_name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
-		if (*fd >= 0) { // valid
-			break;
+	jobWait(&arena->prefault);
+	for (int32 i = 0; i < SHM_ARENA_RETIRED_BUFFERS; ++i) {
+		if (arena->retired[i].wl_buffer) {
+			wl_buffer_destroy(arena->retired[i].wl_buffer);
 		}
-		char* name = shm_name;
-		name = "/kanso_shm_$$$$";
-		retries--;
-	};
+	}
+	if (arena->wl_shm_pool) {
+		wl_shm_pool_destroy(arena->wl_shm_pool);
+	}
+	if (arena->memory) {
+		munmap(arena->memory, SHM_ARENA_MAX_SIZE);
+	}
+	if (arena->fd >= 0) {
+		close(arena->fd);
+	}
+	*arena = (WaylandShmArena){ .fd = -1 };
+}
 
-	if (*fd < 0) {
-		// TODO(vluis): is errno available? log it?
+[[nodiscard]] internal bool8 waylandShmArenaAllocate(WaylandShmArena* arena, int32 size,
+		int32* offset)
+{
+	if (!shmBlocksAllocate(&arena->blocks, size, offset)) {
 		return false;
 	}
-	shm_unlink(shm_name);
-	ftruncate(*fd, size);
-
+	int32 end = shmBlocksEnd(&arena->blocks);
+	if (end > arena->blocks.size) { // only the gap after the last block can grow | sólo el último
+		int32 new_size = shmBlocksGrowSize(&arena->blocks, end);
+		if (ftruncate(arena->fd, new_size) < 0) {
+			logError("Failed to grow the shm arena (%s).", strerror(errno));
+			shmBlocksFree(&arena->blocks, *offset);
+			return false;
+		}
+		wl_shm_pool_resize(arena->wl_shm_pool, new_size); // pools only grow | sólo crecen
+		waylandShmArenaPrefault(arena, arena->blocks.size, new_size - arena->blocks.size);
+		arena->blocks.size = new_size;
+	}
 	return true;
 }
 
-[[nodiscard]] internal bool8 waylandSetUpBuffer(WaylandBuffer* buffer, int32 new_width,
-		int32 new_height, struct wl_shm* wl_shm)
+/*
+ * [EN] Gives the block of every retired buffer the compositor released back to the arena.
+ * [ES] Devuelve a la arena el bloque de cada 'buffer' retirado que el compositor liberó.
+ */
+internal void waylandShmArenaCollect(WaylandShmArena* arena)
+{
+	for (int32 i = 0; i < SHM_ARENA_RETIRED_BUFFERS; ++i) {
+		WaylandBuffer* retired = &arena->retired[i];
+		if (retired->wl_buffer && !retired->busy) {
+			wl_buffer_destroy(retired->wl_buffer);
+			shmBlocksFree(&arena->blocks, retired->offset);
+			*retired = (WaylandBuffer){ 0 };
+		}
+	}
+}
+
+internal void waylandReleaseBuffer(WaylandBuffer* buffer, WaylandShmArena* arena)
 {
-	/* cleanup | limpieza */
+	if (buffer->wl_buffer && buffer->busy) {
+		WaylandBuffer* retired = nullptr;
+		for (int32 i = 0; i < SHM_ARENA_RETIRED_BUFFERS && !retired; ++i) {
+			retired = arena->retired[i].wl_buffer ? nullptr : &arena->retired[i];
+		}
+		if (retired) {
+			*retired = *buffer;
+			wl_buffer_set_user_data(retired->wl_buffer, retired); // release finds it | lo encuentra
+			buffer->wl_buffer = nullptr;
+			buffer->memory = nullptr;
+			buffer->busy = false;
+			return;
+		}
+		logWarn("No room to retire a busy buffer, its memory is reused at once.");
+	}
 	if (buffer->wl_buffer) {
 		wl_buffer_destroy(buffer->wl_buffer);
 		buffer->wl_buffer = nullptr;
+		buffer->busy = false;
 	}
-	if (buffer->wl_shm_pool) {
-		wl_shm_pool_destroy(buffer->wl_shm_pool);
-		buffer->wl_shm_pool = nullptr;
-	}
-	if (buffer->fd >= 0) {
-		close(buffer->fd);
-		buffer->fd = -1;
+	if (buffer->memory) {
+		shmBlocksFree(&arena->blocks, buffer->offset);
+		buffer->memory = nullptr;
 	}
+}
+
+/*
+ * [EN] pxl_format is a WL_SHM_FORMAT_*, 4 bytes per pixel.
+ * [ES] pxl_format es un WL_SHM_FORMAT_*, 4 bytes por píxel.
+ */
+[[nodiscard]] internal bool8 waylandSetUpBuffer(WaylandBuffer* buffer, int32 new_width,
+		int32 new_height, uint32 pxl_format, WaylandShmArena* arena,
+		const struct wl_buffer_listener* listener)
+{
+	waylandReleaseBuffer(buffer, arena); // cleanup | limpieza
 
 	/* construction | construcción */
 	if (new_width == 0 || new_height == 0) {
@@ -168,17 +511,337 @@ typedef struct {
 	}
 	buffer->bytes_per_row = buffer->width * BYTES_PER_PXL; // stride (in bytes)
 	buffer->size = buffer->bytes_per_row * buffer->height; // pixel buffer size (in bytes)
-	if (!linuxCreateShmObject(buffer->size, &buffer->fd)) {
-		logFatal("Failed to open a POSIX shared memory object for pixel buffer allocation.");
+	if (!waylandShmArenaAllocate(arena, buffer->size, &buffer->offset)) {
+		logFatal("Failed to allocate a pixel buffer from the shm arena.");
 		return false;
 	}
-	buffer->wl_shm_pool = wl_shm_create_pool(wl_shm, buffer->fd, buffer->size);
-	buffer->wl_buffer = wl_shm_pool_create_buffer(buffer->wl_shm_pool, 0, buffer->width,
-			buffer->height, buffer->bytes_per_row, WL_SHM_FORMAT_XRGB8888);
+	buffer->memory = arena->memory + buffer->offset;
+	buffer->arena = arena;
+	buffer->wl_buffer = wl_shm_pool_create_buffer(arena->wl_shm_pool, buffer->offset,
+			buffer->width, buffer->height, buffer->bytes_per_row, pxl_format);
+	wl_buffer_add_listener(buffer->wl_buffer, listener, buffer);
 
 	return true;
 }
 
+/*
+ * [EN] Smallest rectangle that holds both, empty rectangles are ignored.
+ * [ES] El rectángulo más pequeño que contiene a ambos, los rectángulos vacíos se ignoran.
+ */
+internal WaylandRectangle waylandRectangleUnion(WaylandRectangle a, WaylandRectangle b)
+{
+	if (a.width <= 0 || a.height <= 0) {
+		return b;
+	} else if (b.width <= 0 || b.height <= 0) {
+		return a;
+	}
+	int32 left = (a.x < b.x) ? a.x : b.x;
+	int32 top = (a.y < b.y) ? a.y : b.y;
+	int32 right = (a.x + a.width > b.x + b.width) ? a.x + a.width : b.x + b.width;
+	int32 bottom = (a.y + a.height > b.y + b.height) ? a.y + a.height : b.y + b.height;
+	return (WaylandRectangle){ left, top, right - left, bottom - top };
+}
+
+internal void waylandDamageAdd(WaylandDamage* damage, WaylandRectangle area)
+{
+	if (area.width <= 0 || area.height <= 0) {
+		return;
+	} else if (damage->count < LAYER_DAMAGE_AREAS) {
+		damage->areas[damage->count++] = area;
+	} else {
+		damage->areas[LAYER_DAMAGE_AREAS - 1] =
+			waylandRectangleUnion(damage->areas[LAYER_DAMAGE_AREAS - 1], area);
+	}
+}
+
+internal void waylandLayerMarkDirty(WaylandLayer* layer, WaylandRectangle area)
+{
+	waylandDamageAdd(&layer->damage, area);
+	for (int32 i = 0; i < LAYER_BUFFER_COUNT; ++i) {
+		waylandDamageAdd(&layer->stale[i], area);
+	}
+}
+
+/*
+ * [EN] One area covering the layer replaces whatever was there.
+ * [ES] Un área que cubre la capa reemplaza lo que hubiera.
+ */
+internal void waylandLayerMarkAllDirty(WaylandLayer* layer)
+{
+	WaylandDamage all = { .areas = { { 0, 0, layer->buffers[0].width, layer->buffers[0].height } },
+		.count = 1 };
+	layer->damage = all;
+	for (int32 i = 0; i < LAYER_BUFFER_COUNT; ++i) {
+		layer->stale[i] = all;
+	}
+}
+
+internal void waylandLayerDestroy(WaylandLayer* layer, WaylandShmArena* arena)
+{
+	if (!layer->wl_surface) {
+		return; // never created | nunca creada
+	}
+	if (layer->wl_subsurface) {
+		wl_subsurface_destroy(layer->wl_subsurface);
+	}
+	wl_surface_destroy(layer->wl_surface);
+	for (int32 i = 0; i < LAYER_BUFFER_COUNT; ++i) {
+		waylandReleaseBuffer(&layer->buffers[i], arena);
+	}
+	*layer = (WaylandLayer){ 0 };
+}
+
+/*
+ * [EN] Creates a hidden layer of width x height pixels with its top-left corner at (x, y) of the
+ * parent surface. The layer takes no input, pointer events keep going to the parent.
+ * [ES] Crea una capa oculta de width x height píxeles con su esquina superior izquierda en (x, y)
+ * de la superficie padre. La capa no recibe entrada, los eventos del puntero siguen yendo al padre.
+ */
+[[nodiscard]] internal bool8 waylandLayerCreate(WaylandLayer* layer, WaylandServerState* server,
+		WaylandShmArena* arena, struct wl_surface* parent, WaylandRectangle area,
+		WaylandLayerRender* render, void* context)
+{
+	*layer = (WaylandLayer){ .render = render, .context = context };
+	layer->wl_surface = wl_compositor_create_surface(server->wl_compositor);
+	layer->wl_subsurface = wl_subcompositor_get_subsurface(server->wl_subcompositor,
+			layer->wl_surface, parent);
+	wl_subsurface_set_position(layer->wl_subsurface, area.x, area.y);
+	struct wl_region* input_region = wl_compositor_create_region(server->wl_compositor);
+	wl_surface_set_input_region(layer->wl_surface, input_region); // empty | vacía
+	wl_region_destroy(input_region);
+
+	for (int32 i = 0; i < LAYER_BUFFER_COUNT; ++i) {
+		if (!waylandSetUpBuffer(&layer->buffers[i], area.width, area.height,
+					WL_SHM_FORMAT_ARGB8888, arena, &server->listeners.wl_buffer)) {
+			waylandLayerDestroy(layer, arena);
+			return false;
+		}
+	}
+	waylandLayerMarkAllDirty(layer);
+	return true;
+}
+
+internal void waylandLayerSetVisible(WaylandLayer* layer, bool8 visible)
+{
+	if (visible && !layer->visible) {
+		waylandLayerMarkAllDirty(layer); // contents got old while hidden | envejeció oculta
+	}
+	layer->visible = visible;
+}
+
+/*
+ * [EN] Renders and commits the layer when it is dirty, or unmaps it when it got hidden. When the
+ * compositor still holds every buffer the layer stays dirty and is tried again next frame.
+ * [ES] Dibuja y confirma la capa cuando está sucia, o la desasigna cuando se ocultó. Cuando el
+ * compositor aún tiene todos los 'buffers' la capa sigue sucia y se reintenta el siguiente
+ * fotograma.
+ */
+internal void waylandLayerUpdate(WaylandLayer* layer)
+{
+	if (!layer->visible) {
+		if (layer->mapped) {
+			wl_surface_attach(layer->wl_surface, nullptr, 0, 0);
+			wl_surface_commit(layer->wl_surface);
+			layer->mapped = false;
+		}
+		return;
+	}
+	if (layer->damage.count == 0) {
+		return;
+	}
+	int32 index = 0;
+	while (index < LAYER_BUFFER_COUNT && layer->buffers[index].busy) {
+		index++;
+	}
+	if (index == LAYER_BUFFER_COUNT) {
+		return;
+	}
+
+	WaylandBuffer* buffer = &layer->buffers[index];
+	Bitmap target = { .memory = buffer->memory, .width = buffer->width, .height = buffer->height,
+		.bytes_per_row = buffer->bytes_per_row };
+	layer->render(layer->context, &target, layer->stale[index].areas, layer->stale[index].count);
+	layer->stale[index].count = 0;
+
+	wl_surface_attach(layer->wl_surface, buffer->wl_buffer, 0, 0);
+	buffer->busy = true;
+	for (int32 i = 0; i < layer->damage.count; ++i) {
+		const WaylandRectangle* area = &layer->damage.areas[i];
+		wl_surface_damage_buffer(layer->wl_surface, area->x, area->y, area->width, area->height);
+	}
+	wl_surface_commit(layer->wl_surface); // applied with the parent | se aplica con el padre
+	layer->damage.count = 0;
+	layer->mapped = true;
+}
+
+/*
+ * [EN] Only areas are redrawn, from the lines of the last hudUpdateLayer().
+ * [ES] Sólo se redibujan areas, a partir de las líneas del último hudUpdateLayer().
+ */
+internal void waylandHudLayerRender(void* context, Bitmap* target, const WaylandRectangle* areas,
+		int32 area_count)
+{
+	WaylandWindow* window = context;
+	HudRectangle hud_areas[LAYER_DAMAGE_AREAS];
+	for (int32 i = 0; i < area_count; ++i) {
+		hud_areas[i] = (HudRectangle){ areas[i].x, areas[i].y, areas[i].width, areas[i].height };
+	}
+	hudDrawLayer(&window->hud, target, hud_areas, area_count);
+}
+
+/*
+ * [EN] Opens a window in a free slot, nullptr when every slot is taken. Its buffers get the default
+ * size right away, so frame 0 renders while the first configure is on the way; a configure with
+ * another size sets them up again. With client->tearing the main window hints async presentation:
+ * frames are committed as soon as they are rendered instead of at the next frame callback, and the
+ * compositor may flip mid scanout. Compositors usually honor the hint only for fullscreen windows,
+ * otherwise they keep presenting at vsync. Without the protocol the window stays vsync paced.
+ * [ES] Abre una ventana en una ranura libre, nullptr cuando todas están ocupadas. Sus 'buffers'
+ * reciben el tamaño predeterminado de inmediato, así el fotograma 0 se dibuja mientras la primera
+ * configuración va en camino; una configuración con otro tamaño los prepara de nuevo. Con
+ * client->tearing la ventana principal sugiere presentación asíncrona: los fotogramas se confirman
+ * en cuanto se dibujan en vez de en el siguiente 'callback' de fotograma, y el compositor puede
+ * cambiar de 'buffer' a mitad del barrido. Los compositores suelen respetar la sugerencia sólo en
+ * ventanas a pantalla completa, si no siguen presentando en vsync. Sin el protocolo la ventana
+ * sigue al ritmo de vsync.
+ */
+internal WaylandWindow* waylandWindowOpen(WaylandState* state, const char* title)
+{
+	WaylandServerState* server = &state->server;
+	WaylandClientState* client = &state->client;
+	WaylandWindow* window = nullptr;
+	for (int32 i = 0; i < MAX_WINDOWS && !window; ++i) {
+		window = client->windows[i].open ? nullptr : &client->windows[i];
+	}
+	if (!window) {
+		logError("Can't open the window \"%s\", %d windows are open already.", title, MAX_WINDOWS);
+		return nullptr;
+	}
+
+	*window = (WaylandWindow){ .state = state, .open = true, .active_buffer_index = -1 };
+	for (int32 i = 0; i < NUMBER_OF_BUFFERS; ++i) {
+		if (!waylandSetUpBuffer(&window->buffers[i], STD_WIDTH, STD_HEIGHT,
+					WL_SHM_FORMAT_XRGB8888, &client->shm_arena, &server->listeners.wl_buffer)) {
+			for (int32 j = 0; j < i; ++j) {
+				waylandReleaseBuffer(&window->buffers[j], &client->shm_arena);
+			}
+			*window = (WaylandWindow){ 0 };
+			return nullptr;
+		}
+	}
+	framePacerInitialize(&window->pacer);
+	if (!hudInitialize(&window->hud)) {
+		logWarn("Failed to initialize the performance HUD, it won't be available.");
+	}
+
+	window->wl_surface = wl_compositor_create_surface(server->wl_compositor);
+	wl_surface_set_user_data(window->wl_surface, window);
+	window->xdg_surface = xdg_wm_base_get_xdg_surface(server->xdg_wm_base, window->wl_surface);
+	xdg_surface_add_listener(window->xdg_surface, &server->listeners.xdg_surface, window);
+	window->xdg_toplevel = xdg_surface_get_toplevel(window->xdg_surface);
+	xdg_toplevel_add_listener(window->xdg_toplevel, &server->listeners.xdg_toplevel, window);
+	xdg_toplevel_set_title(window->xdg_toplevel, title);
+	if (server->wl_subcompositor && window->hud.initialized) {
+		WaylandRectangle area = { 0 };
+		hudLayerSize(&window->hud, &area.width, &area.height);
+		if (!waylandLayerCreate(&window->hud_layer, server, &client->shm_arena,
+					window->wl_surface, area, waylandHudLayerRender, window)) {
+			logWarn("Failed to create the HUD layer, the HUD will be drawn into every frame.");
+		}
+	}
+	bool8 tearing = client->tearing && window == &client->windows[0];
+	if (tearing && server->wp_tearing_control_manager) {
+		window->wp_tearing_control = wp_tearing_control_manager_v1_get_tearing_control(
+				server->wp_tearing_control_manager, window->wl_surface);
+		wp_tearing_control_v1_set_presentation_hint(window->wp_tearing_control,
+				WP_TEARING_CONTROL_V1_PRESENTATION_HINT_ASYNC);
+		logInfo("The window \"%s\" presents frames as soon as they are rendered.", title);
+	} else if (tearing) {
+		logWarn("The compositor doesn't support tearing control, the window \"%s\" stays vsync "
+				"paced.", title);
+	}
+	window->wl_surface_frame = wl_surface_frame(window->wl_surface);
+	wl_callback_add_listener(window->wl_surface_frame, &server->listeners.wl_surface_frame_listener,
+			window);
+	wl_surface_commit(window->wl_surface);
+	return window;
+}
+
+/*
+ * [EN] Replaces the pointer constraint of window. The constraint is persistent: the compositor
+ * applies it again every time the window gets the pointer focus back, until another one replaces
+ * it. Without the protocol or a pointer the window stays free.
+ * [ES] Reemplaza la restricción del puntero de window. La restricción es persistente: el
+ * compositor la aplica de nuevo cada vez que la ventana recupera el foco del puntero, hasta que
+ * otra la reemplace. Sin el protocolo o un puntero la ventana queda libre.
+ */
+internal void waylandWindowConstrainPointer(WaylandWindow* window,
+		WaylandPointerConstraint constraint)
+{
+	WaylandServerState* server = &window->state->server;
+	WaylandClientState* client = &window->state->client;
+	if (window->zwp_locked_pointer) {
+		zwp_locked_pointer_v1_destroy(window->zwp_locked_pointer);
+		window->zwp_locked_pointer = nullptr;
+	}
+	if (window->zwp_confined_pointer) {
+		zwp_confined_pointer_v1_destroy(window->zwp_confined_pointer);
+		window->zwp_confined_pointer = nullptr;
+	}
+	window->pointer_constraint = WAYLAND_POINTER_FREE;
+	window->pointer_constraint_active = false;
+	if (constraint == WAYLAND_POINTER_FREE) {
+		return;
+	}
+	if (!server->zwp_pointer_constraints || !client->wl_pointer) {
+		logWarn("The compositor doesn't support pointer constraints, the pointer stays free.");
+		return;
+	}
+
+	// [EN] nullptr region: the whole surface | [ES] Región nullptr: toda la superficie
+	if (constraint == WAYLAND_POINTER_LOCKED) {
+		window->zwp_locked_pointer = zwp_pointer_constraints_v1_lock_pointer(
+				server->zwp_pointer_constraints, window->wl_surface, client->wl_pointer, nullptr,
+				ZWP_POINTER_CONSTRAINTS_V1_LIFETIME_PERSISTENT);
+		zwp_locked_pointer_v1_add_listener(window->zwp_locked_pointer,
+				&server->listeners.zwp_locked_pointer, window);
+	} else {
+		window->zwp_confined_pointer = zwp_pointer_constraints_v1_confine_pointer(
+				server->zwp_pointer_constraints, window->wl_surface, client->wl_pointer, nullptr,
+				ZWP_POINTER_CONSTRAINTS_V1_LIFETIME_PERSISTENT);
+		zwp_confined_pointer_v1_add_listener(window->zwp_confined_pointer,
+				&server->listeners.zwp_confined_pointer, window);
+	}
+	window->pointer_constraint = constraint;
+}
+
+internal void waylandWindowClose(WaylandWindow* window)
+{
+	WaylandClientState* client = &window->state->client;
+	if (client->pointer_focus == window) {
+		client->pointer_focus = nullptr;
+	}
+	if (client->keyboard_focus == window) {
+		client->keyboard_focus = nullptr;
+	}
+	if (window->wl_surface_frame) {
+		wl_callback_destroy(window->wl_surface_frame);
+	}
+	waylandLayerDestroy(&window->hud_layer, &client->shm_arena);
+	waylandWindowConstrainPointer(window, WAYLAND_POINTER_FREE);
+	if (window->wp_tearing_control) {
+		wp_tearing_control_v1_destroy(window->wp_tearing_control);
+	}
+	xdg_toplevel_destroy(window->xdg_toplevel);
+	xdg_surface_destroy(window->xdg_surface);
+	wl_surface_destroy(window->wl_surface);
+	for (int32 i = 0; i < NUMBER_OF_BUFFERS; ++i) {
+		waylandReleaseBuffer(&window->buffers[i], &client->shm_arena);
+	}
+	hudDestroy(&window->hud);
+	*window = (WaylandWindow){ 0 };
+}
+
 /*
  * [EN] Guarantees the successful binding to the requested global object, otherwise it will abort()
  * the program.
@@ -243,6 +906,32 @@ internal void waylandRegistryEventGlobal(void* data, struct wl_registry* registr
 		xdg_wm_base_add_listener(server->xdg_wm_base, &server->listeners.xdg_wm_base, nullptr);
 		logInfo("Successful bind to the wayland global object %s", interface_name);
 	}
+	else if (!strcmp(wl_subcompositor_interface.name, interface_name)) {
+		server->wl_subcompositor = waylandBindToGlobalObject(server->wl_display,
+				server->wl_registry, &wl_subcompositor_interface, object_name, interface_version,
+				MIN_SUBCOMPOSITOR_VERSION, MAX_SUBCOMPOSITOR_VERSION);
+		logInfo("Successful bind to the wayland global object %s", interface_name);
+	}
+	else if (!strcmp(wp_tearing_control_manager_v1_interface.name, interface_name)
+			&& client->tearing) {
+		server->wp_tearing_control_manager = waylandBindToGlobalObject(server->wl_display,
+				server->wl_registry, &wp_tearing_control_manager_v1_interface, object_name,
+				interface_version, MIN_TEARING_CONTROL_VERSION, MAX_TEARING_CONTROL_VERSION);
+		logInfo("Successful bind to the wayland global object %s", interface_name);
+	}
+	else if (!strcmp(zwp_relative_pointer_manager_v1_interface.name, interface_name)) {
+		server->zwp_relative_pointer_manager = waylandBindToGlobalObject(server->wl_display,
+				server->wl_registry, &zwp_relative_pointer_manager_v1_interface, object_name,
+				interface_version, MIN_RELATIVE_POINTER_VERSION, MAX_RELATIVE_POINTER_VERSION);
+		logInfo("Successful bind to the wayland global object %s", interface_name);
+	}
+	else if (!strcmp(zwp_pointer_constraints_v1_interface.name, interface_name)) {
+		server->zwp_pointer_constraints = waylandBindToGlobalObject(server->wl_display,
+				server->wl_registry, &zwp_pointer_constraints_v1_interface, object_name,
+				interface_version, MIN_POINTER_CONSTRAINTS_VERSION,
+				MAX_POINTER_CONSTRAINTS_VERSION);
+		logInfo("Successful bind to the wayland global object %s", interface_name);
+	}
 }
 
 /*
@@ -281,6 +970,8 @@ internal void waylandXdgWmBaseEventPing(void *data, struct xdg_wm_base* xdg_wm_b
 	xdg_wm_base_pong(xdg_wm_base, serial);
 }
 
+internal void waylandWindowPresent(WaylandWindow* window, uint64 now);
+
 /*
  * [EN] The xdg_surface global object issues the final configuration event for a surface.
  * [ES] El objeto global xdg_surface expide el evento final de configuración para una superficie.
@@ -288,26 +979,33 @@ internal void waylandXdgWmBaseEventPing(void *data, struct xdg_wm_base* xdg_wm_b
 internal void waylandXdgSurfaceEventConfigure(void* data, struct xdg_surface* xdg_surface,
 		uint32 serial)
 {
-	persist bool8 first_call_done = false;
-
-	WaylandState* wayland_state = data;
-	WaylandServerState* server = &wayland_state->server;
-	WaylandClientState* client = &wayland_state->client;
+	WaylandWindow* window = data;
 
 	xdg_surface_ack_configure(xdg_surface, serial);
 
-	if (first_call_done) {
-		wl_surface_commit(client->wl_surface);
+	if (window->configured) {
+		wl_surface_commit(window->wl_surface);
 		return;
 	}
 
-	// [EN] The following code only gets executed on the first call to the function 
-	// [ES] El siguiente código únicamiente se ejecutará en la primer llamada a la función
-	client->active_buffer_index = 0;
-	WaylandBuffer* buffer = &client->buffers[client->active_buffer_index];
-	wl_surface_attach(client->wl_surface, buffer->wl_buffer, 0, 0);
-	wl_surface_commit(client->wl_surface);
-	first_call_done = true;
+	// [EN] The following code only gets executed on the first configure of the window, frame 0 is
+	// usually rendered by now. Unless the configure changed the size: the buffers were reallocated,
+	// nothing is attached and the next frame is presented as soon as it's rendered.
+	// [ES] El siguiente código únicamente se ejecutará en la primer configuración de la ventana, el
+	// fotograma 0 normalmente ya está dibujado. A menos que la configuración haya cambiado el
+	// tamaño: los 'buffers' se reasignaron, no se asigna nada y el siguiente fotograma se presenta
+	// en cuanto se dibuja.
+	WaylandClientState* client = &window->state->client;
+	window->configured = true;
+	if (window == &client->windows[0]) {
+		startupTimelineMark(client->startup, STARTUP_CONFIGURED);
+	}
+	if (window->frame_ready) {
+		waylandWindowPresent(window, clockNowNanoseconds());
+	} else {
+		window->active_buffer_index = -1;
+		wl_surface_commit(window->wl_surface);
+	}
 }
 
 /*
@@ -334,19 +1032,33 @@ internal void waylandXdgToplevelEventConfigure(void* data, struct xdg_toplevel*
 	 *    12 constrained_top - since v7
 	 *    13 constrained_bottom - since v7
 	 */
-	WaylandState* wayland_state = data;
-	WaylandServerState* server = &wayland_state->server;
-	WaylandClientState* client = &wayland_state->client;
+	WaylandWindow* window = data;
+	WaylandServerState* server = &window->state->server;
+	WaylandClientState* client = &window->state->client;
+
+	// [EN] Configures repeat on focus and state changes, the size seldom changes
+	// [ES] Las configuraciones se repiten con cambios de foco y estado, el tamaño rara vez cambia
+	int32 new_width = suggested_new_width;
+	int32 new_height = suggested_new_height;
+	if (new_width == 0 || new_height == 0) { // the client chooses | el cliente elige
+		new_width = STD_WIDTH;
+		new_height = STD_HEIGHT;
+	}
+	if (window->buffers[0].memory && window->buffers[0].width == new_width
+			&& window->buffers[0].height == new_height) {
+		return;
+	}
 
 	for (int32 i = 0; i < NUMBER_OF_BUFFERS; ++i) {
-		bool8 succeded = waylandSetUpBuffer(&client->buffers[i], suggested_new_width,
-				suggested_new_height, server->wl_shm);
+		bool8 succeded = waylandSetUpBuffer(&window->buffers[i], new_width, new_height,
+				WL_SHM_FORMAT_XRGB8888, &client->shm_arena, &server->listeners.wl_buffer);
 		if (!succeded) {
 			logFatal("Failed to set up buffers for wayland.");
 			abort();
 		}
 	}
-	client->active_buffer_index = -1; // no buffer is active (attached to a surface)
+	window->active_buffer_index = -1; // no buffer is active (attached to a surface)
+	window->frame_ready = false; // rendered into the old buffers | dibujado en los anteriores
 
 	/*
 	 * [EN] NOTE(vluis): In a real-time application (like this one) we can avoid repaint and assign
@@ -366,8 +1078,13 @@ internal void waylandXdgToplevelEventConfigure(void* data, struct xdg_toplevel*
 internal void waylandXdgToplevelEventClose(void* data, struct xdg_toplevel* xdg_toplevel)
 {
 	// TODO(vluis): Send dialog to user to confirm exit, before actually closing the surface
-	WaylandState* wayland_state = data;
-	wayland_state->client.running = false;
+	WaylandWindow* window = data;
+	WaylandClientState* client = &window->state->client;
+	if (window == &client->windows[0]) {
+		client->running = false; // the main window, torn down by waylandClientDestroy()
+	} else {
+		waylandWindowClose(window);
+	}
 }
 
 /*
@@ -407,6 +1124,57 @@ void waylandXdgToplevelEventWmCapabilities(void* data, struct xdg_toplevel* xdg_
 	 */
 }
 
+/*
+ * [EN] Attaches the last rendered buffer and commits it, asking for a frame callback unless one is
+ * pending already. Vsync paced windows present from their frame callback, reattaching the same
+ * buffer when no new frame is ready; windows with async presentation present every frame as soon as
+ * it is rendered.
+ * [ES] Asigna el último 'buffer' dibujado y lo confirma, pidiendo un 'callback' de fotograma a
+ * menos que ya haya uno pendiente. Las ventanas al ritmo de vsync presentan desde su 'callback' de
+ * fotograma, reasignando el mismo 'buffer' cuando no hay un fotograma nuevo listo; las ventanas con
+ * presentación asíncrona presentan cada fotograma en cuanto se dibuja.
+ */
+internal void waylandWindowPresent(WaylandWindow* window, uint64 now)
+{
+	WaylandServerState* server = &window->state->server;
+	WaylandClientState* client = &window->state->client;
+
+	if (window->last_frame_time != 0) {
+		window->frame_time = clockNanosecondsToMilliseconds(now - window->last_frame_time);
+		hudRecordFrameTime(&window->hud, window->frame_time);
+	}
+	window->last_frame_time = now;
+
+	WaylandBuffer* buffer = &window->buffers[window->last_rendered_buffer_index];
+	wl_surface_attach(window->wl_surface, buffer->wl_buffer, 0, 0);
+	buffer->busy = true;
+	wl_surface_damage_buffer(window->wl_surface, 0, 0, buffer->width, buffer->height);
+	if (!window->wl_surface_frame) {
+		window->wl_surface_frame = wl_surface_frame(window->wl_surface);
+		wl_callback_add_listener(window->wl_surface_frame,
+				&server->listeners.wl_surface_frame_listener, window);
+	}
+	wl_surface_commit(window->wl_surface);
+	window->active_buffer_index = window->last_rendered_buffer_index;
+	window->mapped = true;
+	bool8 main_window = window == &client->windows[0];
+	if (window->frame_ready) {
+		window->presentation_latency =
+			clockNanosecondsToMilliseconds(now - window->frame_sample_time);
+		window->frame_ready = false;
+		if (main_window) {
+			startupTimelineMark(client->startup, STARTUP_FIRST_COMMIT);
+		}
+	}
+
+	// [EN] Copies or drops, never waits | [ES] Copia o descarta, nunca espera
+	if (client->frame_capture && main_window) {
+		Bitmap frame = { .memory = buffer->memory, .width = buffer->width,
+			.height = buffer->height, .bytes_per_row = buffer->bytes_per_row };
+		frameCaptureSubmit(client->frame_capture, &frame);
+	}
+}
+
 /*
  * [EN] The wl_surface's wl_callback global object notifies that the client should start drawing a 
  * new frame.
@@ -415,24 +1183,188 @@ void waylandXdgToplevelEventWmCapabilities(void* data, struct xdg_toplevel* xdg_
  */
 void waylandSurfaceEventNewFrame(void* data, struct wl_callback* callback, uint32 current_time)
 {	
-	// TODO(vluis): use the previous and the current_time to estimate and log a framerate
-	/* initial render */
+	WaylandWindow* window = data;
+	WaylandClientState* client = &window->state->client;
 
-	WaylandState* wayland_state = data;
-	WaylandServerState* server = &wayland_state->server;
-	WaylandClientState* client = &wayland_state->client;
+	// [EN] current_time only has millisecond granularity, use our own clock for the frame time
+	// [ES] current_time sólo tiene granularidad de milisegundos, usamos nuestro reloj
+	uint64 now = clockNowNanoseconds();
+	framePacerFrameDone(&window->pacer, now);
 
 	wl_callback_destroy(callback);
-	client->wl_surface_frame = wl_surface_frame(client->wl_surface);
-	wl_callback_add_listener(client->wl_surface_frame, &server->listeners.wl_surface_frame_listener,
-			wayland_state);
+	window->wl_surface_frame = nullptr;
+
+	bool8 main_window = window == &client->windows[0];
+	if (main_window && client->startup && client->startup->times[STARTUP_FIRST_COMMIT] != 0) {
+		startupTimelineMark(client->startup, STARTUP_FIRST_SHOWN); // the commit was presented
+		startupTimelineReport(client->startup);
+	}
+	if (window->wp_tearing_control) {
+		return;
+	}
+	// [EN] A resize reallocated the buffers and nothing was rendered into them yet, they hold
+	// whatever the arena had: keep the frame shown and wait for the next callback
+	// [ES] Un cambio de tamaño reasignó los 'buffers' y aún no se dibujó nada en ellos, tienen lo
+	// que fuera que tenía la arena: se conserva el fotograma mostrado y se espera el siguiente
+	if (window->active_buffer_index < 0 && !window->frame_ready) {
+		WaylandServerState* server = &window->state->server;
+		window->wl_surface_frame = wl_surface_frame(window->wl_surface);
+		wl_callback_add_listener(window->wl_surface_frame,
+				&server->listeners.wl_surface_frame_listener, window);
+		wl_surface_commit(window->wl_surface);
+		return;
+	}
+	waylandWindowPresent(window, now);
+}
+
+/*
+ * [EN] Keys act on the window with the keyboard focus, or the main window. Headless replays have
+ * no open window, their keys only reach the simulation.
+ * [ES] Las teclas actúan sobre la ventana con el foco del teclado, o la ventana principal. Las
+ * repeticiones sin compositor no tienen ventana abierta, sus teclas sólo llegan a la simulación.
+ */
+internal void waylandHandleKeyPress(WaylandClientState* client, uint16 code)
+{
+	WaylandWindow* window = client->keyboard_focus ? client->keyboard_focus : &client->windows[0];
+	if (!window->open) {
+		return;
+	}
+	if (code == KEY_F1) {
+		hudToggle(&window->hud);
+	} else if (code == KEY_F2) {
+		// [EN] Free, locked, confined, free... | [ES] Libre, bloqueado, confinado, libre...
+		waylandWindowConstrainPointer(window, (window->pointer_constraint + 1)
+				% WAYLAND_POINTER_CONSTRAINT_COUNT);
+	}
+}
+
+/*
+ * [EN] Applies an input event to the client state. Live and replayed events take this same path,
+ * waylandSimulateFrame() makes them land between the same ticks.
+ * [ES] Aplica un evento de entrada al estado del cliente. Los eventos en vivo y los repetidos toman
+ * este mismo camino, waylandSimulateFrame() hace que caigan entre los mismos pasos.
+ */
+internal void waylandHandleInput(WaylandClientState* client, const InputEvent* event)
+{
+	#define BTN_PRESSED 1
+	#define BTN_RELEASED 0
+
+	switch (event->type) {
+	case INPUT_EVENT_POINTER_MOTION:
+		logTrace("mouse position = (%lf, %lf)", wl_fixed_to_double(event->x),
+				wl_fixed_to_double(event->y));
+		break;
+	case INPUT_EVENT_POINTER_BUTTON:
+		if (event->code == BTN_LEFT && event->state == BTN_PRESSED) {
+			client->animation_speed = -5;
+		} else if (event->code == BTN_LEFT && event->state == BTN_RELEASED) {
+			client->animation_speed = 0;
+		} else if (event->code == BTN_RIGHT && event->state == BTN_PRESSED) {
+			client->animation_speed = 5;
+		} else if (event->code == BTN_RIGHT && event->state == BTN_RELEASED) {
+			client->animation_speed = 0;
+		}
+		break;
+	case INPUT_EVENT_KEY:
+		if (event->state == WL_KEYBOARD_KEY_STATE_PRESSED) {
+			waylandHandleKeyPress(client, event->code);
+		}
+		break;
+	case INPUT_EVENT_RELATIVE_MOTION:
+		client->relative_motion = *event;
+		break;
+	case INPUT_EVENT_RELATIVE_MOTION_UNACCELERATED: {
+		const InputEvent* accelerated = &client->relative_motion;
+		if (accelerated->type != INPUT_EVENT_RELATIVE_MOTION || event->code >= MAX_WINDOWS
+				|| !client->windows[event->code].open) {
+			break; // a truncated log or a window that's gone | un registro cortado o sin ventana
+		}
+		client->relative_motion_time = inputEventRelativeTime(accelerated,
+				client->relative_motion_time);
+		pointerMotionAdd(&client->windows[event->code].pointer_motion,
+				client->relative_motion_time, accelerated->x, accelerated->y, event->x, event->y);
+		client->relative_motion.type = INPUT_EVENT_TYPE_COUNT;
+		break;
+	}
+	default:
+		break;
+	}
+}
 
-	WaylandBuffer* buffer = &client->buffers[client->last_rendered_buffer_index];
+/*
+ * [EN] Entry point of live input: stamps the event, records it when recording and handles it,
+ * unless a replay is in progress.
+ * [ES] Punto de entrada de la entrada en vivo: marca el evento, lo graba cuando se está grabando y
+ * lo maneja, a menos que haya una repetición en curso.
+ */
+internal void waylandReceiveInput(WaylandClientState* client, InputEvent event)
+{
+	if (client->input_replay && !inputReplayFinished(client->input_replay)) {
+		return; // live input would make the replay diverge | haría divergir la repetición
+	}
+	event.frame = client->frame_index;
+	event.time = client->last_input_time;
+	if (client->input_recorder) {
+		inputRecorderWrite(client->input_recorder, &event);
+	}
+	waylandHandleInput(client, &event);
+}
 
-	wl_surface_attach(client->wl_surface, buffer->wl_buffer, 0, 0);
-	wl_surface_damage_buffer(client->wl_surface, 0, 0, buffer->width, buffer->height);
-	wl_surface_commit(client->wl_surface);
-	client->active_buffer_index = client->last_rendered_buffer_index;
+internal void waylandSimulateTick(WaylandClientState* client)
+{
+	client->previous_gradient_offset = client->gradient_offset;
+	client->gradient_offset += (int32)client->animation_speed;
+}
+
+/*
+ * [EN] One step of the simulation, before the windows that are due render: applies the replayed
+ * events that are due, runs the ticks and returns the interpolation to render with. The ticks come
+ * from timestep and the clock, a recording logs them after the input of the step. A replay by frame
+ * runs the logged ticks and interpolation instead, so it goes through the same states and renders
+ * the same frames as the recorded session however fast it runs. timestep keeps advancing meanwhile,
+ * it doesn't catch up when the replay ends.
+ * [ES] Un paso de la simulación, antes de que dibujen las ventanas a las que les toca: aplica los
+ * eventos repetidos que tocan, corre los pasos y regresa la interpolación con la que dibujar. Los
+ * pasos vienen de timestep y el reloj, una grabación los registra después de la entrada del paso.
+ * Una repetición por fotograma corre los pasos y la interpolación registrados, así pasa por los
+ * mismos estados y dibuja los mismos fotogramas que la sesión grabada sin importar qué tan rápido
+ * corra. timestep sigue avanzando mientras tanto, no se pone al día cuando termina la repetición.
+ */
+internal float32 waylandSimulateFrame(WaylandClientState* client, FixedTimestep* timestep,
+		uint64 now)
+{
+	int32 ticks = fixedTimestepAdvance(timestep, now);
+	float32 interpolation = fixedTimestepAlpha(timestep);
+	InputReplay* replay = client->input_replay;
+	if (replay && !inputReplayFinished(replay)) {
+		if (!client->replay_started) {
+			client->replay_start = now;
+			client->replay_started = true;
+		}
+		uint64 elapsed = now - client->replay_start;
+		const InputEvent* event;
+		while ((event = inputReplayNext(replay, (uint32)(elapsed / NANOSECONDS_PER_MILLISECOND)))) {
+			waylandHandleInput(client, event);
+		}
+		// [EN] By time, or past the last step, the clock decides | [ES] Si no, decide el reloj
+		inputReplayTakeFrame(replay, &ticks, &interpolation);
+	} else if (client->input_recorder) {
+		InputEvent frame = { .frame = client->frame_index, .time = client->last_input_time,
+			.x = ticks, .type = INPUT_EVENT_FRAME };
+		memcpy(&frame.y, &interpolation, sizeof(frame.y));
+		inputRecorderWrite(client->input_recorder, &frame);
+	}
+	for (int32 tick = 0; tick < ticks; ++tick) {
+		waylandSimulateTick(client);
+	}
+	return interpolation;
+}
+
+internal int32 waylandInterpolateGradientOffset(const WaylandClientState* client,
+		float32 interpolation)
+{
+	int32 change = client->gradient_offset - client->previous_gradient_offset;
+	return client->previous_gradient_offset + (int32)((float32)change * interpolation);
 }
 
 /*
@@ -448,6 +1380,7 @@ void waylandSeatEventCapabilities(void* data, struct wl_seat* seat, uint32 capab
 	if (capabilities & WL_SEAT_CAPABILITY_KEYBOARD) {
 		assert(!client->wl_keyboard, "Didn't released wl_keyboard when the capability was lost.");
 		client->wl_keyboard = wl_seat_get_keyboard(seat);
+		wl_keyboard_add_listener(client->wl_keyboard, &server->listeners.wl_keyboard, client);
 	} else if (client->wl_keyboard) {
 		wl_keyboard_destroy(client->wl_keyboard);
 		client->wl_keyboard = nullptr;
@@ -457,7 +1390,23 @@ void waylandSeatEventCapabilities(void* data, struct wl_seat* seat, uint32 capab
 		assert(!client->wl_pointer, "Didn't released wl_pointer when the capability was lost.");
 		client->wl_pointer = wl_seat_get_pointer(seat);
 		wl_pointer_add_listener(client->wl_pointer, &server->listeners.wl_pointer, client);
+		if (server->zwp_relative_pointer_manager) {
+			client->zwp_relative_pointer = zwp_relative_pointer_manager_v1_get_relative_pointer(
+					server->zwp_relative_pointer_manager, client->wl_pointer);
+			zwp_relative_pointer_v1_add_listener(client->zwp_relative_pointer,
+					&server->listeners.zwp_relative_pointer, client);
+		}
 	} else if (client->wl_pointer) {
+		// [EN] Constraints and relative motion belong to the pointer | [ES] Pertenecen al puntero
+		for (int32 i = 0; i < MAX_WINDOWS; ++i) {
+			if (client->windows[i].open) {
+				waylandWindowConstrainPointer(&client->windows[i], WAYLAND_POINTER_FREE);
+			}
+		}
+		if (client->zwp_relative_pointer) {
+			zwp_relative_pointer_v1_destroy(client->zwp_relative_pointer);
+			client->zwp_relative_pointer = nullptr;
+		}
 		wl_pointer_destroy(client->wl_pointer);
 		client->wl_pointer = nullptr;
 	}
@@ -469,6 +1418,124 @@ void waylandSeatEventName(void* data, struct wl_seat* seat, const char* name)
 	// TODO(vluis): Is this needed for my simple client?
 }
 
+/*
+ * [EN] Loads the cursor theme named by XCURSOR_THEME (the default one when unset) at XCURSOR_SIZE.
+ * Without a theme the pointer keeps whatever image the compositor shows.
+ * [ES] Carga el tema de cursores nombrado por XCURSOR_THEME (el predeterminado si no existe) con
+ * tamaño XCURSOR_SIZE. Sin tema el puntero conserva la imagen que muestre el compositor.
+ */
+internal void waylandCursorInitialize(WaylandCursor* cursor, struct wl_compositor* compositor,
+		struct wl_shm* shm, const struct wl_callback_listener* frame_listener)
+{
+	*cursor = (WaylandCursor){ .frame_listener = frame_listener, .image_index = -1 };
+	const char* size_variable = getenv("XCURSOR_SIZE");
+	int32 size = size_variable ? atoi(size_variable) : 0;
+	cursor->theme = wl_cursor_theme_load(getenv("XCURSOR_THEME"),
+			(size > 0) ? size : CURSOR_DEFAULT_SIZE, shm);
+	if (!cursor->theme) {
+		logWarn("Failed to load the cursor theme, the pointer image is left to the compositor.");
+		return;
+	}
+	cursor->cursor = wl_cursor_theme_get_cursor(cursor->theme, CURSOR_NAME);
+	if (!cursor->cursor) {
+		cursor->cursor = wl_cursor_theme_get_cursor(cursor->theme, CURSOR_FALLBACK_NAME);
+	}
+	if (!cursor->cursor || cursor->cursor->image_count == 0) {
+		logWarn("The cursor theme has no %s cursor.", CURSOR_NAME);
+		wl_cursor_theme_destroy(cursor->theme);
+		cursor->theme = nullptr;
+		cursor->cursor = nullptr;
+		return;
+	}
+	cursor->wl_surface = wl_compositor_create_surface(compositor);
+}
+
+internal void waylandCursorDestroy(WaylandCursor* cursor)
+{
+	if (cursor->wl_callback) {
+		wl_callback_destroy(cursor->wl_callback);
+	}
+	if (cursor->wl_surface) {
+		wl_surface_destroy(cursor->wl_surface);
+	}
+	if (cursor->theme) {
+		wl_cursor_theme_destroy(cursor->theme);
+	}
+	*cursor = (WaylandCursor){ .image_index = -1 };
+}
+
+/*
+ * [EN] Attaches one of the cached image buffers, the commit is left to the caller.
+ * [ES] Asigna uno de los 'buffers' de imagen ya creados, el 'commit' queda al que llama.
+ */
+internal void waylandCursorAttachImage(WaylandCursor* cursor, int32 image_index)
+{
+	struct wl_cursor_image* image = cursor->cursor->images[image_index];
+	wl_surface_attach(cursor->wl_surface, wl_cursor_image_get_buffer(image), 0, 0);
+	wl_surface_damage_buffer(cursor->wl_surface, 0, 0, (int32)image->width, (int32)image->height);
+	cursor->image_index = image_index;
+}
+
+internal void waylandCursorRequestFrame(WaylandCursor* cursor)
+{
+	cursor->wl_callback = wl_surface_frame(cursor->wl_surface);
+	wl_callback_add_listener(cursor->wl_callback, cursor->frame_listener, cursor);
+}
+
+internal void waylandCursorStopAnimation(WaylandCursor* cursor)
+{
+	if (cursor->wl_callback) {
+		wl_callback_destroy(cursor->wl_callback);
+		cursor->wl_callback = nullptr;
+	}
+}
+
+/*
+ * [EN] Sets the cursor surface as the pointer image, the enter serial authorizes the request.
+ * [ES] Asigna la superficie del cursor como imagen del puntero, el 'serial' de entrada autoriza la
+ * petición.
+ */
+internal void waylandCursorShow(WaylandCursor* cursor, struct wl_pointer* pointer, uint32 serial)
+{
+	if (!cursor->cursor) {
+		return;
+	}
+	waylandCursorStopAnimation(cursor);
+	waylandCursorAttachImage(cursor, 0);
+	struct wl_cursor_image* image = cursor->cursor->images[0];
+	wl_pointer_set_cursor(pointer, serial, cursor->wl_surface, (int32)image->hotspot_x,
+			(int32)image->hotspot_y);
+	if (cursor->cursor->image_count > 1) {
+		cursor->animation_start = clockNowNanoseconds();
+		waylandCursorRequestFrame(cursor);
+	}
+	wl_surface_commit(cursor->wl_surface);
+}
+
+/*
+ * [EN] Frame callback of the cursor surface, data is its WaylandCursor. The callbacks only arrive
+ * while the cursor is visible. An image with another hotspot would need a new set_cursor request;
+ * theme animations keep the same one.
+ * [ES] 'Callback' de fotograma de la superficie del cursor, data es su WaylandCursor. Los
+ * 'callbacks' sólo llegan mientras el cursor es visible. Una imagen con otro punto activo
+ * requeriría una nueva petición set_cursor; las animaciones de los temas conservan el mismo.
+ */
+void waylandCursorEventFrame(void* data, struct wl_callback* callback, uint32 current_time)
+{
+	WaylandCursor* cursor = data;
+	wl_callback_destroy(callback);
+	cursor->wl_callback = nullptr;
+
+	uint32 elapsed = (uint32)((clockNowNanoseconds() - cursor->animation_start)
+			/ NANOSECONDS_PER_MILLISECOND);
+	int32 image_index = wl_cursor_frame(cursor->cursor, elapsed);
+	if (image_index != cursor->image_index) {
+		waylandCursorAttachImage(cursor, image_index);
+	}
+	waylandCursorRequestFrame(cursor);
+	wl_surface_commit(cursor->wl_surface);
+}
+
 /**
  * enter event
  *
@@ -487,7 +1554,10 @@ void waylandPointerEventEnter(void* data, struct wl_pointer* pointer, uint32 ser
 		struct wl_surface* surface, wl_fixed_t surface_x, wl_fixed_t surface_y)
 {
 	WaylandClientState* client = data;
-	// client->animation_speed = 5;
+	client->pointer_focus = surface ? wl_surface_get_user_data(surface) : nullptr;
+	waylandCursorShow(&client->cursor, pointer, serial);
+	waylandReceiveInput(client, (InputEvent){ .type = INPUT_EVENT_POINTER_ENTER, .x = surface_x,
+			.y = surface_y });
 }
 
 /**
@@ -505,7 +1575,9 @@ void waylandPointerEventLeave(void* data, struct wl_pointer* pointer, uint32 ser
 		struct wl_surface* surface)
 {
 	WaylandClientState* client = data;
-	// client->animation_speed = 0;
+	client->pointer_focus = nullptr;
+	waylandCursorStopAnimation(&client->cursor);
+	waylandReceiveInput(client, (InputEvent){ .type = INPUT_EVENT_POINTER_LEAVE });
 }
 
 /**
@@ -521,9 +1593,10 @@ void waylandPointerEventLeave(void* data, struct wl_pointer* pointer, uint32 ser
 void waylandPointerEventMotion(void* data, struct wl_pointer* pointer, uint32 time,
 		wl_fixed_t surface_x, wl_fixed_t surface_y)
 {
-	float64 mouse_x = wl_fixed_to_double(surface_x);
-	float64 mouse_y = wl_fixed_to_double(surface_y);
-	logTrace("mouse position = (%lf, %lf)", mouse_x, mouse_y);
+	WaylandClientState* client = data;
+	client->last_input_time = time;
+	waylandReceiveInput(client, (InputEvent){ .type = INPUT_EVENT_POINTER_MOTION, .x = surface_x,
+			.y = surface_y });
 }
 
 /**
@@ -551,19 +1624,9 @@ void waylandPointerEventButton(void* data, struct wl_pointer* pointer, uint32 se
 		uint32 button, uint32 state)
 {
 	WaylandClientState* client = data;
-
-	#define BTN_PRESSED 1
-	#define BTN_RELEASED 0
-
-	if (button == BTN_LEFT && state == BTN_PRESSED) {
-		client->animation_speed = -5;
-	} else if (button == BTN_LEFT && state == BTN_RELEASED) {
-		client->animation_speed = 0;
-	} else if (button == BTN_RIGHT && state == BTN_PRESSED) { 
-		client->animation_speed = 5;
-	} else if (button == BTN_RIGHT && state == BTN_RELEASED) {
-		client->animation_speed = 0;
-	}
+	client->last_input_time = time;
+	waylandReceiveInput(client, (InputEvent){ .type = INPUT_EVENT_POINTER_BUTTON,
+			.code = (uint16)button, .state = (uint8)state });
 }
 
 /**
@@ -592,6 +1655,10 @@ void waylandPointerEventButton(void* data, struct wl_pointer* pointer, uint32 se
 void waylandPointerEventAxis(void* data, struct wl_pointer* pointer, uint32 time, uint32 axis,
 		wl_fixed_t value)
 {
+	WaylandClientState* client = data;
+	client->last_input_time = time;
+	waylandReceiveInput(client, (InputEvent){ .type = INPUT_EVENT_POINTER_AXIS, .code = (uint16)axis,
+			.x = value });
 }
 
 /**
@@ -821,6 +1888,140 @@ void waylandPointerEventAxisRelativeDirection(void* data, struct wl_pointer* poi
 {
 }
 
+/*
+ * [EN] The zwp_relative_pointer_v1 object reports pointer motion as deltas with a microsecond
+ * timestamp, also unaccelerated and past the window edge, at the rate of the device. It only adds
+ * to the focused window. Each motion goes through waylandReceiveInput() as two events that name
+ * the window, so a recording keeps it and a replay adds it to the same window. The timestamp is
+ * rebuilt from the 24 bits the log keeps, live too, so both see the same event rate.
+ * [ES] El objeto zwp_relative_pointer_v1 reporta el movimiento del puntero como deltas con marca
+ * de tiempo en microsegundos, también sin aceleración y más allá del borde de la ventana, al ritmo
+ * del dispositivo. Sólo suma a la ventana con el foco. Cada movimiento pasa por
+ * waylandReceiveInput() como dos eventos que nombran la ventana, así una grabación lo conserva y
+ * una repetición lo suma a la misma ventana. La marca de tiempo se reconstruye de los 24 bits que
+ * guarda el registro, también en vivo, así ambos ven el mismo ritmo de eventos.
+ */
+void waylandRelativePointerEventMotion(void* data, struct zwp_relative_pointer_v1* relative_pointer,
+		uint32 time_high, uint32 time_low, wl_fixed_t dx, wl_fixed_t dy,
+		wl_fixed_t unaccelerated_dx, wl_fixed_t unaccelerated_dy)
+{
+	WaylandClientState* client = data;
+	if (!client->pointer_focus) {
+		return;
+	}
+	InputEvent accelerated = { .type = INPUT_EVENT_RELATIVE_MOTION, .x = dx, .y = dy };
+	inputEventSetRelativeTime(&accelerated, ((uint64)time_high << 32) | time_low);
+	waylandReceiveInput(client, accelerated);
+	waylandReceiveInput(client, (InputEvent){ .type = INPUT_EVENT_RELATIVE_MOTION_UNACCELERATED,
+			.x = unaccelerated_dx, .y = unaccelerated_dy,
+			.code = (uint16)(client->pointer_focus - client->windows) });
+}
+
+/*
+ * [EN] The compositor applied or lifted the pointer constraint of a window. A persistent constraint
+ * comes back on its own when the window gets the pointer focus again.
+ * [ES] El compositor aplicó o levantó la restricción del puntero de una ventana. Una restricción
+ * persistente vuelve sola cuando la ventana recupera el foco del puntero.
+ */
+void waylandLockedPointerEventLocked(void* data, struct zwp_locked_pointer_v1* locked_pointer)
+{
+	WaylandWindow* window = data;
+	window->pointer_constraint_active = true;
+}
+
+void waylandLockedPointerEventUnlocked(void* data, struct zwp_locked_pointer_v1* locked_pointer)
+{
+	WaylandWindow* window = data;
+	window->pointer_constraint_active = false;
+}
+
+void waylandConfinedPointerEventConfined(void* data,
+		struct zwp_confined_pointer_v1* confined_pointer)
+{
+	WaylandWindow* window = data;
+	window->pointer_constraint_active = true;
+}
+
+void waylandConfinedPointerEventUnconfined(void* data,
+		struct zwp_confined_pointer_v1* confined_pointer)
+{
+	WaylandWindow* window = data;
+	window->pointer_constraint_active = false;
+}
+
+/*
+ * [EN] The wl_keyboard object shares the keymap as a file descriptor, we don't translate keys yet
+ * (evdev codes are enough), so it only gets closed.
+ * [ES] El objeto wl_keyboard comparte el mapa de teclas como un descriptor de archivo, aún no
+ * traducimos teclas (los códigos evdev son suficientes), así que sólo se cierra.
+ */
+void waylandKeyboardEventKeymap(void* data, struct wl_keyboard* keyboard, uint32 format, int32 fd,
+		uint32 size)
+{
+	close(fd);
+}
+
+/*
+ * [EN] The wl_keyboard object notifies that surface got the keyboard focus, window surfaces carry
+ * their WaylandWindow as user data.
+ * [ES] El objeto wl_keyboard notifica que surface obtuvo el foco del teclado, las superficies de
+ * las ventanas llevan su WaylandWindow como datos de usuario.
+ */
+void waylandKeyboardEventEnter(void* data, struct wl_keyboard* keyboard, uint32 serial,
+		struct wl_surface* surface, struct wl_array* pressed_keys)
+{
+	WaylandClientState* client = data;
+	client->keyboard_focus = surface ? wl_surface_get_user_data(surface) : nullptr;
+}
+
+void waylandKeyboardEventLeave(void* data, struct wl_keyboard* keyboard, uint32 serial,
+		struct wl_surface* surface)
+{
+	WaylandClientState* client = data;
+	client->keyboard_focus = nullptr;
+}
+
+/*
+ * [EN] The wl_keyboard object notifies a key press or release, key is an evdev code
+ * (linux/input-event-codes.h). F1 toggles the performance HUD of the focused window.
+ * [ES] El objeto wl_keyboard notifica que una tecla se presionó o soltó, key es un código evdev
+ * (linux/input-event-codes.h). F1 muestra u oculta el panel de rendimiento de la ventana con foco.
+ */
+void waylandKeyboardEventKey(void* data, struct wl_keyboard* keyboard, uint32 serial, uint32 time,
+		uint32 key, uint32 state)
+{
+	WaylandClientState* client = data;
+	client->last_input_time = time;
+	waylandReceiveInput(client, (InputEvent){ .type = INPUT_EVENT_KEY, .code = (uint16)key,
+			.state = (uint8)state });
+}
+
+void waylandKeyboardEventModifiers(void* data, struct wl_keyboard* keyboard, uint32 serial,
+		uint32 mods_depressed, uint32 mods_latched, uint32 mods_locked, uint32 group)
+{
+	// Intentionally left blank
+}
+
+void waylandKeyboardEventRepeatInfo(void* data, struct wl_keyboard* keyboard, int32 rate,
+		int32 delay)
+{
+	// Intentionally left blank
+}
+
+/*
+ * [EN] The compositor stopped reading from the buffer, data is its WaylandBuffer.
+ * [ES] El compositor dejó de leer del 'buffer', data es su WaylandBuffer.
+ */
+void waylandBufferEventRelease(void* data, struct wl_buffer* wl_buffer)
+{
+	WaylandBuffer* buffer = data;
+	buffer->busy = false;
+	WaylandShmArena* arena = buffer->arena;
+	if (buffer >= arena->retired && buffer < arena->retired + SHM_ARENA_RETIRED_BUFFERS) {
+		waylandShmArenaCollect(arena);
+	}
+}
+
 /*
  * [EN] Sets wayland events callback functions.
  * [ES] Configura las funciones callback de los eventos wayland.
@@ -837,6 +2038,7 @@ internal void waylandSetListeners(WaylandListeners* listeners)
 	listeners->xdg_toplevel.configure_bounds = waylandXdgToplevelEventConfigureBounds;
 	listeners->xdg_toplevel.wm_capabilities = waylandXdgToplevelEventWmCapabilities; // TODO(vluis): test limiting xdg_wm_base version to 4 and see if this throws an error
 	listeners->wl_surface_frame_listener.done = waylandSurfaceEventNewFrame;
+	listeners->wl_cursor_frame_listener.done = waylandCursorEventFrame;
 	listeners->wl_seat.capabilities = waylandSeatEventCapabilities;
 	listeners->wl_seat.name = waylandSeatEventName;
 	listeners->wl_pointer.enter = waylandPointerEventEnter;
@@ -850,21 +2052,40 @@ internal void waylandSetListeners(WaylandListeners* listeners)
 	listeners->wl_pointer.axis_discrete = waylandPointerEventAxisDiscrete;
 	listeners->wl_pointer.axis_value120 = waylandPointerEventAxisValue120;
 	listeners->wl_pointer.axis_relative_direction = waylandPointerEventAxisRelativeDirection;
+	listeners->wl_keyboard.keymap = waylandKeyboardEventKeymap;
+	listeners->wl_keyboard.enter = waylandKeyboardEventEnter;
+	listeners->wl_keyboard.leave = waylandKeyboardEventLeave;
+	listeners->wl_keyboard.key = waylandKeyboardEventKey;
+	listeners->wl_keyboard.modifiers = waylandKeyboardEventModifiers;
+	listeners->wl_keyboard.repeat_info = waylandKeyboardEventRepeatInfo;
+	listeners->wl_buffer.release = waylandBufferEventRelease;
+	listeners->zwp_relative_pointer.relative_motion = waylandRelativePointerEventMotion;
+	listeners->zwp_locked_pointer.locked = waylandLockedPointerEventLocked;
+	listeners->zwp_locked_pointer.unlocked = waylandLockedPointerEventUnlocked;
+	listeners->zwp_confined_pointer.confined = waylandConfinedPointerEventConfined;
+	listeners->zwp_confined_pointer.unconfined = waylandConfinedPointerEventUnconfined;
 }
 
 /*
  * [EN] Establishes a connection to the wayland server and begins the process of getting the needed
- * global objects.
+ * global objects. libwayland picks the server from WAYLAND_SOCKET (an already connected fd, e.g.
+ * one end of a socketpair() owned by a stand-in compositor) or WAYLAND_DISPLAY.
  * [ES] Establece una conexión al servidor wayland y comienza el proceso de obtener los objetos
- * globales necesarios.
+ * globales necesarios. libwayland elige el servidor a partir de WAYLAND_SOCKET (un fd ya conectado,
+ * p. ej. un extremo de un socketpair() de un compositor sustituto) o de WAYLAND_DISPLAY.
  */
 internal void waylandServerConnect(WaylandState* wayland_state)
 {
 	WaylandServerState* server = &wayland_state->server;
 	server->wl_display = wl_display_connect(nullptr);
+	if (!server->wl_display) {
+		logFatal("Failed to connect to a wayland server, is WAYLAND_DISPLAY set?");
+		abort();
+	}
 	server->wl_registry = wl_display_get_registry(server->wl_display);
 	wl_registry_add_listener(server->wl_registry, &server->listeners.wl_registry, wayland_state);
 	wl_display_roundtrip(server->wl_display); // wait for wl_registry events to process
+	startupTimelineMark(wayland_state->client.startup, STARTUP_CONNECTED);
 }
 
 internal void waylandServerDisconnect(WaylandServerState* server)
@@ -872,38 +2093,76 @@ internal void waylandServerDisconnect(WaylandServerState* server)
 	wl_display_disconnect(server->wl_display);
 }
 
+/*
+ * [EN] Startup work that needs no compositor, called before waylandServerConnect() so it overlaps
+ * the registry roundtrip, the only roundtrip of the startup path.
+ * [ES] Trabajo de arranque que no necesita compositor, se llama antes de waylandServerConnect()
+ * para que se traslape con el 'roundtrip' del registro, el único del camino de arranque.
+ */
+internal void waylandClientPrepare(WaylandState* state)
+{
+	WaylandClientState* client = &state->client;
+	if (!waylandShmArenaCreate(&client->shm_arena)) {
+		abort();
+	}
+	startupTimelineMark(client->startup, STARTUP_ARENA_MAPPED);
+}
+
+/*
+ * [EN] Sets up what every window shares and opens the main window, windows[0]. Nothing waits for
+ * the compositor here, the first configure arrives with the next dispatch.
+ * [ES] Prepara lo que comparten todas las ventanas y abre la ventana principal, windows[0]. Nada
+ * espera al compositor aquí, la primera configuración llega con el siguiente despacho.
+ */
 internal void waylandClientInitialize(WaylandState* state)
 {
 	WaylandServerState* server = &state->server;
 	WaylandClientState* client = &state->client;
 
-	for (int32 i = 0; i < NUMBER_OF_BUFFERS; ++i) { // initialization
-		client->buffers[i].fd = -1;
+	waylandShmArenaConnect(&client->shm_arena, server->wl_shm);
+	startupTimelineMark(client->startup, STARTUP_PREFAULTED);
+	if (!waylandWindowOpen(state, "kanso")) {
+		abort();
 	}
+	startupTimelineMark(client->startup, STARTUP_WINDOW_OPENED);
+	wl_display_flush(server->wl_display); // configure while frame 0 renders | mientras se dibuja
+	waylandCursorInitialize(&client->cursor, server->wl_compositor, server->wl_shm,
+			&server->listeners.wl_cursor_frame_listener);
+}
 
-	client->wl_surface = wl_compositor_create_surface(server->wl_compositor);
-	client->xdg_surface = xdg_wm_base_get_xdg_surface(server->xdg_wm_base, client->wl_surface);
-	xdg_surface_add_listener(client->xdg_surface, &server->listeners.xdg_surface, state);
-	client->xdg_toplevel = xdg_surface_get_toplevel(client->xdg_surface);
-	xdg_toplevel_add_listener(client->xdg_toplevel, &server->listeners.xdg_toplevel, state);
-	xdg_toplevel_set_title(client->xdg_toplevel, "kanso");
-	client->wl_surface_frame = wl_surface_frame(client->wl_surface);
-	wl_callback_add_listener(client->wl_surface_frame, &server->listeners.wl_surface_frame_listener,
-			state);
-	wl_surface_commit(client->wl_surface);
+internal void waylandClientDestroy(WaylandState* state)
+{
+	WaylandClientState* client = &state->client;
+	for (int32 i = 0; i < MAX_WINDOWS; ++i) {
+		if (client->windows[i].open) {
+			waylandWindowClose(&client->windows[i]);
+		}
+	}
+	waylandCursorDestroy(&client->cursor);
+	waylandShmArenaDestroy(&client->shm_arena);
 }
 
-[[nodiscard]] internal int32 waylandSelectBufferForNewFrame(WaylandClientState* client)
+[[nodiscard]] internal int32 waylandSelectBufferForNewFrame(WaylandWindow* window)
 {
 	int32 next_buffer_index; // buffer for the new frame
-	int32 active_buffer_index = client->active_buffer_index;
+	int32 active_buffer_index = window->active_buffer_index;
 	assert(NUMBER_OF_BUFFERS >= 2, "Invalid number of buffers being used");
+	if (window->wp_tearing_control) {
+		// [EN] Every frame is committed, the compositor may still read any busy buffer
+		// [ES] Cada fotograma se confirma, el compositor aún puede leer cualquier 'buffer' ocupado
+		for (int32 i = 0; i < NUMBER_OF_BUFFERS; ++i) {
+			if (!window->buffers[i].busy) {
+				return i;
+			}
+		}
+		assert(false, "A frame was due without a free buffer");
+	}
 	if (active_buffer_index < 0) { // buffers are not being used
 		next_buffer_index = 0;
 	} else {
 		for (int32 i = 1; i < NUMBER_OF_BUFFERS; ++i) {
 			next_buffer_index = (active_buffer_index + i) % NUMBER_OF_BUFFERS;
-			if (next_buffer_index != client->last_rendered_buffer_index)
+			if (next_buffer_index != window->last_rendered_buffer_index)
 				break;
 		}
 	}
@@ -914,26 +2173,217 @@ internal void waylandClientInitialize(WaylandState* state)
 	return next_buffer_index;
 }
 
-internal void waylandUpdateRenderingSystem(WaylandClientState* client)
+/*
+ * [EN] Plain stores between liveStatsBeginWrite() and liveStatsEndWrite(), readers never block it.
+ * Frame figures are the main window's.
+ * [ES] Escrituras simples entre liveStatsBeginWrite() y liveStatsEndWrite(), los lectores nunca lo
+ * bloquean. Las cifras de fotogramas son las de la ventana principal.
+ */
+internal void waylandPublishLiveStats(WaylandClientState* client, const WaylandEventStats* events)
 {
-	int32 next_buffer_index = waylandSelectBufferForNewFrame(client);
-	WaylandBuffer* next_buffer = &client->buffers[next_buffer_index];
-	void* next_buffer_mem = mmap(nullptr, next_buffer->size, PROT_READ | PROT_WRITE, MAP_SHARED,
-			next_buffer->fd, 0);
-	renderGradient(next_buffer_mem, next_buffer->width, next_buffer->height,
-			next_buffer->bytes_per_row, client->animation_speed);
-	munmap(next_buffer_mem, next_buffer->size);
-	client->last_rendered_buffer_index = next_buffer_index;
+	const WaylandWindow* window = &client->windows[0];
+	uint32 buffers_busy = 0;
+	for (int32 i = 0; i < NUMBER_OF_BUFFERS; ++i) {
+		buffers_busy += window->buffers[i].busy;
+	}
+
+	LiveStats* stats = liveStatsBeginWrite(client->live_stats);
+	stats->update_time = clockNowNanoseconds();
+	stats->frame_count = client->frame_index;
+	stats->events_dispatched = events->total_events;
+	stats->frame_time = window->frame_time;
+	stats->render_time = window->render_time;
+	stats->presentation_latency = window->presentation_latency;
+	stats->presentation_mode = window->wp_tearing_control ? LIVE_STATS_PRESENTATION_ASYNC
+		: LIVE_STATS_PRESENTATION_VSYNC;
+	stats->events_per_second = events->events_per_second;
+	stats->max_event_dispatch_time = events->max_dispatch_time;
+	stats->event_queue_depth = events->queue_depth;
+	stats->buffers_busy = buffers_busy;
+	stats->buffer_count = NUMBER_OF_BUFFERS;
+	if (window->frame_time > 0) {
+		stats->frame_time_histogram[liveStatsHistogramBucket(window->frame_time)]++;
+	}
+	liveStatsEndWrite(client->live_stats);
 }
 
 /*
- * [EN] Dispatches queued wayland messages.
- * [ES] Despacha los mensajes wayland acumulados.
+ * [EN] Whether the window is waiting to render its next frame, it becomes due at its render
+ * deadline (right away without pacing). Otherwise *wait is the time left in nanoseconds, 0 for a
+ * window that waits on its frame callback or on the configure that attaches frame 0. A window with
+ * async presentation is due whenever one of its buffers is free, it waits on wl_buffer.release.
+ * [ES] Si la ventana espera dibujar su siguiente fotograma, le toca en su límite para dibujar (de
+ * inmediato sin ritmo). De otra forma *wait es el tiempo restante en nanosegundos, 0 para una
+ * ventana que espera su 'callback' de fotograma o la configuración que asigna el fotograma 0. A
+ * una ventana con presentación asíncrona le toca cuando alguno de sus 'buffers' está libre, espera
+ * a wl_buffer.release.
  */
-internal void waylandUpdate(WaylandServerState* server)
+[[nodiscard]] internal bool8 waylandWindowFrameDue(const WaylandWindow* window, uint64 now,
+		bool8 pacing, uint64* wait)
 {
-		wl_display_dispatch(server->wl_display); // process queued events
-		wl_display_flush(server->wl_display); // send queued requests
+	*wait = 0;
+	if (!window->open || window->frame_ready) {
+		return false;
+	}
+	if (window->wp_tearing_control) {
+		for (int32 i = 0; i < NUMBER_OF_BUFFERS; ++i) {
+			if (!window->buffers[i].busy) {
+				return true;
+			}
+		}
+		return false;
+	}
+	uint64 deadline = pacing ? framePacerRenderDeadline(&window->pacer) : 0;
+	if (now >= deadline) {
+		return true;
+	}
+	*wait = deadline - now;
+	return false;
+}
+
+/*
+ * [EN] Renders the next frame of window, interpolation is how far the simulation time is between
+ * the last two ticks, fixedTimestepAlpha(). The HUD goes on its own layer when there is one,
+ * refreshed every HUD_LAYER_REFRESH_INTERVAL instead of being drawn into every frame, and only
+ * the characters and graph that changed are redrawn and damaged.
+ * [ES] Dibuja el siguiente fotograma de window, interpolation es qué tan lejos está el tiempo de
+ * simulación entre los últimos dos pasos, fixedTimestepAlpha(). El panel va en su propia capa
+ * cuando existe, refrescada cada HUD_LAYER_REFRESH_INTERVAL en lugar de dibujarse en cada
+ * fotograma, y sólo se redibujan y dañan los caracteres y la gráfica que cambiaron.
+ */
+internal void waylandUpdateRenderingSystem(WaylandClientState* client, WaylandWindow* window,
+		const WaylandEventStats* events, float32 interpolation)
+{
+	bool8 main_window = window == &client->windows[0];
+	if (main_window && client->perf_counters) {
+		client->perf_stats = perfCountersSampleFrame(client->perf_counters);
+	}
+
+	window->frame_pointer_motion = pointerMotionTake(&window->pointer_motion);
+	int32 next_buffer_index = waylandSelectBufferForNewFrame(window);
+	WaylandBuffer* next_buffer = &window->buffers[next_buffer_index];
+	uint64 render_start = clockNowNanoseconds();
+	renderGradient(next_buffer->memory, next_buffer->width, next_buffer->height,
+			next_buffer->bytes_per_row, waylandInterpolateGradientOffset(client, interpolation));
+	window->render_time = clockNanosecondsToMilliseconds(clockNowNanoseconds() - render_start);
+
+	Bitmap frame = { .memory = next_buffer->memory, .width = next_buffer->width,
+		.height = next_buffer->height, .bytes_per_row = next_buffer->bytes_per_row };
+	HudBufferStats stats = { .width = next_buffer->width, .height = next_buffer->height,
+		.bytes_per_row = next_buffer->bytes_per_row, .buffer_index = next_buffer_index,
+		.buffer_count = NUMBER_OF_BUFFERS, .render_time = window->render_time,
+		.events_per_second = events->events_per_second,
+		.max_event_dispatch_time = events->max_dispatch_time,
+		.presentation_latency = window->presentation_latency,
+		.tearing = window->wp_tearing_control != nullptr,
+		.raw_pointer = client->zwp_relative_pointer != nullptr,
+		.pointer_events = window->frame_pointer_motion.event_count,
+		.pointer_event_rate = pointerMotionEventRate(&window->frame_pointer_motion),
+		.perf = client->perf_counters ? &client->perf_stats : nullptr };
+	if (window->hud_layer.wl_surface) {
+		// [EN] Formatted before showing, the whole layer gets redrawn then
+		// [ES] Formateado antes de mostrarse, entonces se redibuja toda la capa
+		uint64 now = clockNowNanoseconds();
+		bool8 shown = window->hud.visible && !window->hud_layer.visible;
+		if (window->hud.visible
+				&& (shown || now - window->hud_layer_draw_time >= HUD_LAYER_REFRESH_INTERVAL)) {
+			HudLayerChanges changes = hudUpdateLayer(&window->hud, &stats);
+			for (int32 i = 0; i < changes.count; ++i) {
+				const HudRectangle* area = &changes.areas[i];
+				waylandLayerMarkDirty(&window->hud_layer, (WaylandRectangle){ area->x, area->y,
+					area->width, area->height });
+			}
+			window->hud_layer_draw_time = now;
+		}
+		waylandLayerSetVisible(&window->hud_layer, window->hud.visible);
+		waylandLayerUpdate(&window->hud_layer);
+	} else {
+		hudDraw(&window->hud, &frame, &stats);
+	}
+	window->last_rendered_buffer_index = next_buffer_index;
+	window->frame_sample_time = render_start;
+	window->frame_ready = true;
+	framePacerRecordRenderCost(&window->pacer, clockNowNanoseconds() - render_start);
+	if (main_window) {
+		startupTimelineMark(client->startup, STARTUP_FIRST_RENDER);
+		client->frame_index++;
+		if (client->live_stats) {
+			waylandPublishLiveStats(client, events);
+		}
+	}
+	// [EN] Before the first configure frame 0 waits for it, an unmapped window gets no frame
+	// callback so its first frame goes out right away
+	// [ES] Antes de la primera configuración el fotograma 0 la espera, una ventana sin mapear no
+	// recibe 'callbacks' de fotograma así que su primer fotograma sale de inmediato
+	if (window->configured && (window->wp_tearing_control || !window->mapped)) {
+		waylandWindowPresent(window, clockNowNanoseconds());
+	}
+}
+
+internal void waylandRecordDispatch(WaylandEventStats* stats, int32 event_count, uint64 wake_time)
+{
+	uint64 now = clockNowNanoseconds();
+	if (event_count > 0) {
+		stats->queue_depth = (uint32)event_count;
+		stats->total_events += event_count;
+		stats->window_events += event_count;
+		stats->dispatch_time = clockNanosecondsToMilliseconds(now - wake_time);
+		if (stats->dispatch_time > stats->window_max_dispatch_time) {
+			stats->window_max_dispatch_time = stats->dispatch_time;
+		}
+	}
+	if (stats->window_start == 0) {
+		stats->window_start = now;
+	} else if (now - stats->window_start >= EVENT_STATS_WINDOW) {
+		stats->events_per_second = (float32)((float64)stats->window_events * NANOSECONDS_PER_SECOND
+				/ (float64)(now - stats->window_start));
+		stats->max_dispatch_time = stats->window_max_dispatch_time;
+		stats->window_events = 0;
+		stats->window_max_dispatch_time = 0;
+		stats->window_start = now;
+	}
+}
+
+/*
+ * [EN] Waits until wayland messages arrive, any of the wake_fds becomes readable or timeout
+ * milliseconds pass (-1 waits forever), then dispatches the queued wayland messages. Owners of the
+ * wake_fds handle them after this returns.
+ * [ES] Espera hasta que lleguen mensajes wayland, cualquiera de los wake_fds sea legible o pasen
+ * timeout milisegundos (-1 espera para siempre), después despacha los mensajes wayland acumulados.
+ * Los dueños de los wake_fds los atienden al regresar.
+ */
+internal void waylandUpdate(WaylandServerState* server, const int32* wake_fds, int32 wake_fd_count,
+		int32 timeout)
+{
+	assert(wake_fd_count <= MAX_WAKE_FDS, "Too many file descriptors for the event loop");
+	struct wl_display* display = server->wl_display;
+	int32 event_count = 0;
+	uint64 wake_time = clockNowNanoseconds();
+	while (wl_display_prepare_read(display) != 0) { // the queue must be empty to read
+		int32 dispatched = wl_display_dispatch_pending(display);
+		event_count += (dispatched > 0) ? dispatched : 0;
+	}
+	waylandRecordDispatch(&server->events, event_count, wake_time);
+	wl_display_flush(display); // send queued requests
+
+	struct pollfd fds[1 + MAX_WAKE_FDS];
+	int32 fd_count = 0;
+	fds[fd_count++] = (struct pollfd){ .fd = wl_display_get_fd(display), .events = POLLIN };
+	for (int32 i = 0; i < wake_fd_count; ++i) {
+		if (wake_fds[i] >= 0) {
+			fds[fd_count++] = (struct pollfd){ .fd = wake_fds[i], .events = POLLIN };
+		}
+	}
+	bool8 readable = poll(fds, fd_count, timeout) > 0 && (fds[0].revents & POLLIN);
+	wake_time = clockNowNanoseconds();
+	if (readable) {
+		wl_display_read_events(display);
+	} else {
+		wl_display_cancel_read(display);
+	}
+	event_count = wl_display_dispatch_pending(display); // process queued events
+	waylandRecordDispatch(&server->events, (event_count > 0) ? event_count : 0, wake_time);
+	wl_display_flush(display); // send queued requests
 }
 
 /* 11/12/2025 Luis Arturo Ramos Valencia - kanso engine */
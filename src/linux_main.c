@@ -1,4 +1,6 @@
 #include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
 
 #define KSO_LOG_IMPLEMENTATION
 
@@ -6,14 +8,41 @@
 #include "defines.h"
 #include "types.h"
 #include "render.h"
+#include "asset_pack.h"
+#include "input_log.h"
+#include "frame_capture.h"
+#include "startup_timeline.h"
 
+#include "linux/linux_thread.c"
+#include "linux/linux_clock.c"
+#include "vector_math.c"
+#include "scale.c"
+#include "noise.c"
+#include "raster.c"
+#include "text.c"
+#include "hud.c"
+#include "image.c"
+#include "asset_pack.c"
+#include "linux/linux_asset_pack.c"
+#include "input_log.c"
+#include "linux/linux_input_log.c"
+#include "frame_capture.c"
+#include "linux/linux_frame_capture.c"
+#include "frame_timing.c"
+#include "perf_counters.c"
+#include "linux/linux_perf_counters.c"
+#include "live_stats.c"
+#include "random.c"
+#include "linux/linux_shm.c"
+#include "linux/linux_live_stats.c"
+#include "startup_timeline.c"
+#include "pointer_motion.c"
+#include "shm_blocks.c"
 #include "linux/wayland_window.c" // TODO(vluis): Maybe rename this file to wayland_client.c or do a
 // separation of concerns
 
-void renderGradient(void* buffer, int32 width, int32 height, int32 bytes_per_row,
-		uint32 animation_speed)
+void renderGradient(void* buffer, int32 width, int32 height, int32 bytes_per_row, int32 offset)
 {
-	persist int32 offset = 0;
 	for (int32 row = 0; row < height; ++row) {
 		uint32* pxl = (uint32*)((uint8*)buffer + (row * bytes_per_row));
 		for (int32 col = 0; col < width; ++col) {
@@ -28,26 +57,276 @@ void renderGradient(void* buffer, int32 width, int32 height, int32 bytes_per_row
 			pxl++;
 		}
 	}
-	offset += animation_speed;
 }
 
-int32 main(void)
+#ifndef KSO_ASSET_PACK_PATH
+	#define KSO_ASSET_PACK_PATH "assets.kpk"
+#endif
+
+internal void linuxAssetLoaded(void* context, const AssetPackEntry* entry, const void* data)
+{
+	uint64 start = *(uint64*)context;
+	float32 elapsed = clockNanosecondsToMilliseconds(clockNowNanoseconds() - start);
+	logDebug("Asset %s (%llu bytes) resident after %.3f ms.", entry->name,
+			(unsigned long long)entry->size, elapsed);
+}
+
+#define HEADLESS_FRAME_RATE 60 // virtual clock of headless replays | reloj virtual sin compositor
+
+typedef struct {
+	const char* record_path;
+	const char* replay_path;
+	const char* capture_path; // *.y4m or raw x:R:G:B frames | *.y4m o fotogramas x:R:G:B crudos
+	InputReplayMode replay_mode;
+	bool8 headless;
+	bool8 pacing; // render just in time instead of right after a frame is shown | justo a tiempo
+	bool8 pin_threads; // JOB_AFFINITY_PINNED
+	bool8 perf_counters;
+	int32 window_count; // the main window and more views of the same scene | más vistas
+	bool8 exit_after_first_frame; // time to first frame measurements | mediciones de arranque
+	bool8 tearing; // async presentation, wp_tearing_control_v1 | presentación asíncrona
+} LinuxOptions;
+
+/*
+ * [EN] Usage: linux_main [--record <log>] [--replay <log> [--by-time] [--headless]]
+ *                        [--capture <file>] [--no-pacing] [--pin-threads] [--perf-counters]
+ *                        [--windows <count>] [--exit-after-first-frame] [--tearing]
+ * [ES] Uso: linux_main [--record <registro>] [--replay <registro> [--by-time] [--headless]]
+ *                      [--capture <archivo>] [--no-pacing] [--pin-threads] [--perf-counters]
+ *                      [--windows <cantidad>] [--exit-after-first-frame] [--tearing]
+ */
+[[nodiscard]] internal bool8 linuxParseOptions(LinuxOptions* options, int32 argc, char** argv)
 {
+	*options = (LinuxOptions){ .replay_mode = INPUT_REPLAY_BY_FRAME, .pacing = true,
+		.window_count = 1 };
+	for (int32 i = 1; i < argc; ++i) {
+		if (!strcmp(argv[i], "--record") && i + 1 < argc) {
+			options->record_path = argv[++i];
+		} else if (!strcmp(argv[i], "--replay") && i + 1 < argc) {
+			options->replay_path = argv[++i];
+		} else if (!strcmp(argv[i], "--capture") && i + 1 < argc) {
+			options->capture_path = argv[++i];
+		} else if (!strcmp(argv[i], "--by-time")) {
+			options->replay_mode = INPUT_REPLAY_BY_TIME;
+		} else if (!strcmp(argv[i], "--headless")) {
+			options->headless = true;
+		} else if (!strcmp(argv[i], "--no-pacing")) {
+			options->pacing = false;
+		} else if (!strcmp(argv[i], "--pin-threads")) {
+			options->pin_threads = true;
+		} else if (!strcmp(argv[i], "--perf-counters")) {
+			options->perf_counters = true;
+		} else if (!strcmp(argv[i], "--exit-after-first-frame")) {
+			options->exit_after_first_frame = true;
+		} else if (!strcmp(argv[i], "--tearing")) {
+			options->tearing = true;
+		} else if (!strcmp(argv[i], "--windows") && i + 1 < argc) {
+			options->window_count = atoi(argv[++i]);
+			if (options->window_count < 1 || options->window_count > MAX_WINDOWS) {
+				return false;
+			}
+		} else {
+			return false;
+		}
+	}
+	return !(options->headless && !options->replay_path)
+		&& !(options->record_path && options->replay_path);
+}
+
+/*
+ * [EN] Replays an input log without a compositor, rendering into plain memory as fast as possible,
+ * one frame per step of the recorded simulation. Time driven replays advance a virtual clock by one
+ * frame of HEADLESS_FRAME_RATE per frame.
+ * [ES] Repite un registro de entrada sin compositor, dibujando en memoria simple tan rápido como se
+ * pueda, un fotograma por paso de la simulación grabada. Las repeticiones por tiempo avanzan un
+ * reloj virtual un fotograma de HEADLESS_FRAME_RATE por fotograma.
+ */
+internal int32 linuxReplayHeadless(InputReplay* replay)
+{
+	WaylandClientState client = { .input_replay = replay };
+	FixedTimestep timestep;
+	fixedTimestepInitialize(&timestep, SIMULATION_TICK_RATE, 0);
+	int32 bytes_per_row = STD_WIDTH * BYTES_PER_PXL;
+	void* memory = malloc((uint64)bytes_per_row * STD_HEIGHT);
+	if (!memory) {
+		logFatal("Out of memory.");
+		return EXIT_FAILURE;
+	}
+
+	uint64 total_time = 0;
+	uint64 max_time = 0;
+	while (!inputReplayFinished(replay)) {
+		uint64 virtual_now = ((uint64)client.frame_index * NANOSECONDS_PER_SECOND)
+			/ HEADLESS_FRAME_RATE;
+		float32 interpolation = waylandSimulateFrame(&client, &timestep, virtual_now);
+		uint64 start = clockNowNanoseconds();
+		renderGradient(memory, STD_WIDTH, STD_HEIGHT, bytes_per_row,
+				waylandInterpolateGradientOffset(&client, interpolation));
+		uint64 elapsed = clockNowNanoseconds() - start;
+		total_time += elapsed;
+		max_time = (elapsed > max_time) ? elapsed : max_time;
+		client.frame_index++;
+	}
+	free(memory);
+
+	uint32 frames = (client.frame_index > 0) ? client.frame_index : 1;
+	printf("Replayed %u frames: render %.3f ms average, %.3f ms max.\n", client.frame_index,
+			clockNanosecondsToMilliseconds(total_time / frames),
+			clockNanosecondsToMilliseconds(max_time));
+	return EXIT_SUCCESS;
+}
+
+int32 main(int32 argc, char** argv)
+{
+	StartupTimeline startup;
+	startupTimelineInitialize(&startup);
+	LinuxOptions options;
+	if (!linuxParseOptions(&options, argc, argv)) {
+		fprintf(stderr, "Usage: %s [--record <log>] [--replay <log> [--by-time] [--headless]] "
+				"[--capture <file>] [--no-pacing] [--pin-threads] [--perf-counters] "
+				"[--windows <1-%d>] [--exit-after-first-frame] [--tearing]\n", argv[0],
+				MAX_WINDOWS);
+		return EXIT_FAILURE;
+	}
+	if (!jobSystemStart(0, options.pin_threads ? JOB_AFFINITY_PINNED : JOB_AFFINITY_NONE)) {
+		return EXIT_FAILURE;
+	}
+	InputRecorder input_recorder = { .fd = -1 };
+	InputReplay input_replay = { 0 };
+	if (options.replay_path) {
+		if (!inputReplayOpen(&input_replay, options.replay_path, options.replay_mode)) {
+			return EXIT_FAILURE;
+		}
+		if (options.headless) {
+			int32 result = linuxReplayHeadless(&input_replay);
+			inputReplayClose(&input_replay);
+			jobSystemStop();
+			return result;
+		}
+	}
+	if (options.record_path && !inputRecorderOpen(&input_recorder, options.record_path)) {
+		return EXIT_FAILURE;
+	}
+
 	WaylandState wayland_state = { 0 };
 	WaylandServerState* wayland_server = &wayland_state.server;
 	WaylandClientState* wayland_client = &wayland_state.client;
+	wayland_client->input_recorder = options.record_path ? &input_recorder : nullptr;
+	wayland_client->input_replay = options.replay_path ? &input_replay : nullptr;
+	wayland_client->startup = &startup;
+	wayland_client->tearing = options.tearing;
+
+	FrameCapture frame_capture = { 0 };
+	if (options.capture_path) {
+		uint64 length = strlen(options.capture_path);
+		bool8 y4m = length >= 4 && !strcmp(options.capture_path + length - 4, ".y4m");
+		if (!frameCaptureStart(&frame_capture, options.capture_path,
+					y4m ? FRAME_CAPTURE_Y4M : FRAME_CAPTURE_RAW)) {
+			return EXIT_FAILURE;
+		}
+		wayland_client->frame_capture = &frame_capture;
+	}
 
 	waylandSetListeners(&wayland_server->listeners);
+	waylandClientPrepare(&wayland_state);
 	waylandServerConnect(&wayland_state);
 	waylandClientInitialize(&wayland_state);
+	for (int32 i = 1; i < options.window_count; ++i) {
+		char title[32];
+		snprintf(title, sizeof(title), "kanso (%d)", i + 1);
+		if (!waylandWindowOpen(&wayland_state, title)) {
+			break;
+		}
+	}
 
+	// [EN] Opened on the render thread, the counters follow it | [ES] Siguen al hilo de dibujo
+	PerfCounters perf_counters = { 0 };
+	if (options.perf_counters && perfCountersOpen(&perf_counters)) {
+		wayland_client->perf_counters = &perf_counters;
+	}
+	LiveStatsSegment live_stats = { 0 };
+	if (liveStatsCreate(&live_stats)) { // watch with kanso_stats | observar con kanso_stats
+		wayland_client->live_stats = live_stats.page;
+	}
+
+	// [EN] Optional: the engine runs without assets | [ES] Opcional: el motor corre sin recursos
+	AssetPack asset_pack = { 0 };
+	AssetLoader asset_loader = { 0 };
+	uint64 asset_load_start = clockNowNanoseconds();
+	if (assetPackOpen(&asset_pack, KSO_ASSET_PACK_PATH)
+			&& assetLoaderStart(&asset_loader, &asset_pack)) {
+		for (uint32 i = 0; i < asset_pack.header->entry_count; ++i) { // prefetch everything
+			if (!assetLoaderRequest(&asset_loader, &asset_pack.entries[i], linuxAssetLoaded,
+						&asset_load_start)) {
+				break;
+			}
+		}
+	}
+	int32 wake_fds[] = { assetLoaderGetWakeFd(&asset_loader) };
+
+	/*
+	 * [EN] Each window renders one frame per frame callback of its own surface. With pacing it
+	 * starts at the window's render deadline, otherwise as soon as its previous frame was attached
+	 * (how the loop used to work). With --tearing the main window renders whenever a buffer is free
+	 * and commits the frame right away, the pacer doesn't apply. The HUD shows the latency from
+	 * sampling the state to attaching the frame for all of them. The simulation advances once per
+	 * pass, before the first window that is due. Poll timeouts round up to whole milliseconds, a
+	 * window woken before its deadline isn't due yet and the loop would spin until it is.
+	 * [ES] Cada ventana dibuja un fotograma por 'callback' de fotograma de su propia superficie.
+	 * Con ritmo empieza en el límite para dibujar de la ventana, si no en cuanto su fotograma
+	 * anterior se asignó (como funcionaba el ciclo). Con --tearing la ventana principal dibuja
+	 * cuando hay un 'buffer' libre y confirma el fotograma de inmediato, el ritmo no aplica. El
+	 * panel muestra la latencia desde la lectura del estado hasta el 'attach' del fotograma en
+	 * todos los casos. La simulación avanza una vez por pasada, antes de la primera ventana a la
+	 * que le toca. Los tiempos de espera de poll se redondean hacia arriba a milisegundos
+	 * completos, una ventana despertada antes de su límite aún no está lista y el ciclo giraría
+	 * hasta que lo esté.
+	 */
+	FixedTimestep timestep;
+	fixedTimestepInitialize(&timestep, SIMULATION_TICK_RATE, clockNowNanoseconds());
 	wayland_client->running = true;
 	while (wayland_client->running) {
-		waylandUpdateRenderingSystem(wayland_client);
-		waylandUpdate(wayland_server);
+		int32 timeout = -1; // rendered frames wait for their callbacks | los fotogramas esperan
+		uint64 now = clockNowNanoseconds();
+		bool8 simulated = false;
+		float32 interpolation = 0;
+		for (int32 i = 0; i < MAX_WINDOWS; ++i) {
+			WaylandWindow* window = &wayland_client->windows[i];
+			uint64 wait;
+			if (waylandWindowFrameDue(window, now, options.pacing, &wait)) {
+				if (!simulated) {
+					interpolation = waylandSimulateFrame(wayland_client, &timestep, now);
+					simulated = true;
+				}
+				waylandUpdateRenderingSystem(wayland_client, window, &wayland_server->events,
+						interpolation);
+				// [EN] Async presentation may have another free buffer | [ES] Otro 'buffer' libre
+				if (waylandWindowFrameDue(window, clockNowNanoseconds(), options.pacing, &wait)) {
+					timeout = 0;
+				}
+			} else if (wait > 0) {
+				int32 wait_time = (int32)((wait + NANOSECONDS_PER_MILLISECOND - 1)
+						/ NANOSECONDS_PER_MILLISECOND);
+				timeout = (timeout < 0 || wait_time < timeout) ? wait_time : timeout;
+			}
+		}
+		waylandUpdate(wayland_server, wake_fds, sizeof(wake_fds) / sizeof(wake_fds[0]), timeout);
+		assetLoaderDispatch(&asset_loader);
+		if (options.exit_after_first_frame && startup.times[STARTUP_FIRST_SHOWN] != 0) {
+			wayland_client->running = false;
+		}
 	}
 
+	frameCaptureStop(&frame_capture);
+	perfCountersClose(&perf_counters);
+	liveStatsClose(&live_stats);
+	assetLoaderStop(&asset_loader);
+	assetPackClose(&asset_pack);
+	waylandClientDestroy(&wayland_state);
 	waylandServerDisconnect(wayland_server);
+	inputRecorderClose(&input_recorder);
+	inputReplayClose(&input_replay);
+	jobSystemStop();
 
 	return EXIT_SUCCESS; // finalizar con éxito
 }
@@ -0,0 +1,53 @@
+/* live_stats.c: shared memory live metrics seqlock | 'seqlock' de métricas en vivo */
+
+#include "defines.h"
+#include "types.h"
+#include "live_stats.h"
+
+#include <string.h>
+
+#define LIVE_STATS_READ_RETRIES 64 // the writer holds the lock for a few stores | pocas escrituras
+
+LiveStats* liveStatsBeginWrite(LiveStatsPage* page)
+{
+	uint32 sequence = atomic_load_explicit(&page->sequence, memory_order_relaxed);
+	atomic_store_explicit(&page->sequence, sequence + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release); // odd before any stat | impar antes de los datos
+	return &page->stats;
+}
+
+void liveStatsEndWrite(LiveStatsPage* page)
+{
+	uint32 sequence = atomic_load_explicit(&page->sequence, memory_order_relaxed);
+	atomic_store_explicit(&page->sequence, sequence + 1, memory_order_release);
+}
+
+bool8 liveStatsRead(const LiveStatsPage* page, LiveStats* stats)
+{
+	atomic_uint* sequence = (atomic_uint*)&page->sequence;
+	for (int32 i = 0; i < LIVE_STATS_READ_RETRIES; ++i) {
+		uint32 before = atomic_load_explicit(sequence, memory_order_acquire);
+		if (before & 1) {
+			continue;
+		}
+		memcpy(stats, &page->stats, sizeof(*stats));
+		atomic_thread_fence(memory_order_acquire); // copy before the check | copia antes
+		if (atomic_load_explicit(sequence, memory_order_relaxed) == before) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int32 liveStatsHistogramBucket(float32 frame_time)
+{
+	if (!(frame_time > 0)) {
+		return 0;
+	}
+	if (frame_time >= LIVE_STATS_HISTOGRAM_BUCKETS - 1) { // before the cast, may be inf | antes
+		return LIVE_STATS_HISTOGRAM_BUCKETS - 1;
+	}
+	return (int32)frame_time;
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,80 @@
+/* live_stats.h: shared memory live metrics declarations | declaraciones de métricas en vivo */
+
+#pragma once
+#include "types.h"
+
+#include <stdatomic.h>
+
+/*
+ * [EN] Every running instance publishes a LiveStatsPage in the shared memory object named
+ * LIVE_STATS_NAME_FORMAT with its pid, so external tools can watch it without a debugger or logs.
+ * The page is a seqlock: the render thread makes sequence odd, updates the stats with plain stores
+ * and makes it even again; readers copy the stats and retry when sequence was odd or changed
+ * meanwhile. The writer never waits for readers.
+ * Readers accept a page only with the same magic, version and size. Change LIVE_STATS_VERSION
+ * whenever LiveStats changes.
+ * [ES] Cada instancia en ejecución publica una LiveStatsPage en el objeto de memoria compartida
+ * llamado LIVE_STATS_NAME_FORMAT con su pid, así herramientas externas pueden observarla sin un
+ * depurador ni registros. La página es un 'seqlock': el hilo de dibujo vuelve impar sequence,
+ * actualiza las estadísticas con escrituras simples y lo vuelve par de nuevo; los lectores copian
+ * las estadísticas y reintentan cuando sequence era impar o cambió mientras tanto. El escritor
+ * nunca espera a los lectores.
+ * Los lectores sólo aceptan una página con la misma firma, versión y tamaño. Cambia
+ * LIVE_STATS_VERSION cada vez que LiveStats cambie.
+ */
+#define LIVE_STATS_MAGIC 0x5453'4B4C // "LKST" little endian
+#define LIVE_STATS_VERSION 2
+#define LIVE_STATS_NAME_FORMAT "/kanso_stats_%d"
+#define LIVE_STATS_NAME_SIZE 32
+#define LIVE_STATS_HISTOGRAM_BUCKETS 34 // 1 ms each, the last one open | el último abierto
+
+typedef enum {
+	LIVE_STATS_PRESENTATION_VSYNC, // committed at frame callbacks | en los 'callbacks' de fotograma
+	LIVE_STATS_PRESENTATION_ASYNC, // committed once rendered, may tear | al dibujarse, puede rasgar
+} LiveStatsPresentationMode;
+
+typedef struct {
+	uint64 update_time; // nanoseconds, writer's clockNowNanoseconds() | del escritor
+	uint64 frame_count;
+	uint64 events_dispatched;
+	float32 frame_time; // milliseconds | milisegundos
+	float32 render_time; // milliseconds | milisegundos
+	float32 presentation_latency; // milliseconds | milisegundos
+	uint32 presentation_mode; // LiveStatsPresentationMode
+	float32 events_per_second;
+	float32 max_event_dispatch_time; // milliseconds | milisegundos
+	uint32 event_queue_depth; // events handled by the last dispatch | eventos del último despacho
+	uint32 buffers_busy; // held by the compositor | retenidos por el compositor
+	uint32 buffer_count;
+	uint32 frame_time_histogram[LIVE_STATS_HISTOGRAM_BUCKETS]; // running counts | conteos
+} LiveStats;
+
+typedef struct {
+	uint32 magic;
+	uint32 version;
+	uint32 size; // sizeof(LiveStatsPage)
+	int32 pid;
+	atomic_uint sequence; // odd while the writer updates stats | impar mientras se actualiza
+	uint32 reserved;
+	LiveStats stats;
+} LiveStatsPage;
+
+static_assert(sizeof(atomic_uint) == sizeof(uint32), "Unexpected atomic_uint size");
+
+LiveStats* liveStatsBeginWrite(LiveStatsPage* page);
+void liveStatsEndWrite(LiveStatsPage* page);
+[[nodiscard]] bool8 liveStatsRead(const LiveStatsPage* page, LiveStats* stats);
+int32 liveStatsHistogramBucket(float32 frame_time);
+
+/* platform | plataforma */
+typedef struct {
+	LiveStatsPage* page;
+	char name[LIVE_STATS_NAME_SIZE];
+	bool8 owner; // created it, unlinks it | lo creó, lo desvincula
+} LiveStatsSegment;
+
+[[nodiscard]] bool8 liveStatsCreate(LiveStatsSegment* segment); // this process | este proceso
+[[nodiscard]] bool8 liveStatsAttach(LiveStatsSegment* segment, int32 pid); // read only | lectura
+void liveStatsClose(LiveStatsSegment* segment);
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,455 @@
+/* noise.c: procedural noise | ruido procedural */
+
+#include "defines.h"
+#include "types.h"
+#include "render.h"
+#include "noise.h"
+#include "thread.h"
+
+#include <string.h>
+
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#endif
+
+#define NOISE_MIN_ROWS_PER_THREAD 16
+#define NOISE_MIN_PIXELS_FOR_THREADS (128 * 128) // smaller targets are filled on the calling thread
+
+#define NOISE_HASH_X 0x8da6'b343u // large odd constants | constantes impares grandes
+#define NOISE_HASH_Y 0xd816'3841u
+#define NOISE_HASH_OCTAVE 0x9e37'79b9u
+#define NOISE_UNIT 0x1.0p-24f // 24 hash bits to [0, 1) | 24 bits del 'hash' a [0, 1)
+#define NOISE_SIMPLEX_SKEW 0.36602540378f // (sqrt(3) - 1) / 2
+#define NOISE_SIMPLEX_UNSKEW 0.21132486540f // (3 - sqrt(3)) / 6
+#define NOISE_SIMPLEX_SCALE 70.0f // brings the sum to about [-1, 1] | lleva la suma a [-1, 1]
+
+/*
+ * [EN] Wide types and operations, the kernels are written once on top of them and evaluate
+ * NOISE_LANES pixels per call: 8 with AVX2, 4 with SSE2 and 1 otherwise. Masks are integers, all
+ * ones where true. Only exact IEEE operations are used, so every width gives the same bits.
+ * [ES] Tipos y operaciones anchas, los núcleos se escriben una vez sobre ellas y evalúan
+ * NOISE_LANES píxeles por llamada: 8 con AVX2, 4 con SSE2 y 1 de otra forma. Las máscaras son
+ * enteros, todos unos donde son verdaderas. Solo se usan operaciones IEEE exactas, así que cada
+ * ancho da los mismos bits.
+ */
+#if defined(__AVX2__)
+	#define NOISE_LANES 8
+typedef __m256 NoiseWide;
+typedef __m256i NoiseWideInt;
+
+internal inline NoiseWide noiseWideSet(float32 value) { return _mm256_set1_ps(value); }
+internal inline NoiseWide noiseWideLanes(void) { return _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7); }
+internal inline NoiseWide noiseWideAdd(NoiseWide a, NoiseWide b) { return _mm256_add_ps(a, b); }
+internal inline NoiseWide noiseWideSub(NoiseWide a, NoiseWide b) { return _mm256_sub_ps(a, b); }
+internal inline NoiseWide noiseWideMul(NoiseWide a, NoiseWide b) { return _mm256_mul_ps(a, b); }
+internal inline NoiseWide noiseWideMin(NoiseWide a, NoiseWide b) { return _mm256_min_ps(a, b); }
+internal inline NoiseWide noiseWideMax(NoiseWide a, NoiseWide b) { return _mm256_max_ps(a, b); }
+internal inline NoiseWideInt noiseWideGreater(NoiseWide a, NoiseWide b)
+{
+	return _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_GT_OQ));
+}
+internal inline NoiseWideInt noiseWideToInt(NoiseWide a) { return _mm256_cvttps_epi32(a); }
+internal inline NoiseWide noiseWideFromInt(NoiseWideInt a) { return _mm256_cvtepi32_ps(a); }
+internal inline NoiseWide noiseWideFlipSign(NoiseWide a, NoiseWideInt sign) // sign: bit 31
+{
+	return _mm256_xor_ps(a, _mm256_castsi256_ps(sign));
+}
+internal inline NoiseWideInt noiseWideIntSet(uint32 value)
+{
+	return _mm256_set1_epi32((int32)value);
+}
+internal inline NoiseWideInt noiseWideIntAdd(NoiseWideInt a, NoiseWideInt b)
+{
+	return _mm256_add_epi32(a, b);
+}
+internal inline NoiseWideInt noiseWideIntSub(NoiseWideInt a, NoiseWideInt b)
+{
+	return _mm256_sub_epi32(a, b);
+}
+internal inline NoiseWideInt noiseWideIntMul(NoiseWideInt a, NoiseWideInt b)
+{
+	return _mm256_mullo_epi32(a, b);
+}
+internal inline NoiseWideInt noiseWideIntXor(NoiseWideInt a, NoiseWideInt b)
+{
+	return _mm256_xor_si256(a, b);
+}
+internal inline NoiseWideInt noiseWideIntAnd(NoiseWideInt a, NoiseWideInt b)
+{
+	return _mm256_and_si256(a, b);
+}
+internal inline NoiseWideInt noiseWideIntOr(NoiseWideInt a, NoiseWideInt b)
+{
+	return _mm256_or_si256(a, b);
+}
+internal inline NoiseWideInt noiseWideIntShiftLeft(NoiseWideInt a, int32 k)
+{
+	return _mm256_slli_epi32(a, k);
+}
+internal inline NoiseWideInt noiseWideIntShiftRight(NoiseWideInt a, int32 k)
+{
+	return _mm256_srli_epi32(a, k);
+}
+internal inline void noiseWideIntStore(uint32* p, NoiseWideInt a)
+{
+	_mm256_storeu_si256((__m256i*)p, a);
+}
+internal inline void noiseWideStore(float32* p, NoiseWide a) { _mm256_storeu_ps(p, a); }
+#elif defined(__SSE2__)
+	#define NOISE_LANES 4
+typedef __m128 NoiseWide;
+typedef __m128i NoiseWideInt;
+
+internal inline NoiseWide noiseWideSet(float32 value) { return _mm_set1_ps(value); }
+internal inline NoiseWide noiseWideLanes(void) { return _mm_setr_ps(0, 1, 2, 3); }
+internal inline NoiseWide noiseWideAdd(NoiseWide a, NoiseWide b) { return _mm_add_ps(a, b); }
+internal inline NoiseWide noiseWideSub(NoiseWide a, NoiseWide b) { return _mm_sub_ps(a, b); }
+internal inline NoiseWide noiseWideMul(NoiseWide a, NoiseWide b) { return _mm_mul_ps(a, b); }
+internal inline NoiseWide noiseWideMin(NoiseWide a, NoiseWide b) { return _mm_min_ps(a, b); }
+internal inline NoiseWide noiseWideMax(NoiseWide a, NoiseWide b) { return _mm_max_ps(a, b); }
+internal inline NoiseWideInt noiseWideGreater(NoiseWide a, NoiseWide b)
+{
+	return _mm_castps_si128(_mm_cmpgt_ps(a, b));
+}
+internal inline NoiseWideInt noiseWideToInt(NoiseWide a) { return _mm_cvttps_epi32(a); }
+internal inline NoiseWide noiseWideFromInt(NoiseWideInt a) { return _mm_cvtepi32_ps(a); }
+internal inline NoiseWide noiseWideFlipSign(NoiseWide a, NoiseWideInt sign)
+{
+	return _mm_xor_ps(a, _mm_castsi128_ps(sign));
+}
+internal inline NoiseWideInt noiseWideIntSet(uint32 value) { return _mm_set1_epi32((int32)value); }
+internal inline NoiseWideInt noiseWideIntAdd(NoiseWideInt a, NoiseWideInt b)
+{
+	return _mm_add_epi32(a, b);
+}
+internal inline NoiseWideInt noiseWideIntSub(NoiseWideInt a, NoiseWideInt b)
+{
+	return _mm_sub_epi32(a, b);
+}
+/*
+ * [EN] Low 32 bits of each product, SSE2 only multiplies the even lanes into 64 bits.
+ * [ES] Los 32 bits bajos de cada producto, SSE2 solo multiplica los carriles pares a 64 bits.
+ */
+internal inline NoiseWideInt noiseWideIntMul(NoiseWideInt a, NoiseWideInt b)
+{
+	__m128i even = _mm_mul_epu32(a, b);
+	__m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+			_mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+internal inline NoiseWideInt noiseWideIntXor(NoiseWideInt a, NoiseWideInt b)
+{
+	return _mm_xor_si128(a, b);
+}
+internal inline NoiseWideInt noiseWideIntAnd(NoiseWideInt a, NoiseWideInt b)
+{
+	return _mm_and_si128(a, b);
+}
+internal inline NoiseWideInt noiseWideIntOr(NoiseWideInt a, NoiseWideInt b)
+{
+	return _mm_or_si128(a, b);
+}
+internal inline NoiseWideInt noiseWideIntShiftLeft(NoiseWideInt a, int32 k)
+{
+	return _mm_slli_epi32(a, k);
+}
+internal inline NoiseWideInt noiseWideIntShiftRight(NoiseWideInt a, int32 k)
+{
+	return _mm_srli_epi32(a, k);
+}
+internal inline void noiseWideIntStore(uint32* p, NoiseWideInt a)
+{
+	_mm_storeu_si128((__m128i*)p, a);
+}
+internal inline void noiseWideStore(float32* p, NoiseWide a) { _mm_storeu_ps(p, a); }
+#else
+	#define NOISE_LANES 1
+typedef float32 NoiseWide;
+typedef uint32 NoiseWideInt;
+
+internal inline NoiseWide noiseWideSet(float32 value) { return value; }
+internal inline NoiseWide noiseWideLanes(void) { return 0; }
+internal inline NoiseWide noiseWideAdd(NoiseWide a, NoiseWide b) { return a + b; }
+internal inline NoiseWide noiseWideSub(NoiseWide a, NoiseWide b) { return a - b; }
+internal inline NoiseWide noiseWideMul(NoiseWide a, NoiseWide b) { return a * b; }
+internal inline NoiseWide noiseWideMin(NoiseWide a, NoiseWide b) { return (a < b) ? a : b; }
+internal inline NoiseWide noiseWideMax(NoiseWide a, NoiseWide b) { return (a > b) ? a : b; }
+internal inline NoiseWideInt noiseWideGreater(NoiseWide a, NoiseWide b) { return -(uint32)(a > b); }
+internal inline NoiseWideInt noiseWideToInt(NoiseWide a) { return (uint32)(int32)a; }
+internal inline NoiseWide noiseWideFromInt(NoiseWideInt a) { return (float32)(int32)a; }
+internal inline NoiseWide noiseWideFlipSign(NoiseWide a, NoiseWideInt sign)
+{
+	uint32 bits;
+	memcpy(&bits, &a, sizeof(bits));
+	bits ^= sign;
+	memcpy(&a, &bits, sizeof(a));
+	return a;
+}
+internal inline NoiseWideInt noiseWideIntSet(uint32 value) { return value; }
+internal inline NoiseWideInt noiseWideIntAdd(NoiseWideInt a, NoiseWideInt b) { return a + b; }
+internal inline NoiseWideInt noiseWideIntSub(NoiseWideInt a, NoiseWideInt b) { return a - b; }
+internal inline NoiseWideInt noiseWideIntMul(NoiseWideInt a, NoiseWideInt b) { return a * b; }
+internal inline NoiseWideInt noiseWideIntXor(NoiseWideInt a, NoiseWideInt b) { return a ^ b; }
+internal inline NoiseWideInt noiseWideIntAnd(NoiseWideInt a, NoiseWideInt b) { return a & b; }
+internal inline NoiseWideInt noiseWideIntOr(NoiseWideInt a, NoiseWideInt b) { return a | b; }
+internal inline NoiseWideInt noiseWideIntShiftLeft(NoiseWideInt a, int32 k) { return a << k; }
+internal inline NoiseWideInt noiseWideIntShiftRight(NoiseWideInt a, int32 k) { return a >> k; }
+internal inline void noiseWideIntStore(uint32* p, NoiseWideInt a) { *p = a; }
+internal inline void noiseWideStore(float32* p, NoiseWide a) { *p = a; }
+#endif
+
+typedef NoiseWide NoiseKernel(NoiseWide x, NoiseWide y, NoiseWideInt seed);
+
+typedef struct {
+	Bitmap* target;
+	const NoiseParameters* parameters;
+	NoiseKernel* kernel;
+} NoiseJob;
+
+/*
+ * [EN] Exact floor: truncation rounds negative non-integers up, -1 where that happened.
+ * [ES] Piso exacto: el truncamiento redondea hacia arriba los negativos no enteros, -1 donde pasó.
+ */
+internal inline NoiseWide noiseWideFloor(NoiseWide a)
+{
+	NoiseWide truncated = noiseWideFromInt(noiseWideToInt(a));
+	return noiseWideAdd(truncated, noiseWideFromInt(noiseWideGreater(truncated, a)));
+}
+
+internal inline NoiseWide noiseWideLerp(NoiseWide a, NoiseWide b, NoiseWide t)
+{
+	return noiseWideAdd(a, noiseWideMul(noiseWideSub(b, a), t));
+}
+
+/*
+ * [EN] Hash of the lattice point whose coordinates were already multiplied by NOISE_HASH_X and
+ * NOISE_HASH_Y, a murmur3 style finalizer mixes every input bit into every output bit.
+ * [ES] 'Hash' del punto de la retícula cuyas coordenadas ya se multiplicaron por NOISE_HASH_X y
+ * NOISE_HASH_Y, un finalizador estilo murmur3 mezcla cada bit de entrada en cada bit de salida.
+ */
+internal inline NoiseWideInt noiseHash(NoiseWideInt hashed_x, NoiseWideInt hashed_y,
+		NoiseWideInt seed)
+{
+	NoiseWideInt h = noiseWideIntXor(noiseWideIntXor(hashed_x, hashed_y), seed);
+	h = noiseWideIntXor(h, noiseWideIntShiftRight(h, 16));
+	h = noiseWideIntMul(h, noiseWideIntSet(0x85eb'ca6bu));
+	h = noiseWideIntXor(h, noiseWideIntShiftRight(h, 13));
+	h = noiseWideIntMul(h, noiseWideIntSet(0xc2b2'ae35u));
+	return noiseWideIntXor(h, noiseWideIntShiftRight(h, 16));
+}
+
+internal inline NoiseWide noiseHashToUnit(NoiseWideInt h)
+{
+	return noiseWideMul(noiseWideFromInt(noiseWideIntShiftRight(h, 8)), noiseWideSet(NOISE_UNIT));
+}
+
+/*
+ * [EN] Dot product of (x, y) with the gradient (+-1, +-1) picked by the two lowest hash bits.
+ * [ES] Producto punto de (x, y) con el gradiente (+-1, +-1) elegido por los dos bits más bajos del
+ * 'hash'.
+ */
+internal inline NoiseWide noiseGradient(NoiseWideInt h, NoiseWide x, NoiseWide y)
+{
+	NoiseWide gx = noiseWideFlipSign(x, noiseWideIntShiftLeft(h, 31));
+	NoiseWide gy = noiseWideFlipSign(y, noiseWideIntShiftLeft(noiseWideIntShiftRight(h, 1), 31));
+	return noiseWideAdd(gx, gy);
+}
+
+internal NoiseWide noiseValueKernel(NoiseWide x, NoiseWide y, NoiseWideInt seed)
+{
+	NoiseWide x0 = noiseWideFloor(x);
+	NoiseWide y0 = noiseWideFloor(y);
+	NoiseWide fx = noiseWideSub(x, x0);
+	NoiseWide fy = noiseWideSub(y, y0);
+	NoiseWideInt hx0 = noiseWideIntMul(noiseWideToInt(x0), noiseWideIntSet(NOISE_HASH_X));
+	NoiseWideInt hy0 = noiseWideIntMul(noiseWideToInt(y0), noiseWideIntSet(NOISE_HASH_Y));
+	NoiseWideInt hx1 = noiseWideIntAdd(hx0, noiseWideIntSet(NOISE_HASH_X));
+	NoiseWideInt hy1 = noiseWideIntAdd(hy0, noiseWideIntSet(NOISE_HASH_Y));
+
+	// [EN] Smoothstep, 3t^2 - 2t^3 | [ES] Paso suave, 3t^2 - 2t^3
+	NoiseWide three = noiseWideSet(3.0f);
+	NoiseWide two = noiseWideSet(2.0f);
+	NoiseWide u = noiseWideMul(noiseWideMul(fx, fx), noiseWideSub(three, noiseWideMul(two, fx)));
+	NoiseWide v = noiseWideMul(noiseWideMul(fy, fy), noiseWideSub(three, noiseWideMul(two, fy)));
+
+	NoiseWide a = noiseWideLerp(noiseHashToUnit(noiseHash(hx0, hy0, seed)),
+			noiseHashToUnit(noiseHash(hx1, hy0, seed)), u);
+	NoiseWide b = noiseWideLerp(noiseHashToUnit(noiseHash(hx0, hy1, seed)),
+			noiseHashToUnit(noiseHash(hx1, hy1, seed)), u);
+	return noiseWideSub(noiseWideMul(noiseWideLerp(a, b, v), two), noiseWideSet(1.0f));
+}
+
+internal NoiseWide noisePerlinKernel(NoiseWide x, NoiseWide y, NoiseWideInt seed)
+{
+	NoiseWide x0 = noiseWideFloor(x);
+	NoiseWide y0 = noiseWideFloor(y);
+	NoiseWide fx = noiseWideSub(x, x0);
+	NoiseWide fy = noiseWideSub(y, y0);
+	NoiseWide one = noiseWideSet(1.0f);
+	NoiseWide gx = noiseWideSub(fx, one);
+	NoiseWide gy = noiseWideSub(fy, one);
+	NoiseWideInt hx0 = noiseWideIntMul(noiseWideToInt(x0), noiseWideIntSet(NOISE_HASH_X));
+	NoiseWideInt hy0 = noiseWideIntMul(noiseWideToInt(y0), noiseWideIntSet(NOISE_HASH_Y));
+	NoiseWideInt hx1 = noiseWideIntAdd(hx0, noiseWideIntSet(NOISE_HASH_X));
+	NoiseWideInt hy1 = noiseWideIntAdd(hy0, noiseWideIntSet(NOISE_HASH_Y));
+
+	// [EN] Quintic fade, 6t^5 - 15t^4 + 10t^3 | [ES] Transición quíntica
+	NoiseWide six = noiseWideSet(6.0f);
+	NoiseWide fifteen = noiseWideSet(15.0f);
+	NoiseWide ten = noiseWideSet(10.0f);
+	NoiseWide u = noiseWideMul(noiseWideMul(noiseWideMul(fx, fx), fx), noiseWideAdd(noiseWideMul(fx,
+					noiseWideSub(noiseWideMul(fx, six), fifteen)), ten));
+	NoiseWide v = noiseWideMul(noiseWideMul(noiseWideMul(fy, fy), fy), noiseWideAdd(noiseWideMul(fy,
+					noiseWideSub(noiseWideMul(fy, six), fifteen)), ten));
+
+	NoiseWide a = noiseWideLerp(noiseGradient(noiseHash(hx0, hy0, seed), fx, fy),
+			noiseGradient(noiseHash(hx1, hy0, seed), gx, fy), u);
+	NoiseWide b = noiseWideLerp(noiseGradient(noiseHash(hx0, hy1, seed), fx, gy),
+			noiseGradient(noiseHash(hx1, hy1, seed), gx, gy), u);
+	return noiseWideLerp(a, b, v);
+}
+
+/*
+ * [EN] Falloff (0.5 - x^2 - y^2)^4 of a simplex corner times its gradient, zero past the radius.
+ * [ES] Atenuación (0.5 - x^2 - y^2)^4 de una esquina del símplex por su gradiente, cero más allá
+ * del radio.
+ */
+internal inline NoiseWide noiseSimplexCorner(NoiseWideInt h, NoiseWide x, NoiseWide y)
+{
+	NoiseWide t = noiseWideSub(noiseWideSub(noiseWideSet(0.5f), noiseWideMul(x, x)),
+			noiseWideMul(y, y));
+	t = noiseWideMax(t, noiseWideSet(0.0f));
+	t = noiseWideMul(t, t);
+	return noiseWideMul(noiseWideMul(t, t), noiseGradient(h, x, y));
+}
+
+internal NoiseWide noiseSimplexKernel(NoiseWide x, NoiseWide y, NoiseWideInt seed)
+{
+	// [EN] Skew to find the cell, the triangle is picked by x0 > y0 | [ES] Sesgo para la celda
+	NoiseWide skew = noiseWideMul(noiseWideAdd(x, y), noiseWideSet(NOISE_SIMPLEX_SKEW));
+	NoiseWide i = noiseWideFloor(noiseWideAdd(x, skew));
+	NoiseWide j = noiseWideFloor(noiseWideAdd(y, skew));
+	NoiseWide unskew = noiseWideMul(noiseWideAdd(i, j), noiseWideSet(NOISE_SIMPLEX_UNSKEW));
+	NoiseWide x0 = noiseWideSub(x, noiseWideSub(i, unskew));
+	NoiseWide y0 = noiseWideSub(y, noiseWideSub(j, unskew));
+	NoiseWideInt lower = noiseWideGreater(x0, y0); // -1: (1, 0) step, 0: (0, 1) step
+	NoiseWide step_i = noiseWideSub(noiseWideSet(0.0f), noiseWideFromInt(lower));
+	NoiseWide step_j = noiseWideSub(noiseWideSet(1.0f), step_i);
+
+	NoiseWide g = noiseWideSet(NOISE_SIMPLEX_UNSKEW);
+	NoiseWide x1 = noiseWideAdd(noiseWideSub(x0, step_i), g);
+	NoiseWide y1 = noiseWideAdd(noiseWideSub(y0, step_j), g);
+	NoiseWide g2 = noiseWideSet(2.0f * NOISE_SIMPLEX_UNSKEW - 1.0f);
+	NoiseWide x2 = noiseWideAdd(x0, g2);
+	NoiseWide y2 = noiseWideAdd(y0, g2);
+
+	NoiseWideInt hi0 = noiseWideIntMul(noiseWideToInt(i), noiseWideIntSet(NOISE_HASH_X));
+	NoiseWideInt hj0 = noiseWideIntMul(noiseWideToInt(j), noiseWideIntSet(NOISE_HASH_Y));
+	NoiseWideInt hi2 = noiseWideIntAdd(hi0, noiseWideIntSet(NOISE_HASH_X));
+	NoiseWideInt hj2 = noiseWideIntAdd(hj0, noiseWideIntSet(NOISE_HASH_Y));
+	NoiseWideInt step_y = noiseWideIntAnd(lower, noiseWideIntSet(NOISE_HASH_Y));
+	NoiseWideInt hi1 = noiseWideIntAdd(hi0, noiseWideIntAnd(lower, noiseWideIntSet(NOISE_HASH_X)));
+	NoiseWideInt hj1 = noiseWideIntSub(hj2, step_y);
+
+	NoiseWide sum = noiseSimplexCorner(noiseHash(hi0, hj0, seed), x0, y0);
+	sum = noiseWideAdd(sum, noiseSimplexCorner(noiseHash(hi1, hj1, seed), x1, y1));
+	sum = noiseWideAdd(sum, noiseSimplexCorner(noiseHash(hi2, hj2, seed), x2, y2));
+	return noiseWideMul(sum, noiseWideSet(NOISE_SIMPLEX_SCALE));
+}
+
+internal NoiseKernel* noiseKernel(NoiseType type)
+{
+	switch (type) {
+	case NOISE_PERLIN: return noisePerlinKernel;
+	case NOISE_SIMPLEX: return noiseSimplexKernel;
+	default: return noiseValueKernel;
+	}
+}
+
+/*
+ * [EN] Kernel output from about [-1, 1] to [0, 1].
+ * [ES] Salida del núcleo de aproximadamente [-1, 1] a [0, 1].
+ */
+internal inline NoiseWide noiseToUnit(NoiseWide value)
+{
+	NoiseWide half = noiseWideSet(0.5f);
+	value = noiseWideAdd(noiseWideMul(value, half), half);
+	return noiseWideMin(noiseWideMax(value, noiseWideSet(0.0f)), noiseWideSet(1.0f));
+}
+
+internal void noiseFillRows(void* context, int32 begin, int32 end)
+{
+	NoiseJob* job = context;
+	const NoiseParameters* parameters = job->parameters;
+	Bitmap* target = job->target;
+	int32 octaves = (parameters->octaves > 0) ? parameters->octaves : 1;
+	float32 amplitude_sum = 0.0f;
+	for (float32 octave = 0, amplitude = 1.0f; octave < octaves; ++octave, amplitude *= 0.5f) {
+		amplitude_sum += amplitude;
+	}
+	NoiseWide normalize = noiseWideSet(1.0f / amplitude_sum);
+	NoiseWide lanes = noiseWideLanes();
+
+	for (int32 row = begin; row < end; ++row) {
+		uint32* pixels = (uint32*)((uint8*)target->memory + ((int64)row * target->bytes_per_row));
+		for (int32 column = 0; column < target->width; column += NOISE_LANES) {
+			// [EN] Column then offset, one rounding per pixel whatever the lane it lands on
+			// [ES] Columna y luego desplazamiento, un redondeo por píxel sin importar el carril
+			NoiseWide px = noiseWideAdd(noiseWideAdd(noiseWideSet((float32)column), lanes),
+					noiseWideSet(parameters->offset_x));
+			NoiseWide py = noiseWideSet((float32)row + parameters->offset_y);
+			NoiseWide sum = noiseWideSet(0.0f);
+			float32 frequency = parameters->frequency;
+			float32 amplitude = 1.0f;
+			uint32 seed = parameters->seed;
+			for (int32 octave = 0; octave < octaves; ++octave) {
+				NoiseWide value = job->kernel(noiseWideMul(px, noiseWideSet(frequency)),
+						noiseWideMul(py, noiseWideSet(frequency)), noiseWideIntSet(seed));
+				sum = noiseWideAdd(sum, noiseWideMul(value, noiseWideSet(amplitude)));
+				frequency *= 2.0f;
+				amplitude *= 0.5f;
+				seed += NOISE_HASH_OCTAVE;
+			}
+
+			// [EN] Gray in R, G and B, opaque x | [ES] Gris en R, G y B, x opaco
+			NoiseWide unit = noiseToUnit(noiseWideMul(sum, normalize));
+			NoiseWideInt gray = noiseWideToInt(noiseWideAdd(noiseWideMul(unit,
+							noiseWideSet(255.0f)), noiseWideSet(0.5f)));
+			NoiseWideInt pxl = noiseWideIntOr(noiseWideIntOr(gray, noiseWideIntShiftLeft(gray, 8)),
+					noiseWideIntOr(noiseWideIntShiftLeft(gray, 16), noiseWideIntSet(0xff00'0000u)));
+			if (column + NOISE_LANES <= target->width) {
+				noiseWideIntStore(&pixels[column], pxl);
+			} else {
+				uint32 last[NOISE_LANES];
+				noiseWideIntStore(last, pxl);
+				memcpy(&pixels[column], last, (uint64)(target->width - column) * sizeof(uint32));
+			}
+		}
+	}
+}
+
+void noiseFill(Bitmap* target, const NoiseParameters* parameters)
+{
+	if (target->width <= 0 || target->height <= 0) {
+		return;
+	}
+	NoiseJob job = { target, parameters, noiseKernel(parameters->type) };
+	if ((int64)target->width * target->height < NOISE_MIN_PIXELS_FOR_THREADS) {
+		noiseFillRows(&job, 0, target->height);
+	} else {
+		threadParallelFor(target->height, NOISE_MIN_ROWS_PER_THREAD, noiseFillRows, &job);
+	}
+}
+
+float32 noiseSample(NoiseType type, uint32 seed, float32 x, float32 y)
+{
+	float32 values[NOISE_LANES];
+	NoiseWide value = noiseKernel(type)(noiseWideSet(x), noiseWideSet(y), noiseWideIntSet(seed));
+	noiseWideStore(values, noiseToUnit(value));
+	return values[0];
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,46 @@
+/* noise.h: procedural noise declarations | declaraciones de ruido procedural */
+
+#pragma once
+#include "types.h"
+#include "render.h"
+
+typedef enum {
+	NOISE_VALUE, // random values at lattice points, blended | valores aleatorios mezclados
+	NOISE_PERLIN, // random gradients at lattice points | gradientes aleatorios en la retícula
+	NOISE_SIMPLEX, // gradients on a triangular lattice, fewer corners | retícula triangular
+} NoiseType;
+
+/*
+ * [EN] Fractal sum of octaves: each one doubles the frequency and halves the amplitude of the
+ * previous one and gets its own seed. offset_x and offset_y scroll the pattern, in pixels.
+ * [ES] Suma fractal de octavas: cada una duplica la frecuencia y reduce a la mitad la amplitud de
+ * la anterior y tiene su propia semilla. offset_x y offset_y desplazan el patrón, en píxeles.
+ */
+typedef struct {
+	NoiseType type;
+	uint32 seed;
+	float32 frequency; // lattice cells per pixel of the first octave | celdas por píxel
+	float32 offset_x;
+	float32 offset_y;
+	int32 octaves; // at least 1 | al menos 1
+} NoiseParameters;
+
+/*
+ * [EN] Fills target with gray pixels from 0 (black) to 255 (white). The value of a pixel depends
+ * only on its coordinates and the parameters, never on the SIMD width or the thread that drew it.
+ * Large targets are split by rows across threads.
+ * [ES] Llena target con píxeles grises de 0 (negro) a 255 (blanco). El valor de un píxel depende
+ * solo de sus coordenadas y los parámetros, nunca del ancho SIMD ni del hilo que lo dibujó. Los
+ * destinos grandes se dividen por filas entre hilos.
+ */
+void noiseFill(Bitmap* target, const NoiseParameters* parameters);
+
+/*
+ * [EN] One octave at a point in lattice units, in [0, 1]. Equal to the value noiseFill() computes
+ * for the same point.
+ * [ES] Una octava en un punto en unidades de la retícula, en [0, 1]. Igual al valor que calcula
+ * noiseFill() para el mismo punto.
+ */
+float32 noiseSample(NoiseType type, uint32 seed, float32 x, float32 y);
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,35 @@
+/* perf_counters.c: per-frame performance counter metrics | métricas de contadores por fotograma */
+
+#include "defines.h"
+#include "types.h"
+#include "clock.h"
+#include "perf_counters.h"
+
+PerfFrameStats perfFrameStatsCompute(const PerfSample* previous, const PerfSample* current,
+		PerfCountersMode mode)
+{
+	// [EN] Multiplexed counters are scaled estimates, they can step back a little
+	// [ES] Los contadores multiplexados son estimaciones escaladas, pueden retroceder un poco
+	float64 delta[PERF_COUNTER_COUNT];
+	for (int32 i = 0; i < PERF_COUNTER_COUNT; ++i) {
+		delta[i] = (current->values[i] > previous->values[i])
+			? (float64)(current->values[i] - previous->values[i]) : 0;
+	}
+
+	PerfFrameStats stats = { .available = current->available, .mode = mode };
+	float64 instructions = delta[PERF_COUNTER_INSTRUCTIONS];
+	if (delta[PERF_COUNTER_CYCLES] > 0) {
+		stats.instructions_per_cycle = (float32)(instructions / delta[PERF_COUNTER_CYCLES]);
+	}
+	if (instructions > 0) {
+		stats.llc_misses_per_kilo_instruction =
+			(float32)(delta[PERF_COUNTER_LLC_MISSES] * 1000 / instructions);
+		stats.dtlb_misses_per_kilo_instruction =
+			(float32)(delta[PERF_COUNTER_DTLB_MISSES] * 1000 / instructions);
+	}
+	stats.cpu_time = (float32)(delta[PERF_COUNTER_TASK_CLOCK] / NANOSECONDS_PER_MILLISECOND);
+	stats.page_faults = (uint64)delta[PERF_COUNTER_PAGE_FAULTS];
+	return stats;
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,65 @@
+/* perf_counters.h: hardware performance counter declarations | declaraciones de contadores */
+
+#pragma once
+#include "types.h"
+
+/*
+ * [EN] Optional per-frame instrumentation of the render thread: one group of counters read
+ * atomically at every frame boundary, the difference between two reads is the work of one frame.
+ * Without hardware counters (virtual machines, perf_event_paranoid) only the software ones open.
+ * Only the render thread is counted, not the whole process: work the job workers do for a frame
+ * is left out. inherit would only follow threads created after the counters open, and the kernel
+ * refuses it for group reads.
+ * [ES] Instrumentación opcional por fotograma del hilo de dibujo: un grupo de contadores leído
+ * atómicamente en cada frontera de fotograma, la diferencia entre dos lecturas es el trabajo de un
+ * fotograma. Sin contadores de 'hardware' (máquinas virtuales, perf_event_paranoid) sólo se abren
+ * los de 'software'. Sólo se cuenta el hilo de dibujo, no todo el proceso: el trabajo que los
+ * hilos de trabajos hacen para un fotograma queda fuera. inherit sólo seguiría a los hilos creados
+ * después de abrir los contadores, y el núcleo lo rechaza para lecturas de grupo.
+ */
+typedef enum {
+	PERF_COUNTER_CYCLES,
+	PERF_COUNTER_INSTRUCTIONS,
+	PERF_COUNTER_LLC_MISSES, // last level cache read misses | fallos de lectura del último nivel
+	PERF_COUNTER_DTLB_MISSES, // data TLB read misses | fallos de lectura de la TLB de datos
+	PERF_COUNTER_PAGE_FAULTS, // software
+	PERF_COUNTER_TASK_CLOCK, // software, nanoseconds on a core | nanosegundos en un núcleo
+	PERF_COUNTER_COUNT
+} PerfCounter;
+
+typedef enum {
+	PERF_COUNTERS_OFF,
+	PERF_COUNTERS_SOFTWARE,
+	PERF_COUNTERS_HARDWARE,
+} PerfCountersMode;
+
+typedef struct {
+	uint64 values[PERF_COUNTER_COUNT]; // running totals | totales acumulados
+	uint32 available; // bit per PerfCounter | bit por PerfCounter
+} PerfSample;
+
+typedef struct {
+	float32 instructions_per_cycle;
+	float32 llc_misses_per_kilo_instruction; // 0 when the counter is missing | 0 si falta
+	float32 dtlb_misses_per_kilo_instruction;
+	float32 cpu_time; // milliseconds on a core | milisegundos en un núcleo
+	uint64 page_faults;
+	uint32 available; // bit per PerfCounter | bit por PerfCounter
+	PerfCountersMode mode;
+} PerfFrameStats;
+
+PerfFrameStats perfFrameStatsCompute(const PerfSample* previous, const PerfSample* current,
+		PerfCountersMode mode);
+
+/* platform | plataforma */
+typedef struct PerfCounters PerfCounters;
+
+/*
+ * [EN] Opens the counters for the calling thread, which must be the one that renders.
+ * [ES] Abre los contadores para el hilo que llama, que debe ser el que dibuja.
+ */
+[[nodiscard]] bool8 perfCountersOpen(PerfCounters* counters);
+void perfCountersClose(PerfCounters* counters);
+PerfFrameStats perfCountersSampleFrame(PerfCounters* counters); // since the previous call | desde
+
+/* 18/10/2026 - kanso engine */
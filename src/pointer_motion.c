@@ -0,0 +1,44 @@
+/* pointer_motion.c: raw pointer motion accumulation | acumulación del movimiento del puntero */
+
+#include "defines.h"
+#include "types.h"
+#include "pointer_motion.h"
+
+#define MICROSECONDS_PER_SECOND 1'000'000.0
+
+void pointerMotionAdd(PointerMotion* motion, uint64 time, int32 dx, int32 dy,
+		int32 unaccelerated_dx, int32 unaccelerated_dy)
+{
+	if (motion->event_count == 0) {
+		motion->first_time = time;
+	}
+	motion->last_time = time;
+	motion->event_count++;
+	motion->dx += dx;
+	motion->dy += dy;
+	motion->unaccelerated_dx += unaccelerated_dx;
+	motion->unaccelerated_dy += unaccelerated_dy;
+}
+
+PointerMotion pointerMotionTake(PointerMotion* motion)
+{
+	PointerMotion taken = *motion;
+	*motion = (PointerMotion){ 0 };
+	return taken;
+}
+
+float32 pointerMotionToFloat32(int64 fixed_delta)
+{
+	return (float32)fixed_delta / POINTER_MOTION_FIXED_ONE;
+}
+
+float32 pointerMotionEventRate(const PointerMotion* motion)
+{
+	if (motion->event_count < 2 || motion->last_time <= motion->first_time) {
+		return 0;
+	}
+	return (float32)((motion->event_count - 1) * MICROSECONDS_PER_SECOND
+			/ (float64)(motion->last_time - motion->first_time));
+}
+
+/* 18/10/2026 - kanso engine */
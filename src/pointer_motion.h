@@ -0,0 +1,43 @@
+/* pointer_motion.h: raw pointer motion declarations | declaraciones del movimiento del puntero */
+
+#pragma once
+#include "types.h"
+
+/*
+ * [EN] Relative pointer motion summed between two frames. The platform adds every event as it
+ * arrives and the renderer takes the sum once per frame, nothing is allocated and no event is
+ * stored. Deltas are exact sums in 24.8 fixed point, how the platform delivers them, so a frame
+ * with thousands of events doesn't drift. The unaccelerated deltas are in device units and aren't
+ * clipped at the window edge; the accelerated ones are the motion the pointer would have done, in
+ * surface pixels.
+ * [ES] Movimiento relativo del puntero sumado entre dos fotogramas. La plataforma suma cada evento
+ * al llegar y quien dibuja toma la suma una vez por fotograma, no se reserva memoria ni se guarda
+ * ningún evento. Los deltas son sumas exactas en punto fijo 24.8, como la plataforma los entrega,
+ * así un fotograma con miles de eventos no se desvía. Los deltas sin aceleración están en unidades
+ * del dispositivo y no se recortan en el borde de la ventana; los acelerados son el movimiento que
+ * habría hecho el puntero, en píxeles de la superficie.
+ */
+#define POINTER_MOTION_FIXED_ONE 256 // 24.8 fixed point | punto fijo 24.8
+
+typedef struct {
+	int64 dx; // accelerated, 24.8 fixed point | acelerado
+	int64 dy;
+	int64 unaccelerated_dx; // 24.8 fixed point | punto fijo 24.8
+	int64 unaccelerated_dy;
+	uint64 first_time; // microseconds, device clock of the first event | reloj del dispositivo
+	uint64 last_time; // microseconds
+	uint32 event_count;
+} PointerMotion;
+
+void pointerMotionAdd(PointerMotion* motion, uint64 time, int32 dx, int32 dy,
+		int32 unaccelerated_dx, int32 unaccelerated_dy);
+PointerMotion pointerMotionTake(PointerMotion* motion); // the sum so far, then empty | luego vacía
+float32 pointerMotionToFloat32(int64 fixed_delta);
+
+/*
+ * [EN] Events per second between the first and the last event of motion, 0 with fewer than two.
+ * [ES] Eventos por segundo entre el primer y el último evento de motion, 0 con menos de dos.
+ */
+float32 pointerMotionEventRate(const PointerMotion* motion);
+
+/* 18/10/2026 - kanso engine */
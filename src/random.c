@@ -0,0 +1,231 @@
+/* random.c: pseudo-random number generation | generación de números pseudoaleatorios */
+
+#include "defines.h"
+#include "types.h"
+#include "random.h"
+
+#include <string.h>
+
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#endif
+
+/*
+ * [EN] Integer lanes for randomWideFill(): RANDOM_LANES streams per register, 8 with AVX2, 4 with
+ * SSE2 and 1 otherwise. The multiplications by 5 and 9 are shifts and adds, SSE2 has no 32-bit
+ * multiply.
+ * [ES] Carriles enteros para randomWideFill(): RANDOM_LANES flujos por registro, 8 con AVX2, 4 con
+ * SSE2 y 1 de otra forma. Las multiplicaciones por 5 y 9 son desplazamientos y sumas, SSE2 no tiene
+ * multiplicación de 32 bits.
+ */
+#if defined(__AVX2__)
+	#define RANDOM_LANES 8
+typedef __m256i RandomLanes;
+
+internal inline RandomLanes randomLanesLoad(const uint32* p)
+{
+	return _mm256_loadu_si256((const __m256i*)p);
+}
+internal inline void randomLanesStore(uint32* p, RandomLanes a)
+{
+	_mm256_storeu_si256((__m256i*)p, a);
+}
+internal inline RandomLanes randomLanesAdd(RandomLanes a, RandomLanes b)
+{
+	return _mm256_add_epi32(a, b);
+}
+internal inline RandomLanes randomLanesXor(RandomLanes a, RandomLanes b)
+{
+	return _mm256_xor_si256(a, b);
+}
+internal inline RandomLanes randomLanesShiftLeft(RandomLanes a, int32 k)
+{
+	return _mm256_slli_epi32(a, k);
+}
+internal inline RandomLanes randomLanesRotate(RandomLanes a, int32 k)
+{
+	return _mm256_or_si256(_mm256_slli_epi32(a, k), _mm256_srli_epi32(a, 32 - k));
+}
+#elif defined(__SSE2__)
+	#define RANDOM_LANES 4
+typedef __m128i RandomLanes;
+
+internal inline RandomLanes randomLanesLoad(const uint32* p)
+{
+	return _mm_loadu_si128((const __m128i*)p);
+}
+internal inline void randomLanesStore(uint32* p, RandomLanes a)
+{
+	_mm_storeu_si128((__m128i*)p, a);
+}
+internal inline RandomLanes randomLanesAdd(RandomLanes a, RandomLanes b)
+{
+	return _mm_add_epi32(a, b);
+}
+internal inline RandomLanes randomLanesXor(RandomLanes a, RandomLanes b)
+{
+	return _mm_xor_si128(a, b);
+}
+internal inline RandomLanes randomLanesShiftLeft(RandomLanes a, int32 k)
+{
+	return _mm_slli_epi32(a, k);
+}
+internal inline RandomLanes randomLanesRotate(RandomLanes a, int32 k)
+{
+	return _mm_or_si128(_mm_slli_epi32(a, k), _mm_srli_epi32(a, 32 - k));
+}
+#else
+	#define RANDOM_LANES 1
+typedef uint32 RandomLanes;
+
+internal inline RandomLanes randomLanesLoad(const uint32* p) { return *p; }
+internal inline void randomLanesStore(uint32* p, RandomLanes a) { *p = a; }
+internal inline RandomLanes randomLanesAdd(RandomLanes a, RandomLanes b) { return a + b; }
+internal inline RandomLanes randomLanesXor(RandomLanes a, RandomLanes b) { return a ^ b; }
+internal inline RandomLanes randomLanesShiftLeft(RandomLanes a, int32 k) { return a << k; }
+internal inline RandomLanes randomLanesRotate(RandomLanes a, int32 k)
+{
+	return (a << k) | (a >> (32 - k));
+}
+#endif
+
+static_assert(RANDOM_WIDE_LANES % RANDOM_LANES == 0, "Wide state must hold whole registers");
+
+#define RANDOM_FLOAT32_UNIT 0x1.0p-24f // 24 random bits fill a float32 mantissa | mantisa
+
+internal inline uint64 randomRotate64(uint64 x, int32 k)
+{
+	return (x << k) | (x >> (64 - k));
+}
+
+/*
+ * [EN] splitmix64, spreads a seed with few set bits over the whole state, which must never be all
+ * zeros.
+ * [ES] splitmix64, reparte una semilla con pocos bits encendidos por todo el estado, que nunca debe
+ * ser todo ceros.
+ */
+internal inline uint64 randomSplitMix64(uint64* seed)
+{
+	uint64 z = (*seed += 0x9e37'79b9'7f4a'7c15ull);
+	z = (z ^ (z >> 30)) * 0xbf58'476d'1ce4'e5b9ull;
+	z = (z ^ (z >> 27)) * 0x94d0'49bb'1331'11ebull;
+	return z ^ (z >> 31);
+}
+
+void randomSeed(Random* random, uint64 seed)
+{
+	for (int32 i = 0; i < 4; ++i) {
+		random->state[i] = randomSplitMix64(&seed);
+	}
+}
+
+uint64 randomNext(Random* random)
+{
+	uint64* s = random->state;
+	uint64 result = randomRotate64(s[1] * 5, 7) * 9;
+	uint64 t = s[1] << 17;
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = randomRotate64(s[3], 45);
+	return result;
+}
+
+/*
+ * [EN] Lemire's multiply and reject: the high half of number * bound, retried in the rare case the
+ * low half falls in the biased range.
+ * [ES] Multiplicar y rechazar de Lemire: la mitad alta de number * bound, se reintenta en el raro
+ * caso de que la mitad baja caiga en el rango sesgado.
+ */
+uint32 randomBelow(Random* random, uint32 bound)
+{
+	uint64 product = (randomNext(random) >> 32) * bound;
+	if ((uint32)product < bound) {
+		uint32 threshold = -bound % bound;
+		while ((uint32)product < threshold) {
+			product = (randomNext(random) >> 32) * bound;
+		}
+	}
+	return (uint32)(product >> 32);
+}
+
+float32 randomFloat32(Random* random)
+{
+	return (float32)(randomNext(random) >> 40) * RANDOM_FLOAT32_UNIT;
+}
+
+void randomWideSeed(RandomWide* random, uint64 seed)
+{
+	for (int32 word = 0; word < 4; ++word) {
+		for (int32 lane = 0; lane < RANDOM_WIDE_LANES; lane += 2) {
+			uint64 bits = randomSplitMix64(&seed);
+			random->state[word][lane] = (uint32)bits;
+			random->state[word][lane + 1] = (uint32)(bits >> 32);
+		}
+	}
+}
+
+/*
+ * [EN] xoshiro128** on every lane, the state of a register stays loaded across all the steps.
+ * numbers holds steps * RANDOM_WIDE_LANES values.
+ * [ES] xoshiro128** en cada carril, el estado de un registro se queda cargado durante todos los
+ * pasos. numbers tiene steps * RANDOM_WIDE_LANES valores.
+ */
+internal void randomWideSteps(RandomWide* random, uint32* numbers, int64 steps)
+{
+	for (int32 lane = 0; lane < RANDOM_WIDE_LANES; lane += RANDOM_LANES) {
+		RandomLanes s0 = randomLanesLoad(&random->state[0][lane]);
+		RandomLanes s1 = randomLanesLoad(&random->state[1][lane]);
+		RandomLanes s2 = randomLanesLoad(&random->state[2][lane]);
+		RandomLanes s3 = randomLanesLoad(&random->state[3][lane]);
+		for (int64 step = 0; step < steps; ++step) {
+			RandomLanes times5 = randomLanesAdd(randomLanesShiftLeft(s1, 2), s1);
+			RandomLanes rotated = randomLanesRotate(times5, 7);
+			RandomLanes result = randomLanesAdd(randomLanesShiftLeft(rotated, 3), rotated); // * 9
+			randomLanesStore(&numbers[(step * RANDOM_WIDE_LANES) + lane], result);
+
+			RandomLanes t = randomLanesShiftLeft(s1, 9);
+			s2 = randomLanesXor(s2, s0);
+			s3 = randomLanesXor(s3, s1);
+			s1 = randomLanesXor(s1, s2);
+			s0 = randomLanesXor(s0, s3);
+			s2 = randomLanesXor(s2, t);
+			s3 = randomLanesRotate(s3, 11);
+		}
+		randomLanesStore(&random->state[0][lane], s0);
+		randomLanesStore(&random->state[1][lane], s1);
+		randomLanesStore(&random->state[2][lane], s2);
+		randomLanesStore(&random->state[3][lane], s3);
+	}
+}
+
+void randomWideFill(RandomWide* random, uint32* numbers, int64 count)
+{
+	int64 steps = count / RANDOM_WIDE_LANES;
+	randomWideSteps(random, numbers, steps);
+	int64 rest = count - (steps * RANDOM_WIDE_LANES);
+	if (rest > 0) {
+		uint32 last[RANDOM_WIDE_LANES];
+		randomWideSteps(random, last, 1);
+		memcpy(&numbers[steps * RANDOM_WIDE_LANES], last, (uint64)rest * sizeof(uint32));
+	}
+}
+
+void randomWideFillFloat32(RandomWide* random, float32* numbers, int64 count)
+{
+	// [EN] Bits made in place, read with memcpy | [ES] Bits hechos en su lugar, leídos con memcpy
+	static_assert(sizeof(float32) == sizeof(uint32), "Floats are converted in place");
+	randomWideFill(random, (uint32*)numbers, count);
+	for (int64 i = 0; i < count; ++i) {
+		uint32 bits;
+		memcpy(&bits, &numbers[i], sizeof(bits));
+		numbers[i] = (float32)(bits >> 8) * RANDOM_FLOAT32_UNIT;
+	}
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,45 @@
+/* random.h: pseudo-random generator declarations | declaraciones del generador pseudoaleatorio */
+
+#pragma once
+#include "types.h"
+
+/*
+ * [EN] xoshiro256**: 256 bits of state, period 2^256 - 1, passes BigCrush. The same seed gives the
+ * same sequence on every machine, not suited for cryptography.
+ * [ES] xoshiro256**: 256 bits de estado, periodo 2^256 - 1, pasa BigCrush. La misma semilla da la
+ * misma secuencia en toda máquina, no apto para criptografía.
+ */
+typedef struct {
+	uint64 state[4];
+} Random;
+
+void randomSeed(Random* random, uint64 seed);
+uint64 randomNext(Random* random);
+uint32 randomBelow(Random* random, uint32 bound); // [0, bound), unbiased | sin sesgo
+float32 randomFloat32(Random* random); // [0, 1)
+
+/*
+ * [EN] RANDOM_WIDE_LANES independent xoshiro128** streams advanced together, one step yields one
+ * number per lane in lane order. The AVX2, SSE2 and scalar paths produce the same sequence.
+ * [ES] RANDOM_WIDE_LANES flujos xoshiro128** independientes que avanzan juntos, un paso da un
+ * número por carril en orden de carril. Los caminos AVX2, SSE2 y escalar producen la misma
+ * secuencia.
+ */
+#define RANDOM_WIDE_LANES 8
+
+typedef struct {
+	uint32 state[4][RANDOM_WIDE_LANES]; // [word][lane]
+} RandomWide;
+
+void randomWideSeed(RandomWide* random, uint64 seed);
+
+/*
+ * [EN] Writes count numbers. A count that isn't a multiple of RANDOM_WIDE_LANES still advances
+ * every lane, the extra numbers are dropped.
+ * [ES] Escribe count números. Un count que no es múltiplo de RANDOM_WIDE_LANES avanza de todos
+ * modos cada carril, los números sobrantes se descartan.
+ */
+void randomWideFill(RandomWide* random, uint32* numbers, int64 count);
+void randomWideFillFloat32(RandomWide* random, float32* numbers, int64 count); // [0, 1)
+
+/* 18/10/2026 - kanso engine */
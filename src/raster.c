@@ -0,0 +1,512 @@
+/* raster.c: software triangle rasterizer | rasterizador de triángulos por software */
+
+#include "defines.h"
+#include "types.h"
+#include "log.h"
+#include "render.h"
+#include "raster.h"
+#include "thread.h"
+
+#include <stdlib.h>
+#include <float.h>
+
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#endif
+
+#define RASTER_MIN_ROWS_PER_THREAD 32
+#define RASTER_MIN_PIXELS_FOR_THREADS (256 * 256) // smaller targets are drawn on the calling thread
+#define RASTER_MIN_W 1e-6f
+
+/*
+ * [EN] Wide types and operations, the span loop is written once on top of them and evaluates
+ * RASTER_LANES pixels per iteration: 8 with AVX2, 4 with SSE2 and 1 otherwise.
+ * [ES] Tipos y operaciones anchas, el ciclo de segmentos se escribe una vez sobre ellas y evalúa
+ * RASTER_LANES píxeles por iteración: 8 con AVX2, 4 con SSE2 y 1 de otra forma.
+ */
+#if defined(__AVX2__)
+	#define RASTER_LANES 8
+typedef __m256 RasterWide;
+typedef __m256 RasterMask;
+typedef __m256i RasterWideInt;
+
+internal inline RasterWide rasterWideSet(float32 value) { return _mm256_set1_ps(value); }
+internal inline RasterWide rasterWideLanes(void) { return _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7); }
+internal inline RasterWide rasterWideAdd(RasterWide a, RasterWide b) { return _mm256_add_ps(a, b); }
+internal inline RasterWide rasterWideMul(RasterWide a, RasterWide b) { return _mm256_mul_ps(a, b); }
+internal inline RasterWide rasterWideDiv(RasterWide a, RasterWide b) { return _mm256_div_ps(a, b); }
+internal inline RasterWide rasterWideMin(RasterWide a, RasterWide b) { return _mm256_min_ps(a, b); }
+internal inline RasterWide rasterWideMax(RasterWide a, RasterWide b) { return _mm256_max_ps(a, b); }
+internal inline RasterWide rasterWideLoad(const float32* p) { return _mm256_loadu_ps(p); }
+internal inline void rasterWideStore(float32* p, RasterWide a) { _mm256_storeu_ps(p, a); }
+internal inline RasterMask rasterMaskGreaterEqual(RasterWide a, RasterWide b)
+{
+	return _mm256_cmp_ps(a, b, _CMP_GE_OQ);
+}
+internal inline RasterMask rasterMaskLess(RasterWide a, RasterWide b)
+{
+	return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+}
+internal inline RasterMask rasterMaskAnd(RasterMask a, RasterMask b) { return _mm256_and_ps(a, b); }
+internal inline bool8 rasterMaskAny(RasterMask mask) { return _mm256_movemask_ps(mask) != 0; }
+internal inline RasterWide rasterWideSelect(RasterMask mask, RasterWide a, RasterWide b)
+{
+	return _mm256_blendv_ps(b, a, mask);
+}
+internal inline RasterWideInt rasterWideIntLoad(const uint32* p)
+{
+	return _mm256_loadu_si256((const __m256i*)p);
+}
+internal inline void rasterWideIntStore(uint32* p, RasterWideInt a)
+{
+	_mm256_storeu_si256((__m256i*)p, a);
+}
+internal inline RasterWideInt rasterWideIntSelect(RasterMask mask, RasterWideInt a,
+		RasterWideInt b)
+{
+	return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(b), _mm256_castsi256_ps(a),
+				mask));
+}
+internal inline RasterWideInt rasterWidePack(RasterWide r, RasterWide g, RasterWide b)
+{
+	return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(_mm256_cvttps_epi32(r), 16),
+				_mm256_slli_epi32(_mm256_cvttps_epi32(g), 8)), _mm256_cvttps_epi32(b));
+}
+#elif defined(__SSE2__)
+	#define RASTER_LANES 4
+typedef __m128 RasterWide;
+typedef __m128 RasterMask;
+typedef __m128i RasterWideInt;
+
+internal inline RasterWide rasterWideSet(float32 value) { return _mm_set1_ps(value); }
+internal inline RasterWide rasterWideLanes(void) { return _mm_setr_ps(0, 1, 2, 3); }
+internal inline RasterWide rasterWideAdd(RasterWide a, RasterWide b) { return _mm_add_ps(a, b); }
+internal inline RasterWide rasterWideMul(RasterWide a, RasterWide b) { return _mm_mul_ps(a, b); }
+internal inline RasterWide rasterWideDiv(RasterWide a, RasterWide b) { return _mm_div_ps(a, b); }
+internal inline RasterWide rasterWideMin(RasterWide a, RasterWide b) { return _mm_min_ps(a, b); }
+internal inline RasterWide rasterWideMax(RasterWide a, RasterWide b) { return _mm_max_ps(a, b); }
+internal inline RasterWide rasterWideLoad(const float32* p) { return _mm_loadu_ps(p); }
+internal inline void rasterWideStore(float32* p, RasterWide a) { _mm_storeu_ps(p, a); }
+internal inline RasterMask rasterMaskGreaterEqual(RasterWide a, RasterWide b)
+{
+	return _mm_cmpge_ps(a, b);
+}
+internal inline RasterMask rasterMaskLess(RasterWide a, RasterWide b) { return _mm_cmplt_ps(a, b); }
+internal inline RasterMask rasterMaskAnd(RasterMask a, RasterMask b) { return _mm_and_ps(a, b); }
+internal inline bool8 rasterMaskAny(RasterMask mask) { return _mm_movemask_ps(mask) != 0; }
+internal inline RasterWide rasterWideSelect(RasterMask mask, RasterWide a, RasterWide b)
+{
+	return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+internal inline RasterWideInt rasterWideIntLoad(const uint32* p)
+{
+	return _mm_loadu_si128((const __m128i*)p);
+}
+internal inline void rasterWideIntStore(uint32* p, RasterWideInt a)
+{
+	_mm_storeu_si128((__m128i*)p, a);
+}
+internal inline RasterWideInt rasterWideIntSelect(RasterMask mask, RasterWideInt a,
+		RasterWideInt b)
+{
+	__m128i integer_mask = _mm_castps_si128(mask);
+	return _mm_or_si128(_mm_and_si128(integer_mask, a), _mm_andnot_si128(integer_mask, b));
+}
+internal inline RasterWideInt rasterWidePack(RasterWide r, RasterWide g, RasterWide b)
+{
+	return _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_cvttps_epi32(r), 16),
+				_mm_slli_epi32(_mm_cvttps_epi32(g), 8)), _mm_cvttps_epi32(b));
+}
+#else
+	#define RASTER_LANES 1
+typedef float32 RasterWide;
+typedef bool8 RasterMask;
+typedef uint32 RasterWideInt;
+
+internal inline RasterWide rasterWideSet(float32 value) { return value; }
+internal inline RasterWide rasterWideLanes(void) { return 0; }
+internal inline RasterWide rasterWideAdd(RasterWide a, RasterWide b) { return a + b; }
+internal inline RasterWide rasterWideMul(RasterWide a, RasterWide b) { return a * b; }
+internal inline RasterWide rasterWideDiv(RasterWide a, RasterWide b) { return a / b; }
+internal inline RasterWide rasterWideMin(RasterWide a, RasterWide b) { return (a < b) ? a : b; }
+internal inline RasterWide rasterWideMax(RasterWide a, RasterWide b) { return (a > b) ? a : b; }
+internal inline RasterWide rasterWideLoad(const float32* p) { return *p; }
+internal inline void rasterWideStore(float32* p, RasterWide a) { *p = a; }
+internal inline RasterMask rasterMaskGreaterEqual(RasterWide a, RasterWide b) { return a >= b; }
+internal inline RasterMask rasterMaskLess(RasterWide a, RasterWide b) { return a < b; }
+internal inline RasterMask rasterMaskAnd(RasterMask a, RasterMask b) { return a && b; }
+internal inline bool8 rasterMaskAny(RasterMask mask) { return mask; }
+internal inline RasterWide rasterWideSelect(RasterMask mask, RasterWide a, RasterWide b)
+{
+	return mask ? a : b;
+}
+internal inline RasterWideInt rasterWideIntLoad(const uint32* p) { return *p; }
+internal inline void rasterWideIntStore(uint32* p, RasterWideInt a) { *p = a; }
+internal inline RasterWideInt rasterWideIntSelect(RasterMask mask, RasterWideInt a,
+		RasterWideInt b)
+{
+	return mask ? a : b;
+}
+internal inline RasterWideInt rasterWidePack(RasterWide r, RasterWide g, RasterWide b)
+{
+	return ((uint32)r << 16) | ((uint32)g << 8) | (uint32)b;
+}
+#endif
+
+internal inline RasterWide rasterWideMulAdd(RasterWide a, RasterWide b, RasterWide c)
+{
+	return rasterWideAdd(rasterWideMul(a, b), c);
+}
+
+/*
+ * [EN] a0 + bary1 * a1 + bary2 * a2, a1 and a2 are the attribute deltas to vertex 0.
+ * [ES] a0 + bary1 * a1 + bary2 * a2, a1 y a2 son las diferencias del atributo con el vértice 0.
+ */
+internal inline RasterWide rasterWideInterpolate(RasterWide a0, RasterWide a1, RasterWide a2,
+		RasterWide bary1, RasterWide bary2)
+{
+	return rasterWideMulAdd(bary1, a1, rasterWideMulAdd(bary2, a2, a0));
+}
+
+/*
+ * [EN] Screen-space triangle ready for traversal. Edge i is the edge opposite to vertex i, its
+ * function (a * x + b * y + c) is positive inside and equals area * barycentric_i. Pixel centers
+ * exactly on an edge belong to the triangle only if it's a top or left edge (top_left), so a pixel
+ * on an edge shared by two triangles is drawn once.
+ * [ES] Triángulo en espacio de pantalla listo para recorrerse. La arista i es la arista opuesta al
+ * vértice i, su función (a * x + b * y + c) es positiva dentro y es igual a area * baricéntrica_i.
+ * Los centros de píxel justo sobre una arista pertenecen al triángulo sólo si es una arista
+ * superior o izquierda (top_left), así un píxel sobre una arista compartida por dos triángulos se
+ * dibuja una vez.
+ */
+typedef struct {
+	float32 edge_a[3];
+	float32 edge_b[3];
+	float32 edge_c[3];
+	bool8 top_left[3];
+	float32 inverse_area;
+	float32 z[3]; // screen-linear depth | profundidad lineal en pantalla
+	float32 inverse_w[3];
+	float32 r_over_w[3];
+	float32 g_over_w[3];
+	float32 b_over_w[3];
+	int32 min_x;
+	int32 min_y;
+	int32 max_x;
+	int32 max_y;
+} RasterTriangle;
+
+typedef struct {
+	Bitmap* target;
+	DepthBuffer* depth;
+	const RasterTriangle* triangles;
+	int32 triangle_count;
+} RasterJob;
+
+internal inline float32 rasterMin3(float32 a, float32 b, float32 c)
+{
+	float32 min = (a < b) ? a : b;
+	return (min < c) ? min : c;
+}
+
+internal inline float32 rasterMax3(float32 a, float32 b, float32 c)
+{
+	float32 max = (a > b) ? a : b;
+	return (max > c) ? max : c;
+}
+
+internal inline float32 rasterClamp(float32 value, float32 min, float32 max)
+{
+	return (value < min) ? min : ((value > max) ? max : value);
+}
+
+internal RasterVertex rasterLerpVertex(const RasterVertex* a, const RasterVertex* b, float32 t)
+{
+	RasterVertex result = {
+		.x = a->x + ((b->x - a->x) * t),
+		.y = a->y + ((b->y - a->y) * t),
+		.z = a->z + ((b->z - a->z) * t),
+		.w = a->w + ((b->w - a->w) * t),
+		.r = a->r + ((b->r - a->r) * t),
+		.g = a->g + ((b->g - a->g) * t),
+		.b = a->b + ((b->b - a->b) * t),
+	};
+	return result;
+}
+
+/*
+ * [EN] Sutherland-Hodgman against the near plane (z + w >= 0), a triangle becomes 0, 3 or 4
+ * vertices.
+ * [ES] Sutherland-Hodgman contra el plano cercano (z + w >= 0), un triángulo se vuelve 0, 3 o 4
+ * vértices.
+ */
+internal int32 rasterClipNear(const RasterVertex* input, RasterVertex output[4])
+{
+	int32 count = 0;
+	for (int32 i = 0; i < 3; ++i) {
+		const RasterVertex* current = &input[i];
+		const RasterVertex* next = &input[(i + 1) % 3];
+		float32 current_distance = current->z + current->w;
+		float32 next_distance = next->z + next->w;
+		if (current_distance >= 0) {
+			output[count++] = *current;
+		}
+		if ((current_distance >= 0) != (next_distance >= 0)) {
+			float32 t = current_distance / (current_distance - next_distance);
+			output[count++] = rasterLerpVertex(current, next, t);
+		}
+	}
+	return count;
+}
+
+[[nodiscard]] internal bool8 rasterSetUpTriangle(RasterTriangle* triangle, const RasterVertex* v0,
+		const RasterVertex* v1, const RasterVertex* v2, int32 width, int32 height)
+{
+	const RasterVertex* vertices[3] = { v0, v1, v2 };
+	float32 x[3], y[3];
+	for (int32 i = 0; i < 3; ++i) {
+		const RasterVertex* vertex = vertices[i];
+		if (vertex->w < RASTER_MIN_W) {
+			return false;
+		}
+		float32 inverse_w = 1.0f / vertex->w;
+		x[i] = ((vertex->x * inverse_w * 0.5f) + 0.5f) * width;
+		y[i] = (0.5f - (vertex->y * inverse_w * 0.5f)) * height; // rows grow downwards
+		triangle->z[i] = (vertex->z * inverse_w * 0.5f) + 0.5f;
+		triangle->inverse_w[i] = inverse_w;
+		triangle->r_over_w[i] = vertex->r * inverse_w;
+		triangle->g_over_w[i] = vertex->g * inverse_w;
+		triangle->b_over_w[i] = vertex->b * inverse_w;
+	}
+
+	float32 area = ((x[1] - x[0]) * (y[2] - y[0])) - ((y[1] - y[0]) * (x[2] - x[0]));
+	if (area == 0) {
+		return false;
+	}
+	float32 sign = (area > 0) ? 1.0f : -1.0f; // both windings | ambos sentidos de giro
+	for (int32 i = 0; i < 3; ++i) {
+		/*
+		 * [EN] Always from the lesser vertex, so the two triangles of a shared edge round the same
+		 * way and get exactly opposite values, then flipped to this triangle's orientation.
+		 * [ES] Siempre desde el vértice menor, así los dos triángulos de una arista compartida
+		 * redondean igual y obtienen valores exactamente opuestos, luego se voltea a la
+		 * orientación de este triángulo.
+		 */
+		int32 from = (i + 1) % 3;
+		int32 to = (i + 2) % 3;
+		float32 edge_sign = sign;
+		if (x[from] > x[to] || (x[from] == x[to] && y[from] > y[to])) {
+			int32 swap = from;
+			from = to;
+			to = swap;
+			edge_sign = -sign;
+		}
+		triangle->edge_a[i] = -(y[to] - y[from]) * edge_sign;
+		triangle->edge_b[i] = (x[to] - x[from]) * edge_sign;
+		triangle->edge_c[i] = (((y[to] - y[from]) * x[from]) - ((x[to] - x[from]) * y[from]))
+			* edge_sign;
+		// [EN] Rows grow downwards, the inside is right of a left edge and below a top one
+		// [ES] Las filas crecen hacia abajo, el interior está a la derecha de una arista izquierda
+		// y debajo de una superior
+		triangle->top_left[i] = triangle->edge_a[i] > 0
+			|| (triangle->edge_a[i] == 0 && triangle->edge_b[i] > 0);
+	}
+	triangle->inverse_area = 1.0f / (area * sign);
+
+	float32 min_x = rasterClamp(rasterMin3(x[0], x[1], x[2]), 0, (float32)(width - 1));
+	float32 max_x = rasterClamp(rasterMax3(x[0], x[1], x[2]), 0, (float32)(width - 1));
+	float32 min_y = rasterClamp(rasterMin3(y[0], y[1], y[2]), 0, (float32)(height - 1));
+	float32 max_y = rasterClamp(rasterMax3(y[0], y[1], y[2]), 0, (float32)(height - 1));
+	triangle->min_x = (int32)min_x;
+	triangle->max_x = (int32)max_x;
+	triangle->min_y = (int32)min_y;
+	triangle->max_y = (int32)max_y;
+	return true;
+}
+
+internal void rasterTriangleRows(const RasterTriangle* triangle, Bitmap* target,
+		DepthBuffer* depth, int32 row_begin, int32 row_end)
+{
+	int32 min_y = (triangle->min_y > row_begin) ? triangle->min_y : row_begin;
+	int32 max_y = (triangle->max_y < row_end - 1) ? triangle->max_y : row_end - 1;
+	int32 min_x = triangle->min_x;
+	RasterWide span_end = rasterWideSet(triangle->max_x + 1.0f);
+
+	RasterWide zero = rasterWideSet(0);
+	RasterWide one = rasterWideSet(1.0f);
+	RasterWide max_channel = rasterWideSet(255.0f);
+	RasterWide half = rasterWideSet(0.5f);
+	RasterWide lanes = rasterWideLanes();
+	RasterWide inverse_area = rasterWideSet(triangle->inverse_area);
+	RasterWide edge_a[3];
+	/*
+	 * [EN] Inside an edge: >= 0 on a top-left edge, > 0 otherwise, which is >= the least positive
+	 * float. Needs denormals (no DAZ), the engine never flushes them.
+	 * [ES] Dentro de una arista: >= 0 en una arista superior izquierda, > 0 si no, que es >= al
+	 * menor float positivo. Requiere denormales (sin DAZ), el motor nunca los descarta.
+	 */
+	RasterWide edge_min[3];
+	for (int32 i = 0; i < 3; ++i) {
+		edge_a[i] = rasterWideSet(triangle->edge_a[i]);
+		edge_min[i] = rasterWideSet(triangle->top_left[i] ? 0 : FLT_TRUE_MIN);
+	}
+
+	RasterWide z0 = rasterWideSet(triangle->z[0]);
+	RasterWide z1 = rasterWideSet(triangle->z[1] - triangle->z[0]);
+	RasterWide z2 = rasterWideSet(triangle->z[2] - triangle->z[0]);
+	RasterWide w0 = rasterWideSet(triangle->inverse_w[0]);
+	RasterWide w1 = rasterWideSet(triangle->inverse_w[1] - triangle->inverse_w[0]);
+	RasterWide w2 = rasterWideSet(triangle->inverse_w[2] - triangle->inverse_w[0]);
+	RasterWide r0 = rasterWideSet(triangle->r_over_w[0]);
+	RasterWide r1 = rasterWideSet(triangle->r_over_w[1] - triangle->r_over_w[0]);
+	RasterWide r2 = rasterWideSet(triangle->r_over_w[2] - triangle->r_over_w[0]);
+	RasterWide g0 = rasterWideSet(triangle->g_over_w[0]);
+	RasterWide g1 = rasterWideSet(triangle->g_over_w[1] - triangle->g_over_w[0]);
+	RasterWide g2 = rasterWideSet(triangle->g_over_w[2] - triangle->g_over_w[0]);
+	RasterWide b0 = rasterWideSet(triangle->b_over_w[0]);
+	RasterWide b1 = rasterWideSet(triangle->b_over_w[1] - triangle->b_over_w[0]);
+	RasterWide b2 = rasterWideSet(triangle->b_over_w[2] - triangle->b_over_w[0]);
+
+	/*
+	 * [EN] Edges are evaluated at absolute pixel centers, not stepped from the bounding box, which
+	 * differs between the triangles that share an edge.
+	 * [ES] Las aristas se evalúan en centros de píxel absolutos, no avanzando desde la caja
+	 * envolvente, que difiere entre los triángulos que comparten una arista.
+	 */
+	for (int32 row = min_y; row <= max_y; ++row) {
+		float32 py = row + 0.5f;
+		float32 row_edges[3];
+		for (int32 i = 0; i < 3; ++i) {
+			row_edges[i] = (triangle->edge_b[i] * py) + triangle->edge_c[i];
+		}
+		uint32* pxl_row = (uint32*)((uint8*)target->memory + ((int64)row * target->bytes_per_row));
+		float32* depth_row = depth->memory + ((int64)row * depth->width);
+
+		for (int32 col = min_x; col <= triangle->max_x; col += RASTER_LANES) {
+			RasterWide px = rasterWideAdd(rasterWideSet(col + 0.5f), lanes); // centers | centros
+			RasterWide e0 = rasterWideMulAdd(px, edge_a[0], rasterWideSet(row_edges[0]));
+			RasterWide e1 = rasterWideMulAdd(px, edge_a[1], rasterWideSet(row_edges[1]));
+			RasterWide e2 = rasterWideMulAdd(px, edge_a[2], rasterWideSet(row_edges[2]));
+			RasterMask inside = rasterMaskAnd(rasterMaskGreaterEqual(e0, edge_min[0]),
+					rasterMaskAnd(rasterMaskGreaterEqual(e1, edge_min[1]),
+						rasterMaskGreaterEqual(e2, edge_min[2])));
+			inside = rasterMaskAnd(inside, rasterMaskLess(px, span_end));
+			if (!rasterMaskAny(inside)) {
+				continue;
+			}
+
+			// [EN] The last block of a row may be past the buffer end, go through scratch lanes
+			// [ES] El último bloque de una fila puede salirse del buffer, se usan carriles temporales
+			float32* depth_lanes = depth_row + col;
+			uint32* pxl_lanes = pxl_row + col;
+			int32 valid_lanes = target->width - col;
+			float32 depth_scratch[RASTER_LANES] = { 0 };
+			uint32 pxl_scratch[RASTER_LANES] = { 0 };
+			if (valid_lanes < RASTER_LANES) {
+				for (int32 lane = 0; lane < valid_lanes; ++lane) {
+					depth_scratch[lane] = depth_lanes[lane];
+					pxl_scratch[lane] = pxl_lanes[lane];
+				}
+				depth_lanes = depth_scratch;
+				pxl_lanes = pxl_scratch;
+			}
+
+			RasterWide bary1 = rasterWideMul(e1, inverse_area);
+			RasterWide bary2 = rasterWideMul(e2, inverse_area);
+			RasterWide z = rasterWideInterpolate(z0, z1, z2, bary1, bary2);
+			RasterWide stored_z = rasterWideLoad(depth_lanes);
+			inside = rasterMaskAnd(inside, rasterMaskLess(z, stored_z));
+			inside = rasterMaskAnd(inside, rasterMaskGreaterEqual(z, zero)); // clipping rounding
+			if (rasterMaskAny(inside)) {
+				rasterWideStore(depth_lanes, rasterWideSelect(inside, z, stored_z));
+
+				RasterWide w = rasterWideDiv(one, rasterWideInterpolate(w0, w1, w2, bary1, bary2));
+				RasterWide r = rasterWideMul(rasterWideInterpolate(r0, r1, r2, bary1, bary2), w);
+				RasterWide g = rasterWideMul(rasterWideInterpolate(g0, g1, g2, bary1, bary2), w);
+				RasterWide b = rasterWideMul(rasterWideInterpolate(b0, b1, b2, bary1, bary2), w);
+				r = rasterWideMulAdd(rasterWideMin(rasterWideMax(r, zero), one), max_channel, half);
+				g = rasterWideMulAdd(rasterWideMin(rasterWideMax(g, zero), one), max_channel, half);
+				b = rasterWideMulAdd(rasterWideMin(rasterWideMax(b, zero), one), max_channel, half);
+				RasterWideInt colors = rasterWidePack(r, g, b);
+				rasterWideIntStore(pxl_lanes, rasterWideIntSelect(inside, colors,
+							rasterWideIntLoad(pxl_lanes)));
+			}
+
+			if (valid_lanes < RASTER_LANES) {
+				for (int32 lane = 0; lane < valid_lanes; ++lane) {
+					depth_row[col + lane] = depth_scratch[lane];
+					pxl_row[col + lane] = pxl_scratch[lane];
+				}
+			}
+		}
+	}
+}
+
+internal void rasterRows(void* context, int32 begin, int32 end)
+{
+	RasterJob* job = context;
+	for (int32 i = 0; i < job->triangle_count; ++i) {
+		const RasterTriangle* triangle = &job->triangles[i];
+		if (triangle->max_y >= begin && triangle->min_y < end) {
+			rasterTriangleRows(triangle, job->target, job->depth, begin, end);
+		}
+	}
+}
+
+void rasterClearDepth(DepthBuffer* depth)
+{
+	int64 count = (int64)depth->width * depth->height;
+	for (int64 i = 0; i < count; ++i) {
+		depth->memory[i] = 1.0f;
+	}
+}
+
+bool8 rasterDrawTriangles(Bitmap* target, DepthBuffer* depth, const RasterVertex* vertices,
+		int32 vertex_count)
+{
+	assert(target->width == depth->width && target->height == depth->height,
+			"Depth buffer and target sizes don't match");
+	int32 input_triangles = vertex_count / 3;
+	if (input_triangles <= 0 || target->width <= 0 || target->height <= 0) {
+		return true;
+	}
+	// [EN] A clipped triangle may become two | [ES] Un triángulo recortado puede volverse dos
+	uint64 triangle_capacity = (uint64)input_triangles * 2;
+	if (triangle_capacity > SIZE_MAX / sizeof(RasterTriangle)) {
+		logError("Too many triangles to rasterize: %d.", input_triangles);
+		return false;
+	}
+	RasterTriangle* triangles = malloc(sizeof(RasterTriangle) * triangle_capacity);
+	if (!triangles) {
+		logError("Failed to allocate %llu triangles for rasterization.",
+				(unsigned long long)triangle_capacity);
+		return false;
+	}
+
+	int32 triangle_count = 0;
+	for (int32 i = 0; i < input_triangles; ++i) {
+		RasterVertex clipped[4];
+		int32 clipped_count = rasterClipNear(&vertices[3 * i], clipped);
+		for (int32 fan = 1; fan + 1 < clipped_count; ++fan) {
+			if (rasterSetUpTriangle(&triangles[triangle_count], &clipped[0], &clipped[fan],
+						&clipped[fan + 1], target->width, target->height)) {
+				triangle_count++;
+			}
+		}
+	}
+
+	RasterJob job = { .target = target, .depth = depth, .triangles = triangles,
+		.triangle_count = triangle_count };
+	if ((int64)target->width * target->height < RASTER_MIN_PIXELS_FOR_THREADS) {
+		rasterRows(&job, 0, target->height);
+	} else { // [EN] Horizontal bands, one per thread | [ES] Bandas horizontales, una por hilo
+		threadParallelFor(target->height, RASTER_MIN_ROWS_PER_THREAD, rasterRows, &job);
+	}
+	free(triangles);
+	return true;
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,43 @@
+/* raster.h: software triangle rasterizer declarations | declaraciones del rasterizador de triángulos */
+
+#pragma once
+#include "types.h"
+#include "render.h"
+
+/*
+ * [EN] Position in clip space (before the perspective divide, OpenGL convention: visible when
+ * -w <= z <= w) and a color whose channels go from 0 to 1.
+ * [ES] Posición en espacio de recorte (antes de la división de perspectiva, convención de OpenGL:
+ * visible cuando -w <= z <= w) y un color cuyos canales van de 0 a 1.
+ */
+typedef struct {
+	float32 x, y, z, w;
+	float32 r, g, b;
+} RasterVertex;
+
+/*
+ * [EN] One depth value from 0 (near) to 1 (far) per pixel, rows are width values apart.
+ * [ES] Un valor de profundidad de 0 (cerca) a 1 (lejos) por píxel, las filas están separadas por
+ * width valores.
+ */
+typedef struct {
+	float32* memory;
+	int32 width;
+	int32 height;
+} DepthBuffer;
+
+void rasterClearDepth(DepthBuffer* depth);
+
+/*
+ * [EN] Draws a triangle list (three vertices per triangle) into target, clipping against the near
+ * plane and keeping the nearest fragment per pixel. Attributes are perspective-correct. Both
+ * windings are drawn. Returns false if the setup memory can't be allocated.
+ * [ES] Dibuja una lista de triángulos (tres vértices por triángulo) en target, recortando contra el
+ * plano cercano y conservando el fragmento más cercano por píxel. Los atributos son correctos en
+ * perspectiva. Se dibujan ambos sentidos de giro. Regresa false si no se puede reservar la memoria
+ * de preparación.
+ */
+[[nodiscard]] bool8 rasterDrawTriangles(Bitmap* target, DepthBuffer* depth,
+		const RasterVertex* vertices, int32 vertex_count);
+
+/* 18/10/2026 - kanso engine */
@@ -3,7 +3,19 @@
 #pragma once
 #include "types.h"
 
-void renderGradient(void* buffer, int32 width, int32 height, int32 bytes_per_row,
-		uint32 animation_speed);
+/*
+ * [EN] View over a 32-bit x:R:G:B 8:8:8:8 little endian pixel buffer, the layout used by every
+ * renderer. Rows are bytes_per_row (stride) bytes apart.
+ * [ES] Vista sobre un 'buffer' de píxeles x:R:G:B 8:8:8:8 little endian de 32 bits, el formato usado
+ * por todos los renderizadores. Las filas están separadas por bytes_per_row (stride) bytes.
+ */
+typedef struct {
+	void* memory;
+	int32 width;
+	int32 height;
+	int32 bytes_per_row; // stride
+} Bitmap;
+
+void renderGradient(void* buffer, int32 width, int32 height, int32 bytes_per_row, int32 offset);
 
 /* */
@@ -0,0 +1,408 @@
+/* scale.c: image resampling | re-muestreo de imágenes */
+
+#include "defines.h"
+#include "types.h"
+#include "log.h"
+#include "render.h"
+#include "scale.h"
+#include "thread.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#endif
+
+#define SCALE_MIN_ROWS_PER_THREAD 32
+#define SCALE_MIN_PIXELS_FOR_THREADS (256 * 256) // smaller images are done on the calling thread
+
+typedef struct {
+	Bitmap* destination;
+	const Bitmap* source;
+	int32* first_columns; // nearest: sampled column | bilinear: left column | box: first column
+	int32* last_columns; // bilinear: right column | box: one past the last column
+	uint64* column_weights; // bilinear: 8-bit right weight replicated in four 16-bit lanes
+} ScaleJob;
+
+internal inline uint32* scaleRow(const Bitmap* bitmap, int32 row)
+{
+	return (uint32*)((uint8*)bitmap->memory + ((int64)row * bitmap->bytes_per_row));
+}
+
+/*
+ * [EN] Runs the row task on the calling thread for small destinations, otherwise splits the rows
+ * across threads.
+ * [ES] Ejecuta la tarea por filas en el hilo que llama para destinos pequeños, de otra forma divide
+ * las filas entre hilos.
+ */
+internal void scaleRun(ScaleJob* job, ThreadRangeTask* row_task)
+{
+	int32 rows = job->destination->height;
+	if ((int64)job->destination->width * rows < SCALE_MIN_PIXELS_FOR_THREADS) {
+		row_task(job, 0, rows);
+	} else {
+		threadParallelFor(rows, SCALE_MIN_ROWS_PER_THREAD, row_task, job);
+	}
+}
+
+internal inline bool8 scaleIsEmpty(const Bitmap* destination, const Bitmap* source)
+{
+	return destination->width <= 0 || destination->height <= 0 || source->width <= 0
+		|| source->height <= 0;
+}
+
+/*
+ * [EN] Source index whose pixel center is closest to the destination pixel center.
+ * [ES] Índice de origen cuyo centro de píxel es el más cercano al centro del píxel destino.
+ */
+internal inline int32 scaleNearestIndex(int32 destination_index, int32 destination_size,
+		int32 source_size)
+{
+	return (int32)(((2 * (int64)destination_index + 1) * source_size) / (2 * (int64)destination_size));
+}
+
+/*
+ * [EN] Maps the destination pixel center to the source: (index + 0.5) * ratio - 0.5, in 24.8 fixed
+ * point, and clamps the two neighbors to the source edges.
+ * [ES] Mapea el centro del píxel destino al origen: (index + 0.5) * razón - 0.5, en punto fijo 24.8,
+ * y limita los dos vecinos a los bordes del origen.
+ */
+internal void scaleBilinearIndices(int32 destination_index, int32 destination_size,
+		int32 source_size, int32* first, int32* second, uint32* weight)
+{
+	int64 position = (((2 * (int64)destination_index + 1) * source_size * 256)
+			/ (2 * (int64)destination_size)) - 128;
+	if (position < 0) {
+		position = 0;
+	}
+	int32 index = (int32)(position >> 8);
+	if (index >= source_size - 1) {
+		*first = source_size - 1;
+		*second = source_size - 1;
+		*weight = 0;
+	} else {
+		*first = index;
+		*second = index + 1;
+		*weight = (uint32)(position & 0xFF);
+	}
+}
+
+/*
+ * [EN] (a * (256 - weight) + b * weight) >> 8 on every 8-bit channel. The SIMD paths compute the
+ * exact same integer expression so every path outputs the same bits.
+ * [ES] (a * (256 - weight) + b * weight) >> 8 en cada canal de 8 bits. Las rutas SIMD calculan la
+ * misma expresión entera por lo que todas las rutas producen los mismos bits.
+ */
+internal inline uint32 scaleLerpPixel(uint32 a, uint32 b, uint32 weight)
+{
+	uint32 result = 0;
+	for (int32 shift = 0; shift < 32; shift += 8) {
+		uint32 channel = ((((a >> shift) & 0xFF) * (256 - weight))
+				+ (((b >> shift) & 0xFF) * weight)) >> 8;
+		result |= channel << shift;
+	}
+	return result;
+}
+
+#if defined(__SSE2__)
+internal inline __m128i scaleLerpEpi16(__m128i a, __m128i b, __m128i weight)
+{
+	__m128i inverse_weight = _mm_sub_epi16(_mm_set1_epi16(256), weight);
+	return _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(a, inverse_weight),
+				_mm_mullo_epi16(b, weight)), 8);
+}
+#endif
+
+internal void scaleNearestRows(void* context, int32 begin, int32 end)
+{
+	ScaleJob* job = context;
+	Bitmap* destination = job->destination;
+	const Bitmap* source = job->source;
+	const int32* columns = job->first_columns;
+
+	int32 previous_source_row = -1;
+	for (int32 row = begin; row < end; ++row) {
+		uint32* pxl = scaleRow(destination, row);
+		int32 source_row = scaleNearestIndex(row, destination->height, source->height);
+		if (source_row == previous_source_row) { // upscaling repeats rows | escalar repite filas
+			memcpy(pxl, scaleRow(destination, row - 1), destination->width * sizeof(uint32));
+			continue;
+		}
+		previous_source_row = source_row;
+
+		const uint32* source_pxl = scaleRow(source, source_row);
+		int32 col = 0;
+#if defined(__AVX2__)
+		for (; col + 8 <= destination->width; col += 8) {
+			__m256i indices = _mm256_loadu_si256((const __m256i*)(columns + col));
+			__m256i pixels = _mm256_i32gather_epi32((const int*)source_pxl, indices, 4);
+			_mm256_storeu_si256((__m256i*)(pxl + col), pixels);
+		}
+#endif
+		for (; col < destination->width; ++col) {
+			pxl[col] = source_pxl[columns[col]];
+		}
+	}
+}
+
+internal void scaleBilinearRows(void* context, int32 begin, int32 end)
+{
+	ScaleJob* job = context;
+	Bitmap* destination = job->destination;
+	const Bitmap* source = job->source;
+	const int32* left = job->first_columns;
+	const int32* right = job->last_columns;
+
+	for (int32 row = begin; row < end; ++row) {
+		int32 upper_row, lower_row;
+		uint32 row_weight;
+		scaleBilinearIndices(row, destination->height, source->height, &upper_row, &lower_row,
+				&row_weight);
+		const uint32* upper = scaleRow(source, upper_row);
+		const uint32* lower = scaleRow(source, lower_row);
+		uint32* pxl = scaleRow(destination, row);
+
+		int32 col = 0;
+#if defined(__SSE2__)
+		// [EN] Four destination pixels per iteration | [ES] Cuatro píxeles destino por iteración
+		__m128i zero = _mm_setzero_si128();
+		__m128i row_weights = _mm_set1_epi16((int16)row_weight);
+		for (; col + 4 <= destination->width; col += 4) {
+			const int32* l = left + col;
+			const int32* r = right + col;
+			__m128i upper_left = _mm_setr_epi32(upper[l[0]], upper[l[1]], upper[l[2]], upper[l[3]]);
+			__m128i upper_right = _mm_setr_epi32(upper[r[0]], upper[r[1]], upper[r[2]], upper[r[3]]);
+			__m128i lower_left = _mm_setr_epi32(lower[l[0]], lower[l[1]], lower[l[2]], lower[l[3]]);
+			__m128i lower_right = _mm_setr_epi32(lower[r[0]], lower[r[1]], lower[r[2]], lower[r[3]]);
+			__m128i weights_lo = _mm_loadu_si128((const __m128i*)(job->column_weights + col));
+			__m128i weights_hi = _mm_loadu_si128((const __m128i*)(job->column_weights + col + 2));
+
+			__m128i upper_lo = scaleLerpEpi16(_mm_unpacklo_epi8(upper_left, zero),
+					_mm_unpacklo_epi8(upper_right, zero), weights_lo);
+			__m128i upper_hi = scaleLerpEpi16(_mm_unpackhi_epi8(upper_left, zero),
+					_mm_unpackhi_epi8(upper_right, zero), weights_hi);
+			__m128i lower_lo = scaleLerpEpi16(_mm_unpacklo_epi8(lower_left, zero),
+					_mm_unpacklo_epi8(lower_right, zero), weights_lo);
+			__m128i lower_hi = scaleLerpEpi16(_mm_unpackhi_epi8(lower_left, zero),
+					_mm_unpackhi_epi8(lower_right, zero), weights_hi);
+
+			__m128i result_lo = scaleLerpEpi16(upper_lo, lower_lo, row_weights);
+			__m128i result_hi = scaleLerpEpi16(upper_hi, lower_hi, row_weights);
+			_mm_storeu_si128((__m128i*)(pxl + col), _mm_packus_epi16(result_lo, result_hi));
+		}
+#endif
+		for (; col < destination->width; ++col) {
+			uint32 column_weight = (uint32)(job->column_weights[col] & 0xFFFF);
+			uint32 upper_pxl = scaleLerpPixel(upper[left[col]], upper[right[col]], column_weight);
+			uint32 lower_pxl = scaleLerpPixel(lower[left[col]], lower[right[col]], column_weight);
+			pxl[col] = scaleLerpPixel(upper_pxl, lower_pxl, row_weight);
+		}
+	}
+}
+
+internal void scaleBoxHalfRows(void* context, int32 begin, int32 end)
+{
+	ScaleJob* job = context;
+	Bitmap* destination = job->destination;
+	const Bitmap* source = job->source;
+
+	for (int32 row = begin; row < end; ++row) {
+		int32 lower_row = (2 * row + 1 < source->height) ? 2 * row + 1 : source->height - 1;
+		const uint32* upper = scaleRow(source, 2 * row);
+		const uint32* lower = scaleRow(source, lower_row);
+		uint32* pxl = scaleRow(destination, row);
+
+		int32 col = 0;
+#if defined(__SSE2__)
+		// [EN] Four source pixels (two destination pixels) per iteration
+		// [ES] Cuatro píxeles de origen (dos píxeles destino) por iteración
+		__m128i zero = _mm_setzero_si128();
+		__m128i rounding = _mm_set1_epi16(2);
+		for (; (2 * col) + 4 <= source->width && col + 2 <= destination->width; col += 2) {
+			__m128i upper_pixels = _mm_loadu_si128((const __m128i*)(upper + (2 * col)));
+			__m128i lower_pixels = _mm_loadu_si128((const __m128i*)(lower + (2 * col)));
+			__m128i sum_lo = _mm_add_epi16(_mm_unpacklo_epi8(upper_pixels, zero),
+					_mm_unpacklo_epi8(lower_pixels, zero));
+			__m128i sum_hi = _mm_add_epi16(_mm_unpackhi_epi8(upper_pixels, zero),
+					_mm_unpackhi_epi8(lower_pixels, zero));
+			sum_lo = _mm_add_epi16(sum_lo, _mm_srli_si128(sum_lo, 8)); // horizontal pair
+			sum_hi = _mm_add_epi16(sum_hi, _mm_srli_si128(sum_hi, 8));
+			__m128i sum = _mm_unpacklo_epi64(sum_lo, sum_hi);
+			sum = _mm_srli_epi16(_mm_add_epi16(sum, rounding), 2);
+			_mm_storel_epi64((__m128i*)(pxl + col), _mm_packus_epi16(sum, sum));
+		}
+#endif
+		for (; col < destination->width; ++col) {
+			int32 left = 2 * col;
+			int32 right = (left + 1 < source->width) ? left + 1 : source->width - 1;
+			uint32 result = 0;
+			for (int32 shift = 0; shift < 32; shift += 8) {
+				uint32 sum = ((upper[left] >> shift) & 0xFF) + ((upper[right] >> shift) & 0xFF)
+					+ ((lower[left] >> shift) & 0xFF) + ((lower[right] >> shift) & 0xFF);
+				result |= ((sum + 2) >> 2) << shift;
+			}
+			pxl[col] = result;
+		}
+	}
+}
+
+internal void scaleBoxRows(void* context, int32 begin, int32 end)
+{
+	ScaleJob* job = context;
+	Bitmap* destination = job->destination;
+	const Bitmap* source = job->source;
+
+	for (int32 row = begin; row < end; ++row) {
+		int32 first_row = (int32)(((int64)row * source->height) / destination->height);
+		int32 last_row = (int32)(((int64)(row + 1) * source->height) / destination->height);
+		if (last_row <= first_row) { // upscaling | escalando hacia arriba
+			last_row = first_row + 1;
+		}
+		uint32* pxl = scaleRow(destination, row);
+
+		for (int32 col = 0; col < destination->width; ++col) {
+			int32 first_col = job->first_columns[col];
+			int32 last_col = job->last_columns[col];
+			uint32 count = (uint32)((last_row - first_row) * (last_col - first_col));
+			uint32 sums[4] = { 0 };
+#if defined(__SSE2__)
+			__m128i zero = _mm_setzero_si128();
+			__m128i accumulator = zero;
+			for (int32 source_row = first_row; source_row < last_row; ++source_row) {
+				const uint32* source_pxl = scaleRow(source, source_row);
+				int32 source_col = first_col;
+				for (; source_col + 2 <= last_col; source_col += 2) {
+					__m128i pair = _mm_unpacklo_epi8(
+							_mm_loadl_epi64((const __m128i*)(source_pxl + source_col)), zero);
+					accumulator = _mm_add_epi32(accumulator, _mm_unpacklo_epi16(pair, zero));
+					accumulator = _mm_add_epi32(accumulator, _mm_unpackhi_epi16(pair, zero));
+				}
+				if (source_col < last_col) {
+					__m128i single = _mm_unpacklo_epi8(
+							_mm_cvtsi32_si128((int32)source_pxl[source_col]), zero);
+					accumulator = _mm_add_epi32(accumulator, _mm_unpacklo_epi16(single, zero));
+				}
+			}
+			_mm_storeu_si128((__m128i*)sums, accumulator);
+#else
+			for (int32 source_row = first_row; source_row < last_row; ++source_row) {
+				const uint32* source_pxl = scaleRow(source, source_row);
+				for (int32 source_col = first_col; source_col < last_col; ++source_col) {
+					for (int32 channel = 0; channel < 4; ++channel) {
+						sums[channel] += (source_pxl[source_col] >> (8 * channel)) & 0xFF;
+					}
+				}
+			}
+#endif
+			uint32 result = 0;
+			for (int32 channel = 0; channel < 4; ++channel) {
+				result |= ((sums[channel] + (count / 2)) / count) << (8 * channel);
+			}
+			pxl[col] = result;
+		}
+	}
+}
+
+bool8 scaleNearest(Bitmap* destination, const Bitmap* source)
+{
+	if (scaleIsEmpty(destination, source)) {
+		return true;
+	}
+	int32* columns = malloc(sizeof(int32) * destination->width);
+	if (!columns) {
+		logError("Failed to allocate the nearest neighbor sampling table.");
+		return false;
+	}
+	for (int32 col = 0; col < destination->width; ++col) {
+		columns[col] = scaleNearestIndex(col, destination->width, source->width);
+	}
+
+	ScaleJob job = { .destination = destination, .source = source, .first_columns = columns };
+	scaleRun(&job, scaleNearestRows);
+	free(columns);
+	return true;
+}
+
+bool8 scaleBilinear(Bitmap* destination, const Bitmap* source)
+{
+	if (scaleIsEmpty(destination, source)) {
+		return true;
+	}
+	int32* left = malloc(sizeof(int32) * destination->width);
+	int32* right = malloc(sizeof(int32) * destination->width);
+	uint64* weights = malloc(sizeof(uint64) * destination->width);
+	if (!left || !right || !weights) {
+		logError("Failed to allocate the bilinear sampling tables.");
+		free(left);
+		free(right);
+		free(weights);
+		return false;
+	}
+	for (int32 col = 0; col < destination->width; ++col) {
+		uint32 weight;
+		scaleBilinearIndices(col, destination->width, source->width, &left[col], &right[col],
+				&weight);
+		weights[col] = weight * 0x0001'0001'0001'0001ull; // one lane per channel | uno por canal
+	}
+
+	ScaleJob job = { .destination = destination, .source = source, .first_columns = left,
+		.last_columns = right, .column_weights = weights };
+	scaleRun(&job, scaleBilinearRows);
+	free(left);
+	free(right);
+	free(weights);
+	return true;
+}
+
+void scaleBoxHalf(Bitmap* destination, const Bitmap* source)
+{
+	assert(destination->width == (source->width + 1) / 2, "Invalid half-scale destination width");
+	assert(destination->height == (source->height + 1) / 2, "Invalid half-scale destination height");
+	if (scaleIsEmpty(destination, source)) {
+		return;
+	}
+	ScaleJob job = { .destination = destination, .source = source };
+	scaleRun(&job, scaleBoxHalfRows);
+}
+
+bool8 scaleBox(Bitmap* destination, const Bitmap* source)
+{
+	if (scaleIsEmpty(destination, source)) {
+		return true;
+	}
+	if (source->width == 2 * destination->width && source->height == 2 * destination->height) {
+		scaleBoxHalf(destination, source); // same result, faster | mismo resultado, más rápido
+		return true;
+	}
+	assert((int64)(source->width / destination->width + 1) * (source->height / destination->height + 1)
+			<= (UINT32_MAX / 255), "Box filter footprint overflows its 32-bit accumulators");
+
+	int32* first_columns = malloc(sizeof(int32) * destination->width);
+	int32* last_columns = malloc(sizeof(int32) * destination->width);
+	if (!first_columns || !last_columns) {
+		logError("Failed to allocate the box filter sampling tables.");
+		free(first_columns);
+		free(last_columns);
+		return false;
+	}
+	for (int32 col = 0; col < destination->width; ++col) {
+		first_columns[col] = (int32)(((int64)col * source->width) / destination->width);
+		last_columns[col] = (int32)(((int64)(col + 1) * source->width) / destination->width);
+		if (last_columns[col] <= first_columns[col]) {
+			last_columns[col] = first_columns[col] + 1;
+		}
+	}
+
+	ScaleJob job = { .destination = destination, .source = source, .first_columns = first_columns,
+		.last_columns = last_columns };
+	scaleRun(&job, scaleBoxRows);
+	free(first_columns);
+	free(last_columns);
+	return true;
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,25 @@
+/* scale.h: image resampling declarations | declaraciones de re-muestreo de imágenes */
+
+#pragma once
+#include "types.h"
+#include "render.h"
+
+/*
+ * [EN] Every function resamples the whole source into the whole destination. Source coordinates
+ * falling outside the source are clamped to its edge pixels. Large destinations are split by rows
+ * across threads. Returns false only when the temporary sampling tables can't be allocated.
+ * [ES] Cada función re-muestrea todo el origen en todo el destino. Las coordenadas de origen que
+ * caen fuera del origen se limitan a sus píxeles de borde. Los destinos grandes se dividen por
+ * filas entre hilos. Regresa false únicamente cuando no se pueden reservar las tablas temporales.
+ */
+[[nodiscard]] bool8 scaleNearest(Bitmap* destination, const Bitmap* source);
+[[nodiscard]] bool8 scaleBilinear(Bitmap* destination, const Bitmap* source);
+[[nodiscard]] bool8 scaleBox(Bitmap* destination, const Bitmap* source); // any ratio | cualquier razón
+
+/*
+ * [EN] Halves the source, destination must be ((width + 1) / 2) x ((height + 1) / 2).
+ * [ES] Reduce el origen a la mitad, el destino debe ser de ((width + 1) / 2) x ((height + 1) / 2).
+ */
+void scaleBoxHalf(Bitmap* destination, const Bitmap* source);
+
+/* 18/10/2026 - kanso engine */
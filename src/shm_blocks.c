@@ -0,0 +1,69 @@
+/* shm_blocks.c: shared memory block list | lista de bloques de memoria compartida */
+
+#include "defines.h"
+#include "types.h"
+#include "log.h"
+#include "shm_blocks.h"
+
+#include <string.h>
+
+bool8 shmBlocksAllocate(ShmBlocks* blocks, int32 size, int32* offset)
+{
+	if (blocks->count == SHM_BLOCKS_CAPACITY) {
+		logError("The shm arena ran out of blocks.");
+		return false;
+	}
+	int64 aligned = ((int64)size + SHM_BLOCKS_ALIGNMENT - 1) & ~(int64)(SHM_BLOCKS_ALIGNMENT - 1);
+	int32 index = 0;
+	int64 start = 0;
+	for (; index < blocks->count; ++index) { // first fit | primer hueco
+		if (blocks->blocks[index].offset - start >= aligned) {
+			break;
+		}
+		start = blocks->blocks[index].offset + blocks->blocks[index].size;
+	}
+	if (size <= 0 || start + aligned > blocks->max_size) {
+		logError("The shm arena can't hold %d more bytes.", size);
+		return false;
+	}
+
+	memmove(&blocks->blocks[index + 1], &blocks->blocks[index],
+			(uint64)(blocks->count - index) * sizeof(blocks->blocks[0]));
+	blocks->blocks[index] = (ShmBlock){ .offset = (int32)start, .size = (int32)aligned };
+	blocks->count++;
+	*offset = (int32)start;
+	return true;
+}
+
+void shmBlocksFree(ShmBlocks* blocks, int32 offset)
+{
+	for (int32 i = 0; i < blocks->count; ++i) {
+		if (blocks->blocks[i].offset == offset) {
+			memmove(&blocks->blocks[i], &blocks->blocks[i + 1],
+					(uint64)(blocks->count - i - 1) * sizeof(blocks->blocks[0]));
+			blocks->count--;
+			return;
+		}
+	}
+	assert(false, "Freed a block the shm arena never handed out");
+}
+
+int32 shmBlocksEnd(const ShmBlocks* blocks)
+{
+	if (blocks->count == 0) {
+		return 0;
+	}
+	const ShmBlock* last = &blocks->blocks[blocks->count - 1];
+	return last->offset + last->size;
+}
+
+int32 shmBlocksGrowSize(const ShmBlocks* blocks, int32 end)
+{
+	int64 size = (blocks->size > 0) ? blocks->size : SHM_BLOCKS_ALIGNMENT;
+	while (size < end) {
+		size *= 2;
+	}
+	return (int32)((size < blocks->max_size) ? size : blocks->max_size);
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,50 @@
+/* shm_blocks.h: shared memory block list | lista de bloques de memoria compartida */
+
+#pragma once
+#include "types.h"
+
+/*
+ * [EN] Where the blocks of a shared memory arena lie, nothing else: the platform maps the memory,
+ * grows the object and tells the compositor. Blocks are kept sorted by offset and aligned to
+ * SHM_BLOCKS_ALIGNMENT, a new one takes the first gap that fits. Free space is only the gaps
+ * between blocks, so freeing a block merges its space with the gaps beside it. A block past size
+ * makes the arena grow, shmBlocksGrowSize() says to how much.
+ * [ES] Dónde están los bloques de una arena de memoria compartida, nada más: la plataforma mapea
+ * la memoria, hace crecer el objeto y avisa al compositor. Los bloques se mantienen ordenados por
+ * offset y alineados a SHM_BLOCKS_ALIGNMENT, uno nuevo toma el primer hueco donde quepa. El
+ * espacio libre son sólo los huecos entre bloques, así liberar un bloque une su espacio con los
+ * huecos de al lado. Un bloque más allá de size hace crecer la arena, shmBlocksGrowSize() dice
+ * hasta cuánto.
+ */
+#define SHM_BLOCKS_ALIGNMENT 4096
+#define SHM_BLOCKS_CAPACITY 64
+
+typedef struct {
+	int32 offset;
+	int32 size; // bytes, aligned | bytes, alineado
+} ShmBlock;
+
+typedef struct {
+	ShmBlock blocks[SHM_BLOCKS_CAPACITY];
+	int32 count;
+	int32 size; // bytes backed by the arena | bytes respaldados por la arena
+	int32 max_size; // bytes the arena can grow to | bytes hasta los que puede crecer
+} ShmBlocks;
+
+/*
+ * [EN] First fit, false when the list is full or the block would end past max_size. The block may
+ * end past size, the arena must grow before it's used.
+ * [ES] Primer hueco, falso cuando la lista está llena o el bloque terminaría después de max_size.
+ * El bloque puede terminar después de size, la arena debe crecer antes de usarlo.
+ */
+[[nodiscard]] bool8 shmBlocksAllocate(ShmBlocks* blocks, int32 size, int32* offset);
+void shmBlocksFree(ShmBlocks* blocks, int32 offset);
+int32 shmBlocksEnd(const ShmBlocks* blocks); // end of the last block, 0 without | 0 sin bloques
+
+/*
+ * [EN] size doubled until it holds end, no more than max_size. size when it holds it already.
+ * [ES] size duplicado hasta que contenga end, no más que max_size. size cuando ya lo contiene.
+ */
+int32 shmBlocksGrowSize(const ShmBlocks* blocks, int32 end);
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,59 @@
+/* startup_timeline.c: time to first frame breakdown | desglose del tiempo al primer fotograma */
+
+#include "defines.h"
+#include "types.h"
+#include "log.h"
+#include "clock.h"
+#include "startup_timeline.h"
+
+global_variable const char* startup_event_names[STARTUP_EVENT_COUNT] = {
+	[STARTUP_PROCESS_START] = "process start",
+	[STARTUP_MAIN] = "main",
+	[STARTUP_ARENA_MAPPED] = "shm arena mapped",
+	[STARTUP_CONNECTED] = "globals bound",
+	[STARTUP_PREFAULTED] = "buffers prefaulted",
+	[STARTUP_WINDOW_OPENED] = "window opened",
+	[STARTUP_FIRST_RENDER] = "frame 0 rendered",
+	[STARTUP_CONFIGURED] = "first configure",
+	[STARTUP_FIRST_COMMIT] = "frame 0 committed",
+	[STARTUP_FIRST_SHOWN] = "frame 0 shown",
+};
+
+void startupTimelineInitialize(StartupTimeline* timeline)
+{
+	*timeline = (StartupTimeline){ 0 };
+	timeline->times[STARTUP_PROCESS_START] = clockProcessStartNanoseconds();
+	startupTimelineMark(timeline, STARTUP_MAIN);
+}
+
+void startupTimelineMark(StartupTimeline* timeline, StartupEvent event)
+{
+	if (timeline && timeline->times[event] == 0) {
+		timeline->times[event] = clockNowNanoseconds();
+	}
+}
+
+void startupTimelineReport(StartupTimeline* timeline)
+{
+	if (timeline->reported) {
+		return;
+	}
+	timeline->reported = true;
+	StartupEvent origin = (timeline->times[STARTUP_PROCESS_START] != 0) ? STARTUP_PROCESS_START
+		: STARTUP_MAIN;
+	uint64 start = timeline->times[origin];
+	uint64 previous = start;
+	logInfo("Startup timeline, milliseconds since %s:", startup_event_names[origin]);
+	for (StartupEvent event = origin + 1; event < STARTUP_EVENT_COUNT; ++event) {
+		uint64 time = timeline->times[event];
+		if (time == 0) {
+			continue;
+		}
+		uint64 step = (time > previous) ? time - previous : 0; // out of order | fuera de orden
+		logInfo("  %-20s %8.2f (+%.2f)", startup_event_names[event],
+				clockNanosecondsToMilliseconds(time - start), clockNanosecondsToMilliseconds(step));
+		previous = (time > previous) ? time : previous;
+	}
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,50 @@
+/* startup_timeline.h: time to first frame breakdown | desglose del tiempo al primer fotograma */
+
+#pragma once
+#include "types.h"
+
+/*
+ * [EN] Milestones of the startup path in the order they are expected. Connecting (the registry
+ * roundtrip) overlaps the prefault of the pixel buffer memory, the main window renders frame 0
+ * while its first configure is on the way.
+ * [ES] Hitos del camino de arranque en el orden en que se esperan. La conexión (el 'roundtrip' del
+ * registro) se traslapa con la prefalla de la memoria de los 'buffers' de píxeles, la ventana
+ * principal dibuja el fotograma 0 mientras su primera configuración va en camino.
+ */
+typedef enum {
+	STARTUP_PROCESS_START, // exec, scheduler tick granularity | granularidad del tick
+	STARTUP_MAIN,
+	STARTUP_ARENA_MAPPED,
+	STARTUP_CONNECTED, // globals bound | globales vinculados
+	STARTUP_PREFAULTED, // done waiting for the prefault | terminó de esperar la prefalla
+	STARTUP_WINDOW_OPENED,
+	STARTUP_FIRST_RENDER,
+	STARTUP_CONFIGURED,
+	STARTUP_FIRST_COMMIT, // a rendered frame was committed | se confirmó un fotograma dibujado
+	STARTUP_FIRST_SHOWN, // frame callback after that commit | 'callback' tras esa confirmación
+	STARTUP_EVENT_COUNT
+} StartupEvent;
+
+typedef struct {
+	uint64 times[STARTUP_EVENT_COUNT]; // nanoseconds, clockNowNanoseconds(), 0 not reached yet
+	bool8 reported;
+} StartupTimeline;
+
+void startupTimelineInitialize(StartupTimeline* timeline);
+
+/*
+ * [EN] Records the first time event happens, later ones are ignored. timeline may be nullptr.
+ * [ES] Registra la primera vez que ocurre event, las siguientes se ignoran. timeline puede ser
+ * nullptr.
+ */
+void startupTimelineMark(StartupTimeline* timeline, StartupEvent event);
+
+/*
+ * [EN] Logs every milestone reached, relative to the process start (or to main when unknown) and to
+ * the previous milestone. Only the first call logs.
+ * [ES] Registra cada hito alcanzado, relativo al inicio del proceso (o a main si se desconoce) y al
+ * hito anterior. Sólo la primera llamada registra.
+ */
+void startupTimelineReport(StartupTimeline* timeline);
+
+/* 18/10/2026 - kanso engine */
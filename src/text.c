@@ -0,0 +1,229 @@
+/* text.c: glyph atlas and text drawing | atlas de glifos y dibujo de texto */
+
+#include "defines.h"
+#include "types.h"
+#include "log.h"
+#include "render.h"
+#include "text.h"
+
+#include <stdlib.h>
+
+#define TEXT_FONT_WIDTH 5
+#define TEXT_FONT_HEIGHT 7
+#define TEXT_ATLAS_WIDTH 256
+
+/*
+ * [EN] 5x7 font for ASCII 32 to 126, one byte per row, bit 4 is the leftmost pixel. Lowercase
+ * letters reuse the uppercase shapes.
+ * [ES] Fuente 5x7 para ASCII 32 a 126, un byte por fila, el bit 4 es el píxel más a la izquierda.
+ * Las letras minúsculas reutilizan las formas de las mayúsculas.
+ */
+global_variable const uint8 text_font[TEXT_GLYPH_COUNT][TEXT_FONT_HEIGHT] = {
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // space
+	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04 }, // !
+	{ 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00 }, // "
+	{ 0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A }, // #
+	{ 0x04, 0x0F, 0x14, 0x0E, 0x05, 0x1E, 0x04 }, // $
+	{ 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03 }, // %
+	{ 0x0C, 0x12, 0x14, 0x08, 0x15, 0x12, 0x0D }, // &
+	{ 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '
+	{ 0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02 }, // (
+	{ 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08 }, // )
+	{ 0x00, 0x04, 0x15, 0x0E, 0x15, 0x04, 0x00 }, // *
+	{ 0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00 }, // +
+	{ 0x00, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x08 }, // ,
+	{ 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00 }, // -
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C }, // .
+	{ 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00 }, // /
+	{ 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E }, // 0
+	{ 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E }, // 1
+	{ 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F }, // 2
+	{ 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E }, // 3
+	{ 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 }, // 4
+	{ 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E }, // 5
+	{ 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E }, // 6
+	{ 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 }, // 7
+	{ 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E }, // 8
+	{ 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C }, // 9
+	{ 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00 }, // :
+	{ 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x04, 0x08 }, // ;
+	{ 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02 }, // <
+	{ 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00 }, // =
+	{ 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08 }, // >
+	{ 0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04 }, // ?
+	{ 0x0E, 0x11, 0x01, 0x0D, 0x15, 0x15, 0x0E }, // @
+	{ 0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 }, // A
+	{ 0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E }, // B
+	{ 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E }, // C
+	{ 0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C }, // D
+	{ 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F }, // E
+	{ 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10 }, // F
+	{ 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F }, // G
+	{ 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 }, // H
+	{ 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E }, // I
+	{ 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C }, // J
+	{ 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 }, // K
+	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F }, // L
+	{ 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11 }, // M
+	{ 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11 }, // N
+	{ 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E }, // O
+	{ 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10 }, // P
+	{ 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D }, // Q
+	{ 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11 }, // R
+	{ 0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E }, // S
+	{ 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 }, // T
+	{ 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E }, // U
+	{ 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04 }, // V
+	{ 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A }, // W
+	{ 0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11 }, // X
+	{ 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04 }, // Y
+	{ 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F }, // Z
+	{ 0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E }, // [
+	{ 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00 }, // backslash
+	{ 0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E }, // ]
+	{ 0x04, 0x0A, 0x11, 0x00, 0x00, 0x00, 0x00 }, // ^
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F }, // _
+	{ 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 }, // `
+	{ 0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 }, // a
+	{ 0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E }, // b
+	{ 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E }, // c
+	{ 0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C }, // d
+	{ 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F }, // e
+	{ 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10 }, // f
+	{ 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F }, // g
+	{ 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 }, // h
+	{ 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E }, // i
+	{ 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C }, // j
+	{ 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 }, // k
+	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F }, // l
+	{ 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11 }, // m
+	{ 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11 }, // n
+	{ 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E }, // o
+	{ 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10 }, // p
+	{ 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D }, // q
+	{ 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11 }, // r
+	{ 0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E }, // s
+	{ 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 }, // t
+	{ 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E }, // u
+	{ 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04 }, // v
+	{ 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A }, // w
+	{ 0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11 }, // x
+	{ 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04 }, // y
+	{ 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F }, // z
+	{ 0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02 }, // {
+	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 }, // |
+	{ 0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08 }, // }
+	{ 0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00 }, // ~
+
+};
+
+bool8 textAtlasCreate(TextAtlas* atlas, int32 scale)
+{
+	assert(scale >= 1, "Invalid text scale");
+	atlas->glyph_width = TEXT_FONT_WIDTH * scale;
+	atlas->glyph_height = TEXT_FONT_HEIGHT * scale;
+	atlas->advance = (TEXT_FONT_WIDTH + 1) * scale;
+	atlas->line_height = (TEXT_FONT_HEIGHT + 2) * scale;
+
+	/* [EN] Shelf packing: left to right, a new row when full | [ES] Estantes: izquierda a derecha */
+	int32 glyphs_per_row = TEXT_ATLAS_WIDTH / atlas->glyph_width;
+	assert(glyphs_per_row > 0, "Text scale too big for the atlas");
+	int32 rows = (TEXT_GLYPH_COUNT + glyphs_per_row - 1) / glyphs_per_row;
+	atlas->width = TEXT_ATLAS_WIDTH;
+	atlas->height = rows * atlas->glyph_height;
+	atlas->coverage = calloc((size_t)atlas->width * atlas->height, sizeof(uint8));
+	if (!atlas->coverage) {
+		logError("Failed to allocate a %dx%d glyph atlas.", atlas->width, atlas->height);
+		return false;
+	}
+
+	for (int32 glyph = 0; glyph < TEXT_GLYPH_COUNT; ++glyph) {
+		atlas->glyph_x[glyph] = (int16)((glyph % glyphs_per_row) * atlas->glyph_width);
+		atlas->glyph_y[glyph] = (int16)((glyph / glyphs_per_row) * atlas->glyph_height);
+		for (int32 row = 0; row < atlas->glyph_height; ++row) {
+			uint8 font_row = text_font[glyph][row / scale];
+			uint8* coverage = atlas->coverage + ((atlas->glyph_y[glyph] + row) * atlas->width)
+				+ atlas->glyph_x[glyph];
+			for (int32 col = 0; col < atlas->glyph_width; ++col) {
+				bool8 set = (font_row >> (TEXT_FONT_WIDTH - 1 - (col / scale))) & 1;
+				coverage[col] = set ? 255 : 0;
+			}
+		}
+	}
+	return true;
+}
+
+void textAtlasDestroy(TextAtlas* atlas)
+{
+	free(atlas->coverage);
+	atlas->coverage = nullptr;
+}
+
+/*
+ * [EN] dst + (src - dst) * alpha / 255 per channel, exact rounding through the (x + 128) * 257
+ * division trick. The alpha channel blends too, so premultiplied targets stay valid.
+ * [ES] dst + (src - dst) * alfa / 255 por canal, redondeo exacto con el truco de división
+ * (x + 128) * 257. El canal alfa también se mezcla, así los destinos premultiplicados siguen
+ * siendo válidos.
+ */
+internal inline uint32 textBlendPixel(uint32 destination, uint32 source, uint32 alpha)
+{
+	uint32 result = 0;
+	for (int32 shift = 0; shift < 32; shift += 8) {
+		uint32 d = (destination >> shift) & 0xFF;
+		uint32 s = (source >> shift) & 0xFF;
+		uint32 blended = (s * alpha) + (d * (255 - alpha)) + 128;
+		result |= (((blended + (blended >> 8)) >> 8) & 0xFF) << shift;
+	}
+	return result;
+}
+
+int32 textDraw(Bitmap* target, const TextAtlas* atlas, int32 x, int32 y, const char* text,
+		uint32 color)
+{
+	uint32 color_alpha = color >> 24;
+	uint32 source = 0xFF00'0000 | color; // opaque glyphs | glifos opacos
+	int32 line_x = x;
+	for (const char* c = text; *c != '\0'; ++c) {
+		if (*c == '\n') {
+			x = line_x;
+			y += atlas->line_height;
+			continue;
+		}
+		int32 glyph = *c - TEXT_FIRST_CHARACTER;
+		if (glyph < 0 || glyph >= TEXT_GLYPH_COUNT) {
+			glyph = '?' - TEXT_FIRST_CHARACTER;
+		}
+
+		/* clipping | recorte */
+		int32 first_col = (x < 0) ? -x : 0;
+		int32 first_row = (y < 0) ? -y : 0;
+		int32 last_col = atlas->glyph_width;
+		int32 last_row = atlas->glyph_height;
+		if (x + last_col > target->width) {
+			last_col = target->width - x;
+		}
+		if (y + last_row > target->height) {
+			last_row = target->height - y;
+		}
+
+		for (int32 row = first_row; row < last_row; ++row) {
+			const uint8* coverage = atlas->coverage + ((atlas->glyph_y[glyph] + row) * atlas->width)
+				+ atlas->glyph_x[glyph];
+			uint32* pxl = (uint32*)((uint8*)target->memory + ((int64)(y + row) * target->bytes_per_row))
+				+ x;
+			for (int32 col = first_col; col < last_col; ++col) {
+				uint32 alpha = (coverage[col] * color_alpha + 255) >> 8;
+				if (alpha == 255) {
+					pxl[col] = source;
+				} else if (alpha != 0) {
+					pxl[col] = textBlendPixel(pxl[col], source, alpha);
+				}
+			}
+		}
+		x += atlas->advance;
+	}
+	return x;
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,48 @@
+/* text.h: glyph atlas and text drawing declarations | declaraciones de atlas de glifos y texto */
+
+#pragma once
+#include "types.h"
+#include "render.h"
+
+#define TEXT_FIRST_CHARACTER ' '
+#define TEXT_LAST_CHARACTER '~'
+#define TEXT_GLYPH_COUNT (TEXT_LAST_CHARACTER - TEXT_FIRST_CHARACTER + 1)
+
+/*
+ * [EN] Printable ASCII glyphs rasterized once into a packed 8-bit coverage atlas.
+ * [ES] Glifos ASCII imprimibles rasterizados una sola vez en un atlas empacado de cobertura de
+ * 8 bits.
+ */
+typedef struct {
+	uint8* coverage; // width x height, rows are width bytes apart
+	int32 width;
+	int32 height;
+	int32 glyph_width;
+	int32 glyph_height;
+	int32 advance; // horizontal distance between glyphs | distancia horizontal entre glifos
+	int32 line_height;
+	int16 glyph_x[TEXT_GLYPH_COUNT];
+	int16 glyph_y[TEXT_GLYPH_COUNT];
+} TextAtlas;
+
+/*
+ * [EN] Builds the atlas from the embedded 5x7 font, every font pixel becomes scale x scale pixels.
+ * [ES] Construye el atlas a partir de la fuente 5x7 embebida, cada píxel de la fuente se vuelve
+ * scale x scale píxeles.
+ */
+[[nodiscard]] bool8 textAtlasCreate(TextAtlas* atlas, int32 scale);
+void textAtlasDestroy(TextAtlas* atlas);
+
+/*
+ * [EN] Alpha-blends text at (x, y), its top-left corner, clipping against the target. color is
+ * 0xAARRGGBB, alpha scales the glyph coverage. Also valid over premultiplied A:R:G:B targets, fully
+ * covered pixels become opaque. '\n' starts a new line. Returns the x after the last glyph.
+ * [ES] Mezcla con alfa el texto en (x, y), su esquina superior izquierda, recortando contra el
+ * destino. color es 0xAARRGGBB, alfa escala la cobertura del glifo. También es válido sobre
+ * destinos A:R:G:B premultiplicados, los píxeles cubiertos por completo se vuelven opacos. '\n'
+ * empieza una nueva línea. Regresa la x después del último glifo.
+ */
+int32 textDraw(Bitmap* target, const TextAtlas* atlas, int32 x, int32 y, const char* text,
+		uint32 color);
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,75 @@
+/* thread.h: threading primitives declarations | declaraciones de primitivas de hilos */
+
+#pragma once
+#include "types.h"
+
+#include <stdatomic.h>
+
+/*
+ * [EN] Work over the half-open range [begin, end) of a larger index space.
+ * [ES] Trabajo sobre el rango semiabierto [begin, end) de un espacio de índices más grande.
+ */
+typedef void ThreadRangeTask(void* context, int32 begin, int32 end);
+
+int32 threadGetCoreCount(void);
+
+/*
+ * [EN] Splits [0, count) in contiguous ranges of at least min_batch_size indices, runs them as jobs
+ * and on the calling thread, and returns once every range is done. Without a running job system
+ * the whole range runs on the calling thread.
+ * [ES] Divide [0, count) en rangos contiguos de al menos min_batch_size índices, los ejecuta como
+ * trabajos y en el hilo que llama, y regresa cuando todos los rangos terminaron. Sin un sistema de
+ * trabajos en marcha todo el rango se ejecuta en el hilo que llama.
+ */
+void threadParallelFor(int32 count, int32 min_batch_size, ThreadRangeTask* task, void* context);
+
+/*
+ * [EN] Job system: a fixed pool of workers, each owning a work-stealing deque. A thread pushes
+ * and pops jobs at the bottom of its own deque (LIFO, cache warm) and idle threads steal from the
+ * top of the others (FIFO, the oldest and usually largest work). The thread that starts the system
+ * owns a deque as well, so jobs it runs land there and jobWait() executes jobs instead of blocking.
+ * Other threads (asset loader, capture writer) run their jobs inline.
+ * A counter tracks jobs in flight: each job increments it when queued and decrements it when done.
+ * jobRunAfter() holds a job back until a dependency counter reaches zero.
+ * At most JOB_QUEUE_SIZE jobs may be in flight per thread, job storage is a ring that is reused.
+ * [ES] Sistema de trabajos: un grupo fijo de trabajadores, cada uno dueño de una cola doble con
+ * robo de trabajo. Un hilo mete y saca trabajos por el fondo de su propia cola (LIFO, caché
+ * caliente) y los hilos ociosos roban por el tope de las demás (FIFO, el trabajo más antiguo y
+ * normalmente más grande). El hilo que inicia el sistema también es dueño de una cola, así que los
+ * trabajos que lanza quedan ahí y jobWait() ejecuta trabajos en vez de bloquearse. Otros hilos
+ * (cargador de recursos, escritor de capturas) ejecutan sus trabajos en línea.
+ * Un contador sigue los trabajos en curso: cada trabajo lo incrementa al encolarse y lo decrementa
+ * al terminar. jobRunAfter() retiene un trabajo hasta que un contador de dependencia llegue a cero.
+ * Cada hilo puede tener a lo más JOB_QUEUE_SIZE trabajos en curso, los trabajos se guardan en un
+ * anillo que se reutiliza.
+ */
+#define JOB_QUEUE_SIZE 4096 // power of two | potencia de dos
+#define JOB_MAX_THREADS 64
+
+typedef void JobFunction(void* context);
+
+typedef struct {
+	atomic_int pending; // jobs queued or running | trabajos encolados o en ejecución
+} JobCounter; // zero initialized | inicializado en cero
+
+typedef enum {
+	JOB_AFFINITY_NONE,
+	// [EN] The starting thread (Wayland dispatch) on core 0, each worker on its own other core
+	// [ES] El hilo que inicia (despacho de Wayland) en el núcleo 0, cada trabajador en otro núcleo
+	JOB_AFFINITY_PINNED,
+} JobAffinity;
+
+/*
+ * [EN] worker_count <= 0 starts one worker per core besides the calling thread.
+ * [ES] worker_count <= 0 inicia un trabajador por núcleo además del hilo que llama.
+ */
+[[nodiscard]] bool8 jobSystemStart(int32 worker_count, JobAffinity affinity);
+void jobSystemStop(void); // after every job finished | después de que todo trabajo terminó
+int32 jobSystemGetThreadCount(void); // workers + the starting thread, 1 when stopped | 1 detenido
+
+void jobRun(JobFunction* function, void* context, JobCounter* counter); // counter may be nullptr
+void jobRunAfter(JobFunction* function, void* context, JobCounter* counter,
+		JobCounter* dependency);
+void jobWait(JobCounter* counter); // runs other jobs meanwhile | ejecuta otros trabajos mientras
+
+/* 18/10/2026 - kanso engine */
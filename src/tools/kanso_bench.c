@@ -0,0 +1,1033 @@
+/* kanso_bench.c: engine microbenchmarks | microbenchmarks del motor */
+/*
+ * [EN] Usage:
+ *    kanso_bench [bench]...   runs the given benchmarks, or all of them
+ *    kanso_bench jobs         job spawn and steal cost, and scaling with the worker count
+ *    kanso_bench scale        destination megapixels per second of every filter
+ *    kanso_bench raster       triangles per second and fill rate, per thread count
+ *    kanso_bench math         batch transforms against a loop of single ones, vectors per second
+ *    kanso_bench noise        noise fill megapixels per second per type, and random numbers
+ *    kanso_bench decode [dir] decode speed of every file the manifest of dir (tests/images) marks
+ *                             ok
+ *    kanso_bench pointer      relative pointer cost per event and the event rate it reports
+ *    kanso_bench hud          CPU time and bytes written per second of the HUD, in the frame and
+ *                             on its own layer
+ *    kanso_bench pacing       input to present latency of the frame loop, just in time against
+ *                             rendering at the frame callback and async presentation (the
+ *                             tearing hint), on a simulated 60 Hz compositor
+ * Every benchmark prints the best of BENCH_RUNS runs, so a cold cache or a preempted run doesn't
+ * count. The SIMD paths are chosen at compile time, build with -mavx2 to measure the AVX2 ones.
+ * [ES] Uso:
+ *    kanso_bench [benchmark]...   corre los benchmarks dados, o todos
+ *    kanso_bench jobs             costo de lanzar y robar trabajos, y escalado con los trabajadores
+ *    kanso_bench scale            megapíxeles destino por segundo de cada filtro
+ *    kanso_bench raster           triángulos por segundo y tasa de relleno, por cantidad de hilos
+ *    kanso_bench math             transformaciones por lotes contra un ciclo de individuales,
+ *                                 vectores por segundo
+ *    kanso_bench noise            megapíxeles de ruido por segundo por tipo, y números aleatorios
+ *    kanso_bench decode [dir]     velocidad de decodificación de cada archivo que el manifiesto
+ *                                 de dir (tests/images) marca ok
+ *    kanso_bench pointer          costo por evento del puntero relativo y la tasa que reporta
+ *    kanso_bench hud              tiempo de CPU y bytes escritos por segundo del panel, en el
+ *                                 fotograma y en su propia capa
+ *    kanso_bench pacing           latencia de la entrada a la presentación del ciclo de
+ *                                 fotogramas, justo a tiempo contra dibujar en el 'callback' de
+ *                                 fotograma y presentación asíncrona (la sugerencia de
+ *                                 'tearing'), sobre un compositor simulado a 60 Hz
+ * Cada benchmark imprime la mejor de BENCH_RUNS corridas, así un caché frío o una corrida
+ * interrumpida no cuentan. Las rutas SIMD se eligen al compilar, compilar con -mavx2 para medir
+ * las de AVX2.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define KSO_LOG_IMPLEMENTATION
+
+#include "../log.h"
+#include "../defines.h"
+#include "../types.h"
+#include "../clock.h"
+#include "../thread.h"
+#include "../render.h"
+#include "../scale.h"
+#include "../raster.h"
+#include "../vector_math.h"
+#include "../random.h"
+#include "../noise.h"
+#include "../arena.h"
+#include "../image.h"
+#include "../pointer_motion.h"
+#include "../text.h"
+#include "../hud.h"
+#include "../frame_timing.h"
+
+#include "../linux/linux_clock.c"
+#include "../linux/linux_thread.c"
+#include "../scale.c"
+#include "../raster.c"
+#include "../vector_math.c"
+#include "../random.c"
+#include "../noise.c"
+#include "../image.c"
+#include "../pointer_motion.c"
+#include "../text.c"
+#include "../hud.c"
+#include "../frame_timing.c"
+
+#define BENCH_RUNS 5
+#define BENCH_JOB_BATCH 2048 // under JOB_QUEUE_SIZE | menos que JOB_QUEUE_SIZE
+#define BENCH_JOB_BATCHES 256
+#define BENCH_STEAL_WORK 2000 // xorshift steps per job, about a microsecond | un microsegundo
+#define BENCH_SCALING_COUNT (1 << 22)
+#define BENCH_RASTER_WIDTH 1920
+#define BENCH_RASTER_HEIGHT 1080
+#define BENCH_RASTER_SMALL_TRIANGLES 20'000 // about 50 pixels each | unos 50 píxeles cada uno
+#define BENCH_RASTER_LAYERS 8 // full screen quads, back to front | de atrás hacia adelante
+#define BENCH_MATH_BLOCKS (1 << 15) // 256K vectors, a few MB | 256K vectores, unos MB
+#define BENCH_MATH_COUNT (BENCH_MATH_BLOCKS * VECTOR_MATH_BLOCK_LANES)
+#define BENCH_NOISE_WIDTH 1920
+#define BENCH_NOISE_HEIGHT 1080
+#define BENCH_RANDOM_COUNT (1 << 22)
+#define BENCH_DECODE_CORPUS "tests/images"
+#define BENCH_DECODE_PIXELS (1 << 22) // per run, small images repeat | las pequeñas se repiten
+#define BENCH_DECODE_ARENA_SIZE (256ull * 1024 * 1024)
+#define BENCH_PATH_SIZE 512
+#define BENCH_POINTER_FRAMES 6000 // 100 s at 60 Hz | 100 s a 60 Hz
+#define BENCH_POINTER_FRAME_RATE 60
+#define BENCH_POINTER_DELTAS 4096 // power of two | potencia de dos
+#define BENCH_HUD_SECONDS 20
+#define BENCH_HUD_FRAME_RATE 60
+#define BENCH_HUD_LAYER_RATE 4 // refreshes per second, as the platform does | como la plataforma
+#define BENCH_HUD_LAYER_BUFFERS 2
+#define BENCH_PACING_FRAMES 6000
+#define BENCH_PACING_INTERVAL 16'666'667ull // nanoseconds, 60 Hz
+#define BENCH_PACING_LATCH 1'000'000ull // the compositor repaints this before vblank | antes
+
+#if defined(__AVX2__)
+	#define BENCH_SIMD "avx2"
+#elif defined(__SSE2__)
+	#define BENCH_SIMD "sse2"
+#else
+	#define BENCH_SIMD "scalar"
+#endif
+
+typedef void BenchFunction(void* context);
+
+/*
+ * [EN] Best wall time of BENCH_RUNS calls, in milliseconds.
+ * [ES] El mejor tiempo de BENCH_RUNS llamadas, en milisegundos.
+ */
+internal float64 benchBest(BenchFunction* function, void* context)
+{
+	float64 best = 0;
+	for (int32 run = 0; run < BENCH_RUNS; ++run) {
+		uint64 start = clockNowNanoseconds();
+		function(context);
+		float64 elapsed = (float64)(clockNowNanoseconds() - start) / NANOSECONDS_PER_MILLISECOND;
+		best = (run == 0 || elapsed < best) ? elapsed : best;
+	}
+	return best;
+}
+
+global_variable volatile uint32 bench_sink; // keeps the work alive | mantiene vivo el trabajo
+
+internal void benchEmptyJob(void* context)
+{
+}
+
+internal void benchWorkJob(void* context)
+{
+	uint32 random = (uint32)(uintptr_t)context | 1;
+	for (int32 i = 0; i < BENCH_STEAL_WORK; ++i) {
+		random ^= random << 13; // xorshift32
+		random ^= random >> 17;
+		random ^= random << 5;
+	}
+	bench_sink = random;
+}
+
+typedef struct {
+	JobFunction* function;
+} BenchJobs;
+
+/*
+ * [EN] Every job is spawned by the calling thread, the workers only get work by stealing it.
+ * [ES] El hilo que llama lanza todos los trabajos, los trabajadores sólo obtienen trabajo robando.
+ */
+internal void benchSpawnJobs(void* context)
+{
+	BenchJobs* jobs = context;
+	for (int32 batch = 0; batch < BENCH_JOB_BATCHES; ++batch) {
+		JobCounter counter = { 0 };
+		for (int32 i = 0; i < BENCH_JOB_BATCH; ++i) {
+			jobRun(jobs->function, (void*)(uintptr_t)(i + 1), &counter);
+		}
+		jobWait(&counter);
+	}
+}
+
+internal void benchScalingRows(void* context, int32 begin, int32 end)
+{
+	uint32 sum = 0;
+	for (int32 i = begin; i < end; ++i) {
+		uint32 random = (uint32)i | 1;
+		for (int32 step = 0; step < 16; ++step) {
+			random ^= random << 13;
+			random ^= random >> 17;
+			random ^= random << 5;
+		}
+		sum += random;
+	}
+	bench_sink += sum;
+}
+
+internal void benchScaling(void* context)
+{
+	threadParallelFor(BENCH_SCALING_COUNT, 1024, benchScalingRows, context);
+}
+
+/*
+ * [EN] Spawn is the cost of queueing and running an empty job on the spawning thread alone, steal
+ * is the throughput of small jobs that every other thread has to steal, and scaling is the
+ * speedup of threadParallelFor() over one thread. One thread is the engine without a job system,
+ * jobs run inline. Up to one thread per core, and at least two so stealing is measured.
+ * [ES] Lanzar es el costo de encolar y ejecutar un trabajo vacío sólo en el hilo que lanza, robar
+ * es el rendimiento de trabajos pequeños que cada otro hilo tiene que robar, y escalado es la
+ * aceleración de threadParallelFor() sobre un hilo. Un hilo es el motor sin sistema de trabajos,
+ * los trabajos se ejecutan en línea. Hasta un hilo por núcleo, y al menos dos para medir el robo.
+ */
+internal void benchJobs(void)
+{
+	int32 core_count = threadGetCoreCount();
+	float64 job_count = (float64)BENCH_JOB_BATCH * BENCH_JOB_BATCHES;
+	float64 single_thread = 0;
+	printf("jobs: %d cores\n", core_count);
+	int32 max_threads = (core_count > 2) ? core_count : 2;
+	for (int32 threads = 1; threads <= max_threads; ++threads) {
+		if (threads > 1 && !jobSystemStart(threads - 1, JOB_AFFINITY_NONE)) {
+			return;
+		}
+		BenchJobs empty = { .function = benchEmptyJob };
+		BenchJobs work = { .function = benchWorkJob };
+		float64 spawn = benchBest(benchSpawnJobs, &empty);
+		float64 steal = benchBest(benchSpawnJobs, &work);
+		float64 scaling = benchBest(benchScaling, nullptr);
+		single_thread = (threads == 1) ? scaling : single_thread;
+		printf("  %2d threads: spawn %6.1f ns/job, steal %6.2f Mjobs/s, scaling %6.2f ms %5.2fx\n",
+				jobSystemGetThreadCount(), spawn * 1e6 / job_count, job_count / (steal * 1e3),
+				scaling, single_thread / scaling);
+		jobSystemStop();
+	}
+}
+
+typedef bool8 BenchScaleFunction(Bitmap* destination, const Bitmap* source);
+
+typedef struct {
+	BenchScaleFunction* function;
+	Bitmap* destination;
+	const Bitmap* source;
+} BenchScale;
+
+internal void benchScaleRun(void* context)
+{
+	BenchScale* scale = context;
+	if (!scale->function(scale->destination, scale->source)) {
+		logFatal("Scale benchmark failed.");
+	}
+}
+
+internal bool8 benchAllocateBitmap(Bitmap* bitmap, int32 width, int32 height)
+{
+	*bitmap = (Bitmap){ .width = width, .height = height, .bytes_per_row = width * sizeof(uint32) };
+	bitmap->memory = malloc((uint64)bitmap->bytes_per_row * height);
+	if (bitmap->memory) { // touched once, page faults stay out of the runs | fuera de las corridas
+		memset(bitmap->memory, 0x5A, (uint64)bitmap->bytes_per_row * height);
+	}
+	return bitmap->memory != nullptr;
+}
+
+/*
+ * [EN] Upscaling to 1440p, halving it (the box filter's fast path) and a 3/4 downscale, on the
+ * calling thread alone and split across one thread per core.
+ * [ES] Escalar hacia arriba a 1440p, reducirlo a la mitad (la ruta rápida del filtro de caja) y
+ * una reducción a 3/4, sólo en el hilo que llama y dividido en un hilo por núcleo.
+ */
+internal void benchScale(void)
+{
+	struct { int32 source_width, source_height, width, height; } sizes[] = {
+		{ 1280, 720, 2560, 1440 }, { 2560, 1440, 1280, 720 }, { 2560, 1440, 1920, 1080 },
+	};
+	struct { const char* name; BenchScaleFunction* function; } filters[] = {
+		{ "nearest", scaleNearest }, { "bilinear", scaleBilinear }, { "box", scaleBox },
+	};
+	for (int32 threaded = 0; threaded < 2; ++threaded) {
+		if (threaded && (threadGetCoreCount() < 2 || !jobSystemStart(0, JOB_AFFINITY_NONE))) {
+			return;
+		}
+		printf("scale: %d threads\n", jobSystemGetThreadCount());
+		for (uint64 s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+			Bitmap source, destination;
+			if (!benchAllocateBitmap(&source, sizes[s].source_width, sizes[s].source_height)
+					|| !benchAllocateBitmap(&destination, sizes[s].width, sizes[s].height)) {
+				logFatal("Out of memory.");
+				return;
+			}
+			for (uint64 f = 0; f < sizeof(filters) / sizeof(filters[0]); ++f) {
+				BenchScale scale = { filters[f].function, &destination, &source };
+				float64 milliseconds = benchBest(benchScaleRun, &scale);
+				printf("  %-8s %4dx%-4d -> %4dx%-4d %8.1f Mpx/s\n", filters[f].name,
+						source.width, source.height, destination.width, destination.height,
+						(float64)destination.width * destination.height / (milliseconds * 1e3));
+			}
+			free(source.memory);
+			free(destination.memory);
+		}
+		jobSystemStop();
+	}
+}
+
+typedef struct {
+	Bitmap* target;
+	DepthBuffer* depth;
+	const RasterVertex* vertices;
+	int32 vertex_count;
+} BenchRaster;
+
+internal void benchRasterRun(void* context)
+{
+	BenchRaster* raster = context;
+	rasterClearDepth(raster->depth);
+	if (!rasterDrawTriangles(raster->target, raster->depth, raster->vertices,
+				raster->vertex_count)) {
+		logFatal("Raster benchmark failed.");
+	}
+}
+
+internal float32 benchRandom(uint32* state) // [0, 1)
+{
+	*state ^= *state << 13; // xorshift32
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return (float32)(*state >> 8) / (float32)(1u << 24);
+}
+
+/*
+ * [EN] Setup bound: many small triangles scattered over 1080p. Fill bound: full screen quads drawn
+ * back to front, so every layer passes the depth test and writes every pixel. Depth clears are
+ * part of both.
+ * [ES] Limitado por la preparación: muchos triángulos pequeños esparcidos en 1080p. Limitado por
+ * el relleno: cuadros de pantalla completa dibujados de atrás hacia adelante, así cada capa pasa
+ * la prueba de profundidad y escribe cada píxel. Limpiar la profundidad es parte de ambos.
+ */
+internal void benchRaster(void)
+{
+	int32 small_count = 3 * BENCH_RASTER_SMALL_TRIANGLES;
+	int32 fill_count = 6 * BENCH_RASTER_LAYERS;
+	RasterVertex* small = malloc(sizeof(RasterVertex) * small_count);
+	RasterVertex* fill = malloc(sizeof(RasterVertex) * fill_count);
+	Bitmap target;
+	DepthBuffer depth = { .width = BENCH_RASTER_WIDTH, .height = BENCH_RASTER_HEIGHT };
+	depth.memory = malloc(sizeof(float32) * BENCH_RASTER_WIDTH * BENCH_RASTER_HEIGHT);
+	if (!small || !fill || !depth.memory
+			|| !benchAllocateBitmap(&target, BENCH_RASTER_WIDTH, BENCH_RASTER_HEIGHT)) {
+		logFatal("Out of memory.");
+		return;
+	}
+
+	uint32 random = 0x1234'5678u;
+	float32 size = 14.0f / BENCH_RASTER_HEIGHT; // clip units, 7 pixels | unidades de recorte
+	for (int32 i = 0; i < small_count; i += 3) {
+		float32 x = (benchRandom(&random) * 2.0f) - 1.0f;
+		float32 y = (benchRandom(&random) * 2.0f) - 1.0f;
+		float32 z = benchRandom(&random);
+		for (int32 v = 0; v < 3; ++v) {
+			small[i + v] = (RasterVertex){ .x = x + ((v == 1) ? size : 0),
+				.y = y + ((v == 2) ? size : 0), .z = z, .w = 1.0f, .r = benchRandom(&random),
+				.g = 0.5f, .b = 0.25f };
+		}
+	}
+	for (int32 layer = 0; layer < BENCH_RASTER_LAYERS; ++layer) {
+		float32 z = 0.9f - (layer * (1.8f / BENCH_RASTER_LAYERS));
+		float32 corners[6][2] = {
+			{ -1, -1 }, { 1, -1 }, { 1, 1 }, { -1, -1 }, { 1, 1 }, { -1, 1 },
+		};
+		for (int32 v = 0; v < 6; ++v) {
+			fill[(6 * layer) + v] = (RasterVertex){ .x = corners[v][0], .y = corners[v][1],
+				.z = z, .w = 1.0f, .r = (float32)layer / BENCH_RASTER_LAYERS, .g = 1.0f, .b = 0 };
+		}
+	}
+
+	int32 core_count = threadGetCoreCount();
+	float64 pixels = (float64)BENCH_RASTER_WIDTH * BENCH_RASTER_HEIGHT;
+	printf("raster: %dx%d\n", BENCH_RASTER_WIDTH, BENCH_RASTER_HEIGHT);
+	for (int32 threads = 1; threads <= core_count; ++threads) {
+		if (threads > 1 && !jobSystemStart(threads - 1, JOB_AFFINITY_NONE)) {
+			break;
+		}
+		BenchRaster small_scene = { &target, &depth, small, small_count };
+		BenchRaster fill_scene = { &target, &depth, fill, fill_count };
+		float64 small_time = benchBest(benchRasterRun, &small_scene);
+		float64 fill_time = benchBest(benchRasterRun, &fill_scene);
+		float64 fill_rate = pixels * BENCH_RASTER_LAYERS / (fill_time * 1e3);
+		printf("  %2d threads: %7.2f Mtris/s, fill %8.1f Mpx/s, %7.1f Mpx/s per thread\n",
+				threads, BENCH_RASTER_SMALL_TRIANGLES / (small_time * 1e3), fill_rate,
+				fill_rate / threads);
+		jobSystemStop();
+	}
+	free(small);
+	free(fill);
+	free(depth.memory);
+	free(target.memory);
+}
+
+typedef struct {
+	Mat4 m;
+	Mat3 m3;
+	Vec3x8* points;
+	Vec4x8* points_out;
+	Vec3x8* vectors_out;
+	Vec4* vec4s;
+	Vec4* vec4s_out;
+} BenchMath;
+
+internal void benchMathPointsSingle(void* context)
+{
+	BenchMath* math = context;
+	for (int32 i = 0; i < BENCH_MATH_COUNT; ++i) {
+		const Vec3x8* in = &math->points[i / VECTOR_MATH_BLOCK_LANES];
+		Vec4x8* out = &math->points_out[i / VECTOR_MATH_BLOCK_LANES];
+		int32 lane = i % VECTOR_MATH_BLOCK_LANES;
+		Vec4 point = mat4TransformPoint(&math->m, (Vec3){ in->x[lane], in->y[lane], in->z[lane] });
+		out->x[lane] = point.x;
+		out->y[lane] = point.y;
+		out->z[lane] = point.z;
+		out->w[lane] = point.w;
+	}
+}
+
+internal void benchMathPointsWide(void* context)
+{
+	BenchMath* math = context;
+	mat4TransformPointsWide(&math->m, math->points, math->points_out, BENCH_MATH_BLOCKS);
+}
+
+internal void benchMathVectorsSingle(void* context)
+{
+	BenchMath* math = context;
+	for (int32 i = 0; i < BENCH_MATH_COUNT; ++i) {
+		const Vec3x8* in = &math->points[i / VECTOR_MATH_BLOCK_LANES];
+		Vec3x8* out = &math->vectors_out[i / VECTOR_MATH_BLOCK_LANES];
+		int32 lane = i % VECTOR_MATH_BLOCK_LANES;
+		Vec3 v = mat3TransformVec3(&math->m3, (Vec3){ in->x[lane], in->y[lane], in->z[lane] });
+		out->x[lane] = v.x;
+		out->y[lane] = v.y;
+		out->z[lane] = v.z;
+	}
+}
+
+internal void benchMathVectorsWide(void* context)
+{
+	BenchMath* math = context;
+	mat3TransformVec3sWide(&math->m3, math->points, math->vectors_out, BENCH_MATH_BLOCKS);
+}
+
+internal void benchMathNormalizeSingle(void* context)
+{
+	BenchMath* math = context;
+	for (int32 i = 0; i < BENCH_MATH_COUNT; ++i) {
+		const Vec3x8* in = &math->points[i / VECTOR_MATH_BLOCK_LANES];
+		Vec3x8* out = &math->vectors_out[i / VECTOR_MATH_BLOCK_LANES];
+		int32 lane = i % VECTOR_MATH_BLOCK_LANES;
+		Vec3 v = vec3Normalize((Vec3){ in->x[lane], in->y[lane], in->z[lane] });
+		out->x[lane] = v.x;
+		out->y[lane] = v.y;
+		out->z[lane] = v.z;
+	}
+}
+
+internal void benchMathNormalizeWide(void* context)
+{
+	BenchMath* math = context;
+	vec3NormalizeWide(math->points, math->vectors_out, BENCH_MATH_BLOCKS);
+}
+
+internal void benchMathVec4sSingle(void* context)
+{
+	BenchMath* math = context;
+	for (int32 i = 0; i < BENCH_MATH_COUNT; ++i) {
+		math->vec4s_out[i] = mat4TransformVec4(&math->m, math->vec4s[i]);
+	}
+}
+
+internal void benchMathVec4s(void* context)
+{
+	BenchMath* math = context;
+	mat4TransformVec4s(&math->m, math->vec4s, math->vec4s_out, BENCH_MATH_COUNT);
+}
+
+/*
+ * [EN] Each batch function over BENCH_MATH_COUNT elements against the single element function
+ * called in a loop over the same data, on one thread. The single loops are what the batches
+ * replace, so the ratio is the win of calling them.
+ * [ES] Cada función por lotes sobre BENCH_MATH_COUNT elementos contra la función de un elemento
+ * llamada en un ciclo sobre los mismos datos, en un hilo. Los ciclos individuales son lo que los
+ * lotes reemplazan, así la proporción es lo que se gana al llamarlos.
+ */
+internal void benchMath(void)
+{
+	BenchMath math = {
+		.m = mat4FromTransform((Vec3){ 12.5f, -3.25f, 7.0f },
+				quatFromAxisAngle((Vec3){ 0, 1.0f, 0 }, 0.5f), (Vec3){ 2.0f, 2.0f, 2.0f }),
+		.points = malloc(sizeof(Vec3x8) * BENCH_MATH_BLOCKS),
+		.points_out = malloc(sizeof(Vec4x8) * BENCH_MATH_BLOCKS),
+		.vectors_out = malloc(sizeof(Vec3x8) * BENCH_MATH_BLOCKS),
+		.vec4s = malloc(sizeof(Vec4) * BENCH_MATH_COUNT),
+		.vec4s_out = malloc(sizeof(Vec4) * BENCH_MATH_COUNT),
+	};
+	if (!math.points || !math.points_out || !math.vectors_out || !math.vec4s || !math.vec4s_out) {
+		logFatal("Out of memory.");
+		return;
+	}
+	math.m3 = mat3FromMat4(&math.m);
+	uint32 random = 0x2545'F491u;
+	for (int32 block = 0; block < BENCH_MATH_BLOCKS; ++block) {
+		for (int32 lane = 0; lane < VECTOR_MATH_BLOCK_LANES; ++lane) {
+			math.points[block].x[lane] = benchRandom(&random) - 0.5f;
+			math.points[block].y[lane] = benchRandom(&random) - 0.5f;
+			math.points[block].z[lane] = benchRandom(&random) - 0.5f;
+		}
+	}
+	for (int32 i = 0; i < BENCH_MATH_COUNT; ++i) {
+		math.vec4s[i] = (Vec4){ benchRandom(&random), benchRandom(&random),
+			benchRandom(&random), 1.0f };
+	}
+	memset(math.points_out, 0, sizeof(Vec4x8) * BENCH_MATH_BLOCKS);
+	memset(math.vectors_out, 0, sizeof(Vec3x8) * BENCH_MATH_BLOCKS);
+	memset(math.vec4s_out, 0, sizeof(Vec4) * BENCH_MATH_COUNT);
+
+	struct { const char* name; BenchFunction* single; BenchFunction* batch; } cases[] = {
+		{ "mat4TransformPointsWide", benchMathPointsSingle, benchMathPointsWide },
+		{ "mat3TransformVec3sWide", benchMathVectorsSingle, benchMathVectorsWide },
+		{ "vec3NormalizeWide", benchMathNormalizeSingle, benchMathNormalizeWide },
+		{ "mat4TransformVec4s", benchMathVec4sSingle, benchMathVec4s },
+	};
+	printf("math: %d vectors\n", BENCH_MATH_COUNT);
+	for (uint64 c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c) {
+		float64 batch = BENCH_MATH_COUNT / (benchBest(cases[c].batch, &math) * 1e3);
+		float64 single = BENCH_MATH_COUNT / (benchBest(cases[c].single, &math) * 1e3);
+		printf("  %-24s %8.1f Mvec/s, single loop %8.1f Mvec/s, %5.2fx\n", cases[c].name,
+				batch, single, batch / single);
+	}
+	bench_sink = (uint32)math.points_out[1].w[1] + (uint32)math.vectors_out[1].x[1]
+			+ (uint32)math.vec4s_out[1].x;
+	free(math.points);
+	free(math.points_out);
+	free(math.vectors_out);
+	free(math.vec4s);
+	free(math.vec4s_out);
+}
+
+typedef struct {
+	Bitmap* target;
+	NoiseParameters parameters;
+} BenchNoise;
+
+internal void benchNoiseRun(void* context)
+{
+	BenchNoise* noise = context;
+	noiseFill(noise->target, &noise->parameters);
+}
+
+typedef struct {
+	uint32* numbers;
+	uint64 seed;
+} BenchRandom;
+
+internal void benchRandomNext(void* context)
+{
+	BenchRandom* numbers = context;
+	Random random;
+	randomSeed(&random, numbers->seed);
+	for (int32 i = 0; i < BENCH_RANDOM_COUNT; ++i) {
+		numbers->numbers[i] = (uint32)(randomNext(&random) >> 32);
+	}
+}
+
+internal void benchRandomWide(void* context)
+{
+	BenchRandom* numbers = context;
+	RandomWide random;
+	randomWideSeed(&random, numbers->seed);
+	randomWideFill(&random, numbers->numbers, BENCH_RANDOM_COUNT);
+}
+
+/*
+ * [EN] 1080p fills of each noise type with one and four octaves, per thread count, then 32-bit
+ * numbers from randomWideFill() against a loop of randomNext().
+ * [ES] Rellenos de 1080p de cada tipo de ruido con una y cuatro octavas, por cantidad de hilos,
+ * luego números de 32 bits de randomWideFill() contra un ciclo de randomNext().
+ */
+internal void benchNoise(void)
+{
+	Bitmap target;
+	uint32* numbers = malloc(sizeof(uint32) * BENCH_RANDOM_COUNT);
+	if (!numbers || !benchAllocateBitmap(&target, BENCH_NOISE_WIDTH, BENCH_NOISE_HEIGHT)) {
+		logFatal("Out of memory.");
+		return;
+	}
+	struct { const char* name; NoiseType type; } types[] = {
+		{ "value", NOISE_VALUE }, { "perlin", NOISE_PERLIN }, { "simplex", NOISE_SIMPLEX },
+	};
+	int32 octaves[] = { 1, 4 };
+	int32 core_count = threadGetCoreCount();
+	float64 pixels = (float64)BENCH_NOISE_WIDTH * BENCH_NOISE_HEIGHT;
+	printf("noise: %dx%d, Mpx/s with 1 and 4 octaves\n", BENCH_NOISE_WIDTH, BENCH_NOISE_HEIGHT);
+	for (int32 threads = 1; threads <= core_count; ++threads) {
+		if (threads > 1 && !jobSystemStart(threads - 1, JOB_AFFINITY_NONE)) {
+			break;
+		}
+		for (uint64 t = 0; t < sizeof(types) / sizeof(types[0]); ++t) {
+			printf("  %2d threads, %-8s", threads, types[t].name);
+			for (uint64 o = 0; o < sizeof(octaves) / sizeof(octaves[0]); ++o) {
+				BenchNoise noise = { &target, { .type = types[t].type, .seed = 7,
+					.frequency = 1.0f / 64, .octaves = octaves[o] } };
+				float64 milliseconds = benchBest(benchNoiseRun, &noise);
+				printf(" %8.1f", pixels / (milliseconds * 1e3));
+			}
+			printf("\n");
+		}
+		jobSystemStop();
+	}
+
+	BenchRandom random = { numbers, 7 };
+	float64 single = BENCH_RANDOM_COUNT / (benchBest(benchRandomNext, &random) * 1e3);
+	float64 wide = BENCH_RANDOM_COUNT / (benchBest(benchRandomWide, &random) * 1e3);
+	printf("  random: randomWideFill %8.1f M/s, randomNext loop %8.1f M/s\n", wide, single);
+	bench_sink = numbers[1] + ((uint32*)target.memory)[1];
+	free(numbers);
+	free(target.memory);
+}
+
+[[nodiscard]] internal uint8* benchReadFile(const char* path, uint64* size)
+{
+	FILE* file = fopen(path, "rb");
+	if (!file) {
+		return nullptr;
+	}
+	fseek(file, 0, SEEK_END);
+	long length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	uint8* data = (length > 0) ? malloc((uint64)length) : nullptr;
+	if (data && fread(data, 1, (uint64)length, file) != (uint64)length) {
+		free(data);
+		data = nullptr;
+	}
+	fclose(file);
+	*size = (uint64)length;
+	return data;
+}
+
+typedef struct {
+	const uint8* data;
+	uint64 size;
+	MemoryArena* arena;
+	int32 repeats;
+} BenchDecode;
+
+internal void benchDecodeRun(void* context)
+{
+	BenchDecode* decode = context;
+	for (int32 i = 0; i < decode->repeats; ++i) {
+		uint64 mark = arenaMark(decode->arena);
+		Bitmap image;
+		if (!imageDecode(decode->data, decode->size, decode->arena, &image)) {
+			logFatal("Decode benchmark failed.");
+		}
+		arenaRestore(decode->arena, mark);
+	}
+}
+
+/*
+ * [EN] Compressed megabytes and decoded megapixels per second of each file, one thread. Images
+ * under BENCH_DECODE_PIXELS are decoded several times per run. Point it at a directory of real
+ * assets for numbers that matter, its manifest only needs "<file> ok" lines.
+ * [ES] Megabytes comprimidos y megapíxeles decodificados por segundo de cada archivo, un hilo. Las
+ * imágenes de menos de BENCH_DECODE_PIXELS se decodifican varias veces por corrida. Para números
+ * que importan usar un directorio de recursos reales, su manifiesto sólo necesita líneas
+ * "<archivo> ok".
+ */
+internal void benchDecode(const char* corpus)
+{
+	char path[BENCH_PATH_SIZE];
+	snprintf(path, sizeof(path), "%s/manifest.txt", corpus);
+	FILE* manifest = fopen(path, "r");
+	void* memory = malloc(BENCH_DECODE_ARENA_SIZE);
+	if (!manifest || !memory) {
+		logError("Can't open %s.", path);
+		if (manifest) {
+			fclose(manifest);
+		}
+		free(memory);
+		return;
+	}
+	MemoryArena arena = arenaCreate(memory, BENCH_DECODE_ARENA_SIZE);
+	printf("decode: %s\n", corpus);
+
+	char line[BENCH_PATH_SIZE];
+	while (fgets(line, sizeof(line), manifest)) {
+		char name[128], expected[8];
+		if (line[0] == '#' || sscanf(line, "%127s %7s", name, expected) != 2
+				|| strcmp(expected, "ok")) {
+			continue;
+		}
+		snprintf(path, sizeof(path), "%s/%s", corpus, name);
+		uint64 size;
+		uint8* data = benchReadFile(path, &size);
+		Bitmap image;
+		if (!data || !imageDecode(data, size, &arena, &image)) {
+			logError("Can't decode %s.", path);
+			free(data);
+			continue;
+		}
+		arenaRestore(&arena, 0);
+
+		float64 pixels = (float64)image.width * image.height;
+		BenchDecode decode = { data, size, &arena, (int32)(BENCH_DECODE_PIXELS / pixels) + 1 };
+		float64 milliseconds = benchBest(benchDecodeRun, &decode) / decode.repeats;
+		float64 megapixels = pixels / (milliseconds * 1e3);
+		printf("  %-24s %5dx%-5d %8.1f MB/s %8.1f Mpx/s\n", name, image.width, image.height,
+				(float64)size / (milliseconds * 1e3), megapixels);
+		free(data);
+	}
+	fclose(manifest);
+	free(memory);
+}
+
+typedef struct {
+	const int32* deltas; // 24.8 fixed point | punto fijo 24.8
+	PointerMotion motion;
+	PointerMotion last_frame;
+	uint32 device_rate; // events per second | eventos por segundo
+	uint64 events;
+} BenchPointer;
+
+/*
+ * [EN] What the platform does for one device over BENCH_POINTER_FRAMES frames: every event of a
+ * frame added as it arrives, with the device's microsecond clock, then the frame takes the sum.
+ * [ES] Lo que hace la plataforma para un dispositivo durante BENCH_POINTER_FRAMES fotogramas: cada
+ * evento de un fotograma sumado al llegar, con el reloj en microsegundos del dispositivo, luego el
+ * fotograma toma la suma.
+ */
+internal void benchPointerRun(void* context)
+{
+	BenchPointer* pointer = context;
+	uint64 interval = 1'000'000 / pointer->device_rate; // microseconds | microsegundos
+	uint64 time = 0;
+	uint32 d = 0;
+	pointer->events = 0;
+	for (int32 frame = 0; frame < BENCH_POINTER_FRAMES; ++frame) {
+		uint64 frame_end = (uint64)(frame + 1) * 1'000'000 / BENCH_POINTER_FRAME_RATE;
+		while (time < frame_end) {
+			const int32* delta = &pointer->deltas[d];
+			pointerMotionAdd(&pointer->motion, time, delta[0], delta[1], delta[2], delta[3]);
+			d = (d + 4) & (BENCH_POINTER_DELTAS - 1);
+			time += interval;
+		}
+		pointer->last_frame = pointerMotionTake(&pointer->motion);
+		pointer->events += pointer->last_frame.event_count;
+	}
+}
+
+/*
+ * [EN] Cost per event and per frame of the relative pointer path, and the event rate the HUD would
+ * show, for a 125 Hz office mouse, a 1000 Hz gaming mouse and an 8000 Hz one. The rate comes from
+ * the device timestamps, so it must equal the device rate whatever the frame rate.
+ * [ES] Costo por evento y por fotograma del camino del puntero relativo, y la tasa de eventos que
+ * mostraría el HUD, para un ratón de oficina de 125 Hz, uno de juego de 1000 Hz y uno de 8000 Hz.
+ * La tasa viene de las marcas de tiempo del dispositivo, así que debe ser la del dispositivo sin
+ * importar la tasa de fotogramas.
+ */
+internal void benchPointer(void)
+{
+	int32* deltas = malloc(sizeof(int32) * BENCH_POINTER_DELTAS);
+	if (!deltas) {
+		logFatal("Out of memory.");
+		return;
+	}
+	uint32 random = 0x5EED'1234u;
+	for (int32 i = 0; i < BENCH_POINTER_DELTAS; ++i) {
+		deltas[i] = (int32)((benchRandom(&random) - 0.5f) * 16.0f * POINTER_MOTION_FIXED_ONE);
+	}
+	uint32 device_rates[] = { 125, 1000, 8000 };
+	printf("pointer: %d frames at %d Hz\n", BENCH_POINTER_FRAMES, BENCH_POINTER_FRAME_RATE);
+	for (uint64 r = 0; r < sizeof(device_rates) / sizeof(device_rates[0]); ++r) {
+		BenchPointer pointer = { .deltas = deltas, .device_rate = device_rates[r] };
+		float64 milliseconds = benchBest(benchPointerRun, &pointer);
+		float64 nanoseconds = milliseconds * NANOSECONDS_PER_MILLISECOND;
+		printf("  %5u Hz device: %6.2f ns/event, %7.1f ns/frame, %6.1f events/frame, "
+				"reported %7.1f events/s\n", device_rates[r], nanoseconds / pointer.events,
+				nanoseconds / BENCH_POINTER_FRAMES, (float64)pointer.events / BENCH_POINTER_FRAMES,
+				pointerMotionEventRate(&pointer.last_frame));
+		bench_sink = (uint32)pointer.last_frame.dx;
+	}
+	free(deltas);
+}
+
+internal uint64 benchThreadCpuNanoseconds(void)
+{
+	struct timespec time;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+	return ((uint64)time.tv_sec * NANOSECONDS_PER_SECOND) + (uint64)time.tv_nsec;
+}
+
+/*
+ * [EN] Stats of a steady 60 Hz session, the frame and render times jitter a little.
+ * [ES] Estadísticas de una sesión estable a 60 Hz, los tiempos de fotograma y dibujo varían poco.
+ */
+internal void benchHudFrame(Hud* hud, HudBufferStats* stats, uint32* random, int32 frame)
+{
+	hudRecordFrameTime(hud, 16.0f + (benchRandom(random) * 1.5f));
+	stats->render_time = 3.0f + (benchRandom(random) * 0.5f);
+	stats->presentation_latency = 8.0f + (benchRandom(random) * 2.0f);
+	stats->buffer_index = frame % 3;
+	stats->events_per_second = (float32)(240 + (frame / BENCH_HUD_FRAME_RATE) % 3);
+}
+
+/*
+ * [EN] BENCH_HUD_SECONDS of a 60 Hz session three ways: the panel drawn into every 1080p frame,
+ * the layer redrawn whole at each refresh, and the layer redrawn only where hudUpdateLayer() says
+ * it changed. The layer has two buffers like the platform's, each one redraws the changes of both
+ * refreshes it missed. Bytes written count every pixel store, damaged bytes are what the
+ * compositor has to read again. CPU time is the thread's, not wall time.
+ * [ES] BENCH_HUD_SECONDS de una sesión a 60 Hz de tres formas: el panel dibujado en cada
+ * fotograma de 1080p, la capa redibujada completa en cada refresco, y la capa redibujada sólo donde
+ * hudUpdateLayer() dice que cambió. La capa tiene dos 'buffers' como la de la plataforma, cada uno
+ * redibuja los cambios de los dos refrescos que se perdió. Los bytes escritos cuentan cada
+ * escritura de píxel, los bytes dañados son lo que el compositor tiene que volver a leer. El tiempo
+ * de CPU es el del hilo, no el del reloj.
+ */
+internal void benchHud(void)
+{
+	Hud hud;
+	Bitmap frame, layer;
+	if (!hudInitialize(&hud) || !benchAllocateBitmap(&frame, 1920, 1080)) {
+		logFatal("Can't initialize the HUD.");
+		return;
+	}
+	hudToggle(&hud);
+	int32 layer_width, layer_height;
+	hudLayerSize(&hud, &layer_width, &layer_height);
+	if (!benchAllocateBitmap(&layer, layer_width, layer_height)) {
+		logFatal("Out of memory.");
+		return;
+	}
+	int32 frames = BENCH_HUD_SECONDS * BENCH_HUD_FRAME_RATE;
+	int32 frames_per_refresh = BENCH_HUD_FRAME_RATE / BENCH_HUD_LAYER_RATE;
+	printf("hud: %d s at %d Hz, per second\n", BENCH_HUD_SECONDS, BENCH_HUD_FRAME_RATE);
+
+	for (int32 mode = 0; mode < 3; ++mode) {
+		HudBufferStats stats = { .width = 1920, .height = 1080, .bytes_per_row = 1920 * 4,
+			.buffer_count = 3, .max_event_dispatch_time = 0.05f };
+		HudRectangle stale[BENCH_HUD_LAYER_BUFFERS][2 * HUD_LAYER_CHANGES];
+		int32 stale_count[BENCH_HUD_LAYER_BUFFERS] = { 0 };
+		int32 refresh = 0;
+		uint32 random = 0xD00D'FEEDu;
+		uint64 cpu_time = 0;
+		float64 written = 0;
+		float64 damaged = 0;
+		for (int32 f = 0; f < frames; ++f) {
+			benchHudFrame(&hud, &stats, &random, f);
+			if (mode == 0) {
+				uint64 start = benchThreadCpuNanoseconds();
+				hudDraw(&hud, &frame, &stats);
+				cpu_time += benchThreadCpuNanoseconds() - start;
+				written += (float64)layer_width * layer_height; // the panel and margin | y margen
+				continue;
+			} else if (f % frames_per_refresh) {
+				continue;
+			}
+
+			uint64 start = benchThreadCpuNanoseconds();
+			HudLayerChanges changes = hudUpdateLayer(&hud, &stats);
+			if (mode == 1 || refresh == 0) {
+				changes = (HudLayerChanges){ .areas = { { 0, 0, layer_width, layer_height } },
+					.count = 1 };
+			}
+			for (int32 b = 0; b < BENCH_HUD_LAYER_BUFFERS; ++b) {
+				for (int32 i = 0; i < changes.count; ++i) {
+					stale[b][stale_count[b]++] = changes.areas[i];
+				}
+			}
+			int32 b = refresh % BENCH_HUD_LAYER_BUFFERS;
+			hudDrawLayer(&hud, &layer, stale[b], stale_count[b]);
+			cpu_time += benchThreadCpuNanoseconds() - start;
+			for (int32 i = 0; i < stale_count[b]; ++i) {
+				written += (float64)stale[b][i].width * stale[b][i].height;
+			}
+			for (int32 i = 0; i < changes.count; ++i) {
+				damaged += (float64)changes.areas[i].width * changes.areas[i].height;
+			}
+			stale_count[b] = 0;
+			refresh++;
+		}
+		const char* names[] = { "in frame", "layer whole", "layer changes" };
+		printf("  %-14s %8.3f ms CPU, %8.1f KB written, %8.1f KB damaged\n", names[mode],
+				(float64)cpu_time / NANOSECONDS_PER_MILLISECOND / BENCH_HUD_SECONDS,
+				written * sizeof(uint32) / 1024 / BENCH_HUD_SECONDS,
+				((mode == 0) ? written : damaged) * sizeof(uint32) / 1024 / BENCH_HUD_SECONDS);
+	}
+	free(frame.memory);
+	free(layer.memory);
+	hudDestroy(&hud);
+}
+
+typedef enum {
+	BENCH_PACING_AT_CALLBACK, // the loop before user-034, --no-pacing | el ciclo anterior
+	BENCH_PACING_JUST_IN_TIME,
+	BENCH_PACING_ASYNC, // --tearing, shown at its commit | mostrado al confirmarse
+	BENCH_PACING_MODE_COUNT,
+} BenchPacingMode;
+
+internal int32 benchCompareUint64(const void* a, const void* b)
+{
+	uint64 x = *(const uint64*)a;
+	uint64 y = *(const uint64*)b;
+	return (x > y) - (x < y);
+}
+
+/*
+ * [EN] A compositor that repaints BENCH_PACING_LATCH before each vblank and shows the last frame
+ * committed by then, sending its frame callback a little after. Render costs vary between 2.5 and
+ * 4 ms with a 10 ms spike every 100 frames, a poll woken at the render deadline is up to a
+ * millisecond late. The latency goes from the moment the frame samples its input to the vblank
+ * that shows it, the FramePacer is the engine's own. With the tearing hint a frame starts once the
+ * last one is committed and shows as soon as it's done, mid scanout. It's a model, not a
+ * measurement: the live numbers are the HUD's and kanso_compositor's latency scenario, with and
+ * without --no-pacing and --tearing.
+ * [ES] Un compositor que repinta BENCH_PACING_LATCH antes de cada 'vblank' y muestra el último
+ * fotograma confirmado para entonces, enviando su 'callback' de fotograma un poco después. Los
+ * costos de dibujo varían entre 2.5 y 4 ms con un pico de 10 ms cada 100 fotogramas, un poll
+ * despertado en el límite para dibujar se retrasa hasta un milisegundo. La latencia va desde que el
+ * fotograma lee su entrada hasta el 'vblank' que lo muestra, el FramePacer es el del motor. Con la
+ * sugerencia de 'tearing' un fotograma empieza cuando el anterior se confirma y se muestra en
+ * cuanto termina, a mitad del barrido. Es un modelo, no una medición: los números en vivo son los
+ * del panel y del escenario latency de kanso_compositor, con y sin --no-pacing y --tearing.
+ */
+internal void benchPacing(void)
+{
+	uint64* latencies = malloc(sizeof(uint64) * BENCH_PACING_FRAMES);
+	if (!latencies) {
+		logFatal("Out of memory.");
+		return;
+	}
+	const char* names[] = { "at callback", "just in time", "async" };
+	printf("pacing: %d frames on a simulated 60 Hz compositor, input to present\n",
+			BENCH_PACING_FRAMES);
+	for (int32 mode = 0; mode < BENCH_PACING_MODE_COUNT; ++mode) {
+		FramePacer pacer;
+		framePacerInitialize(&pacer);
+		uint32 random = 0xFEED'BEEFu;
+		uint64 vblank = 1; // index of the last one that showed a new frame | del último
+		uint64 frame_done = BENCH_PACING_INTERVAL;
+		framePacerFrameDone(&pacer, frame_done);
+		uint64 total = 0;
+		int32 missed = 0;
+		for (int32 f = 0; f < BENCH_PACING_FRAMES; ++f) {
+			uint64 cost = 2'500'000ull + (uint64)(benchRandom(&random) * 1'500'000.0f);
+			cost = (f % 100 == 99) ? 10'000'000ull : cost;
+			uint64 start = frame_done;
+			if (mode == BENCH_PACING_ASYNC) {
+				latencies[f] = cost;
+				total += cost;
+				frame_done = start + cost + (uint64)(benchRandom(&random) * 300'000.0f);
+				continue;
+			}
+			uint64 deadline = framePacerRenderDeadline(&pacer);
+			if (mode == BENCH_PACING_JUST_IN_TIME && deadline > frame_done) {
+				start = deadline + (uint64)(benchRandom(&random) * 1'000'000.0f);
+			}
+			uint64 shown = vblank + 1;
+			while ((shown * BENCH_PACING_INTERVAL) - BENCH_PACING_LATCH < start + cost) {
+				shown++;
+			}
+			missed += shown > vblank + 1;
+			vblank = shown;
+			latencies[f] = (vblank * BENCH_PACING_INTERVAL) - start;
+			total += latencies[f];
+			frame_done = (vblank * BENCH_PACING_INTERVAL)
+				+ (uint64)(benchRandom(&random) * 300'000.0f);
+			framePacerFrameDone(&pacer, frame_done);
+			framePacerRecordRenderCost(&pacer, cost);
+		}
+		qsort(latencies, BENCH_PACING_FRAMES, sizeof(uint64), benchCompareUint64);
+		printf("  %-13s %6.2f ms average, %6.2f ms p99, %5.2f%% frames missed a vblank\n",
+				names[mode], clockNanosecondsToMilliseconds(total / BENCH_PACING_FRAMES),
+				clockNanosecondsToMilliseconds(latencies[BENCH_PACING_FRAMES * 99 / 100]),
+				100.0 * missed / BENCH_PACING_FRAMES);
+	}
+	free(latencies);
+}
+
+int32 main(int32 argument_count, char** arguments)
+{
+	bool8 all = argument_count == 1;
+	printf("kanso_bench, %s build\n", BENCH_SIMD);
+	for (int32 i = 1; i < argument_count || all; ++i) {
+		const char* bench = all ? "all" : arguments[i];
+		bool8 known = false;
+		if (all || !strcmp(bench, "jobs")) {
+			benchJobs();
+			known = true;
+		}
+		if (all || !strcmp(bench, "scale")) {
+			benchScale();
+			known = true;
+		}
+		if (all || !strcmp(bench, "raster")) {
+			benchRaster();
+			known = true;
+		}
+		if (all || !strcmp(bench, "math")) {
+			benchMath();
+			known = true;
+		}
+		if (all || !strcmp(bench, "noise")) {
+			benchNoise();
+			known = true;
+		}
+		if (all || !strcmp(bench, "decode")) {
+			const char* corpus = BENCH_DECODE_CORPUS;
+			if (!all && i + 1 < argument_count && strchr(arguments[i + 1], '/')) {
+				corpus = arguments[++i];
+			}
+			benchDecode(corpus);
+			known = true;
+		}
+		if (all || !strcmp(bench, "pointer")) {
+			benchPointer();
+			known = true;
+		}
+		if (all || !strcmp(bench, "hud")) {
+			benchHud();
+			known = true;
+		}
+		if (all || !strcmp(bench, "pacing")) {
+			benchPacing();
+			known = true;
+		}
+		if (!known) {
+			fprintf(stderr, "usage: %s [jobs | scale | raster | math | noise | decode [dir]"
+					" | pointer | hud | pacing]...\n", arguments[0]);
+			return EXIT_FAILURE;
+		}
+		if (all) {
+			break;
+		}
+	}
+	return EXIT_SUCCESS;
+}
+
+/* 18/10/2026 - kanso engine */
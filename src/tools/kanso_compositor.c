@@ -0,0 +1,1495 @@
+/* kanso_compositor.c: wayland compositor stand-in | compositor wayland sustituto */
+/*
+ * [EN] Usage:
+ *    kanso_compositor [options] [scenario]... -- <client> [arguments]
+ * Runs <client> against a minimal compositor, no display needed: wl_compositor, wl_shm, wl_seat,
+ * xdg_wm_base and wp_tearing_control_manager_v1, the client gets its end of a socketpair() through
+ * WAYLAND_SOCKET. Once the client
+ * shows its first frame every scenario runs in order (all of them when none is given), each one
+ * prints what it measured. Exits with a failure when the client never shows a frame, dies, or
+ * doesn't quit when asked to.
+ *    startup         always measured: spawn to the first configure ack and to the first frame,
+ *                    which must have the configured size and be drawn (not a blank buffer)
+ *    frames          steady frame callbacks and buffer releases at --refresh
+ *    resize          a configure with a new size every 1/--resize-rate, a resize storm
+ *    pointer         --pointer-rate motion events per second over the window, a pointer flood
+ *                    (this and latency also report the image set_cursor gave the pointer, and
+ *                    fail on a set_cursor without the serial of the last enter)
+ *    latency         a 1000 Hz mouse over the window, input to present: from each motion event to
+ *                    the vblank that shows the first commit after it, or to that commit when the
+ *                    surface hints async presentation (a lower bound, the client may draw that
+ *                    commit before reading the event)
+ *    close           xdg_toplevel.close, until the client disconnects
+ * Pings go out at --ping-rate during every scenario, the pong latency is how long the client takes
+ * to get to its events under that load.
+ *    --refresh <hz>          vblanks per second, each one shows the last commit (60)
+ *    --resize-rate <hz>      configures per second of the resize scenario (240)
+ *    --pointer-rate <hz>     motion events per second of the pointer scenario (8000)
+ *    --ping-rate <hz>        pings per second (20)
+ *    --duration <ms>         length of each scenario but close (3000)
+ *    --size <w>x<h>          size of the first configure, 0x0 lets the client choose (0x0)
+ *    --first-frame-budget <ms>  fails when the first frame takes longer since spawn (no budget)
+ * Time to first frame test, with a size that makes the client reallocate its buffers:
+ *    kanso_compositor --size 800x600 --first-frame-budget 250 close -- bin/linux_main
+ * Latency with and without the tearing hint:
+ *    kanso_compositor latency -- bin/linux_main
+ *    kanso_compositor latency -- bin/linux_main --tearing
+ * [ES] Uso:
+ *    kanso_compositor [opciones] [escenario]... -- <cliente> [argumentos]
+ * Corre <cliente> contra un compositor mínimo, sin pantalla: wl_compositor, wl_shm, wl_seat,
+ * xdg_wm_base y wp_tearing_control_manager_v1, el cliente recibe su extremo de un socketpair() por
+ * WAYLAND_SOCKET. Una vez que el
+ * cliente muestra su primer fotograma cada escenario corre en orden (todos cuando no se da
+ * ninguno), cada uno imprime lo que midió. Sale con un fallo cuando el cliente nunca muestra un
+ * fotograma, muere, o no termina cuando se le pide.
+ *    startup         siempre se mide: del lanzamiento al 'ack' de la primera configuración y al
+ *                    primer fotograma, que debe tener el tamaño configurado y estar dibujado (no
+ *                    un 'buffer' en blanco)
+ *    frames          'callbacks' de fotograma y liberaciones de 'buffers' estables a --refresh
+ *    resize          una configuración con un tamaño nuevo cada 1/--resize-rate, una tormenta de
+ *                    cambios de tamaño
+ *    pointer         --pointer-rate eventos de movimiento por segundo sobre la ventana, una
+ *                    inundación del puntero (éste y latency también informan la imagen que
+ *                    set_cursor le dio al puntero, y fallan con un set_cursor sin el 'serial' de
+ *                    la última entrada)
+ *    latency         un ratón de 1000 Hz sobre la ventana, de la entrada a la presentación: de cada
+ *                    evento de movimiento al 'vblank' que muestra la primera confirmación
+ *                    posterior, o a esa confirmación cuando la superficie sugiere presentación
+ *                    asíncrona (una cota inferior, el cliente puede dibujarla antes de leer el
+ *                    evento)
+ *    close           xdg_toplevel.close, hasta que el cliente se desconecta
+ * Los 'pings' salen a --ping-rate durante cada escenario, la latencia del 'pong' es cuánto tarda el
+ * cliente en llegar a sus eventos bajo esa carga.
+ *    --refresh <hz>          'vblanks' por segundo, cada uno muestra la última confirmación (60)
+ *    --resize-rate <hz>      configuraciones por segundo del escenario resize (240)
+ *    --pointer-rate <hz>     eventos de movimiento por segundo del escenario pointer (8000)
+ *    --ping-rate <hz>        'pings' por segundo (20)
+ *    --duration <ms>         duración de cada escenario salvo close (3000)
+ *    --size <an>x<al>        tamaño de la primera configuración, 0x0 deja elegir al cliente (0x0)
+ *    --first-frame-budget <ms>  falla cuando el primer fotograma tarda más desde el lanzamiento
+ *                               (sin límite)
+ * Prueba del tiempo al primer fotograma, con un tamaño que hace que el cliente reasigne sus
+ * 'buffers':
+ *    kanso_compositor --size 800x600 --first-frame-budget 250 close -- bin/linux_main
+ * Latencia con y sin la sugerencia de 'tearing':
+ *    kanso_compositor latency -- bin/linux_main
+ *    kanso_compositor latency -- bin/linux_main --tearing
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define KSO_LOG_IMPLEMENTATION
+
+#include "../log.h"
+#include "../defines.h"
+#include "../types.h"
+#include "../clock.h"
+
+#include "../linux/linux_clock.c"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <wayland-server.h>
+#include "../linux/xdg_shell_server_protocol.h"
+#include "../linux/xdg_shell_protocol.c"
+#include "../linux/tearing_control_server_protocol.h"
+#include "../linux/tearing_control_protocol.c"
+
+#define COMPOSITOR_MAX_SURFACES 32
+#define COMPOSITOR_MAX_CALLBACKS 8 // per surface, more are done at once | más se completan ya
+#define COMPOSITOR_STARTUP_TIMEOUT 5'000'000'000ull // nanoseconds
+#define COMPOSITOR_CLOSE_TIMEOUT 2'000'000'000ull
+#define COMPOSITOR_MAX_POINTER_BURST 4096 // motion events per wake up | por despertar
+#define COMPOSITOR_SEAT_VERSION 7
+#define COMPOSITOR_XDG_WM_BASE_VERSION 5
+#define COMPOSITOR_TEARING_CONTROL_VERSION 1
+#define COMPOSITOR_LATENCY_POINTER_RATE 1000 // hertz, a gaming mouse | un ratón para juegos
+
+typedef enum {
+	COMPOSITOR_FRAMES,
+	COMPOSITOR_RESIZE,
+	COMPOSITOR_POINTER,
+	COMPOSITOR_LATENCY,
+	COMPOSITOR_CLOSE,
+	COMPOSITOR_SCENARIO_COUNT,
+} CompositorScenario;
+
+global_variable const char* compositor_scenario_names[COMPOSITOR_SCENARIO_COUNT] = {
+	"frames", "resize", "pointer", "latency", "close",
+};
+
+typedef struct {
+	uint64 count;
+	uint64 total; // nanoseconds
+	uint64 max;
+} CompositorLatency;
+
+/*
+ * [EN] Motion events sent and not shown yet, times since the spawn.
+ * [ES] Eventos de movimiento enviados y aún no mostrados, tiempos desde el lanzamiento.
+ */
+typedef struct {
+	uint64 count;
+	uint64 total_time; // nanoseconds | nanosegundos
+	uint64 first_time;
+} CompositorInputs;
+
+typedef struct Compositor Compositor;
+
+/*
+ * [EN] Pools are mapped read only, only the first frame is read. They live until the pool and all
+ * of its buffers are destroyed.
+ * [ES] Los 'pools' se mapean sólo para lectura, sólo se lee el primer fotograma. Viven hasta que el
+ * 'pool' y todos sus 'buffers' se destruyen.
+ */
+typedef struct {
+	Compositor* compositor;
+	const uint8* memory; // nullptr when it couldn't be mapped | cuando no se pudo mapear
+	uint64 size;
+	int32 fd;
+	int32 references;
+} CompositorPool;
+
+typedef struct {
+	Compositor* compositor;
+	CompositorPool* pool;
+	int32 offset;
+	int32 width;
+	int32 height;
+	int32 stride;
+} CompositorBuffer;
+
+/*
+ * [EN] A wl_surface and its xdg roles. A commit moves the attached buffer to committed, the next
+ * vblank shows it and releases the one it replaces, a buffer replaced before it was shown is
+ * released at once. Frame callbacks wait for the vblank after their commit, and for the surface to
+ * be mapped (have a buffer shown), like in a real compositor that only answers what it draws.
+ * [ES] Una wl_surface y sus roles xdg. Una confirmación mueve el 'buffer' asignado a committed, el
+ * siguiente 'vblank' lo muestra y libera el que reemplaza, un 'buffer' reemplazado antes de
+ * mostrarse se libera de inmediato. Los 'callbacks' de fotograma esperan al 'vblank' posterior a
+ * su confirmación, y a que la superficie esté mapeada (tenga un 'buffer' mostrado), como en un
+ * compositor real que sólo responde lo que dibuja.
+ */
+typedef struct {
+	Compositor* compositor;
+	struct wl_resource* resource; // nullptr for a free slot | nullptr para una ranura libre
+	struct wl_resource* xdg_surface;
+	struct wl_resource* xdg_toplevel;
+	struct wl_resource* attached;
+	bool8 has_attached; // attach() since the last commit | desde la última confirmación
+	struct wl_resource* committed;
+	bool8 has_committed; // not shown yet | aún no mostrado
+	struct wl_resource* shown;
+	struct wl_resource* pending_callbacks[COMPOSITOR_MAX_CALLBACKS]; // before the commit | antes
+	int32 pending_callback_count;
+	struct wl_resource* callbacks[COMPOSITOR_MAX_CALLBACKS];
+	int32 callback_count;
+	uint64 callbacks_done_time; // nanoseconds, 0 once a frame answered them | 0 ya respondidos
+	bool8 configure_sent;
+	uint32 configure_serial;
+	uint64 configure_time; // nanoseconds
+	int32 configure_width;
+	int32 configure_height;
+	bool8 resize_pending; // no buffer of the configured size yet | aún sin 'buffer' del tamaño
+	struct wl_resource* tearing_control;
+	uint32 presentation_hint; // pending, the commit applies it | pendiente, la confirmación
+	bool8 async; // commits are shown at once | las confirmaciones se muestran de inmediato
+	CompositorInputs committed_inputs; // shown with the committed buffer | con committed
+} CompositorSurface;
+
+struct Compositor {
+	struct wl_display* display;
+	struct wl_client* client; // nullptr once gone | nullptr al irse
+	struct wl_listener client_destroyed;
+	struct wl_resource* pointer; // the last wl_pointer | el último wl_pointer
+	struct wl_resource* xdg_wm_base;
+	CompositorSurface surfaces[COMPOSITOR_MAX_SURFACES];
+	int32 pid;
+	uint32 refresh; // hertz
+	uint32 resize_rate;
+	uint32 pointer_rate;
+	uint32 ping_rate;
+	uint64 duration; // nanoseconds
+	int32 initial_width;
+	int32 initial_height;
+
+	uint64 spawn_time; // nanoseconds, clockNowNanoseconds()
+	uint64 configured_time; // first configure acked, 0 before | 0 antes
+	uint64 first_frame_time; // first commit with a buffer | primera confirmación con 'buffer'
+	uint64 first_frame_budget; // nanoseconds, 0 without | 0 sin límite
+	int32 first_frame_width;
+	int32 first_frame_height;
+	bool8 first_frame_drawn; // some pixel isn't black | algún píxel no es negro
+	uint64 gone_time;
+	CompositorScenario scenario;
+	uint64 scenario_start;
+	uint64 next_vblank;
+	uint64 next_resize;
+	uint64 next_ping;
+	uint32 resize_count;
+	uint32 ping_serial;
+	uint64 ping_time; // 0 without a ping in flight | 0 sin un 'ping' en curso
+	uint64 pointer_sent; // motion events of the scenario | eventos de movimiento del escenario
+	CompositorInputs unseen_inputs; // sent since the last commit | desde la última confirmación
+	uint64 async_frames; // shown at their commit | mostrados al confirmarse
+	struct wl_resource* pointer_surface; // entered, nullptr outside | nullptr fuera
+	uint32 pointer_enter_serial;
+	struct wl_resource* cursor_surface; // of the last set_cursor, nullptr without | nullptr sin
+	int32 cursor_hotspot_x;
+	int32 cursor_hotspot_y;
+	int32 cursor_width; // of its last committed buffer, 0 without | 0 sin 'buffer'
+	int32 cursor_height;
+	uint32 cursor_requests; // set_cursor of the scenario with the enter serial | con el de entrada
+	uint32 stale_cursor_requests; // with any other serial, ignored | con otro, ignorados
+	uint64 frames; // commits with a buffer, toplevels only | confirmaciones con 'buffer'
+	uint64 configures;
+	CompositorLatency frame_latency; // frame callback to the commit of the next frame
+	CompositorLatency configure_latency; // configure to ack_configure
+	CompositorLatency resize_latency; // configure to a buffer of its size | a un 'buffer'
+	CompositorLatency ping_latency;
+	CompositorLatency present_latency; // motion event to the frame that shows it | al fotograma
+};
+
+internal void compositorLatencyAdd(CompositorLatency* latency, uint64 nanoseconds)
+{
+	latency->count++;
+	latency->total += nanoseconds;
+	latency->max = (nanoseconds > latency->max) ? nanoseconds : latency->max;
+}
+
+internal void compositorInputsAdd(CompositorInputs* inputs, uint64 count, uint64 time)
+{
+	if (count == 0) {
+		return;
+	}
+	inputs->first_time = (inputs->count == 0) ? time : inputs->first_time;
+	inputs->count += count;
+	inputs->total_time += count * time;
+}
+
+internal void compositorInputsMerge(CompositorInputs* inputs, CompositorInputs* more)
+{
+	if (more->count == 0) {
+		return;
+	}
+	inputs->first_time = (inputs->count == 0) ? more->first_time : inputs->first_time;
+	inputs->count += more->count;
+	inputs->total_time += more->total_time;
+	*more = (CompositorInputs){ 0 };
+}
+
+/*
+ * [EN] Adds the latency of every input shown at time, the oldest one is the max.
+ * [ES] Suma la latencia de cada entrada mostrada en time, la más vieja es el máximo.
+ */
+internal void compositorInputsShown(CompositorLatency* latency, CompositorInputs* inputs,
+		uint64 time)
+{
+	if (inputs->count == 0) {
+		return;
+	}
+	uint64 oldest = time - inputs->first_time;
+	latency->count += inputs->count;
+	latency->total += (inputs->count * time) - inputs->total_time;
+	latency->max = (oldest > latency->max) ? oldest : latency->max;
+	*inputs = (CompositorInputs){ 0 };
+}
+
+internal void compositorPrintLatency(const char* name, const CompositorLatency* latency)
+{
+	if (latency->count == 0) {
+		printf(", %s none", name);
+		return;
+	}
+	printf(", %s %.3f ms average %.3f max", name,
+			clockNanosecondsToMilliseconds(latency->total / latency->count),
+			clockNanosecondsToMilliseconds(latency->max));
+}
+
+internal uint32 compositorMilliseconds(uint64 nanoseconds)
+{
+	return (uint32)(nanoseconds / NANOSECONDS_PER_MILLISECOND);
+}
+
+internal void compositorDestroyResource(struct wl_client* client, struct wl_resource* resource)
+{
+	wl_resource_destroy(resource);
+}
+
+/* wl_shm, wl_shm_pool and wl_buffer | wl_shm, wl_shm_pool y wl_buffer */
+
+internal void compositorPoolRelease(CompositorPool* pool)
+{
+	if (--pool->references > 0) {
+		return;
+	}
+	if (pool->memory) {
+		munmap((void*)pool->memory, pool->size);
+	}
+	close(pool->fd);
+	free(pool);
+}
+
+internal void compositorPoolMap(CompositorPool* pool, uint64 size)
+{
+	if (pool->memory) {
+		munmap((void*)pool->memory, pool->size);
+	}
+	void* memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, pool->fd, 0);
+	pool->memory = (memory == MAP_FAILED) ? nullptr : memory;
+	pool->size = size;
+}
+
+/*
+ * [EN] Whether any pixel of buffer has color, alpha or padding aside.
+ * [ES] Si algún píxel de buffer tiene color, sin contar alfa o relleno.
+ */
+internal bool8 compositorBufferDrawn(const CompositorBuffer* buffer)
+{
+	const CompositorPool* pool = buffer->pool;
+	uint64 end = (uint64)buffer->offset + ((uint64)buffer->stride * (uint64)buffer->height);
+	if (!pool->memory || buffer->offset < 0 || buffer->width <= 0 || end > pool->size) {
+		return false;
+	}
+	for (int32 row = 0; row < buffer->height; ++row) {
+		const uint32* pixels = (const uint32*)(pool->memory + buffer->offset
+				+ ((uint64)row * (uint64)buffer->stride));
+		for (int32 column = 0; column < buffer->width; ++column) {
+			if (pixels[column] & 0x00FF'FFFFu) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+internal void compositorBufferDestroyed(struct wl_resource* resource)
+{
+	CompositorBuffer* buffer = wl_resource_get_user_data(resource);
+	for (int32 i = 0; i < COMPOSITOR_MAX_SURFACES; ++i) {
+		CompositorSurface* surface = &buffer->compositor->surfaces[i];
+		surface->attached = (surface->attached == resource) ? nullptr : surface->attached;
+		surface->committed = (surface->committed == resource) ? nullptr : surface->committed;
+		surface->shown = (surface->shown == resource) ? nullptr : surface->shown;
+	}
+	compositorPoolRelease(buffer->pool);
+	free(buffer);
+}
+
+global_variable const struct wl_buffer_interface compositor_buffer_implementation = {
+	.destroy = compositorDestroyResource,
+};
+
+internal void compositorPoolCreateBuffer(struct wl_client* client, struct wl_resource* resource,
+		uint32 id, int32 offset, int32 width, int32 height, int32 stride, uint32 format)
+{
+	CompositorBuffer* buffer = malloc(sizeof(CompositorBuffer));
+	struct wl_resource* buffer_resource = wl_resource_create(client, &wl_buffer_interface, 1, id);
+	if (!buffer || !buffer_resource) {
+		free(buffer);
+		wl_client_post_no_memory(client);
+		return;
+	}
+	CompositorPool* pool = wl_resource_get_user_data(resource);
+	pool->references++;
+	*buffer = (CompositorBuffer){ .compositor = pool->compositor, .pool = pool,
+		.offset = offset, .width = width, .height = height, .stride = stride };
+	wl_resource_set_implementation(buffer_resource, &compositor_buffer_implementation, buffer,
+			compositorBufferDestroyed);
+}
+
+internal void compositorPoolResize(struct wl_client* client, struct wl_resource* resource,
+		int32 size)
+{
+	compositorPoolMap(wl_resource_get_user_data(resource), (uint64)size);
+}
+
+internal void compositorPoolDestroyed(struct wl_resource* resource)
+{
+	compositorPoolRelease(wl_resource_get_user_data(resource));
+}
+
+global_variable const struct wl_shm_pool_interface compositor_pool_implementation = {
+	.create_buffer = compositorPoolCreateBuffer,
+	.destroy = compositorDestroyResource,
+	.resize = compositorPoolResize,
+};
+
+internal void compositorShmCreatePool(struct wl_client* client, struct wl_resource* resource,
+		uint32 id, int32 fd, int32 size)
+{
+	CompositorPool* pool = malloc(sizeof(CompositorPool));
+	struct wl_resource* pool_resource = wl_resource_create(client, &wl_shm_pool_interface,
+			wl_resource_get_version(resource), id);
+	if (!pool || !pool_resource) {
+		free(pool);
+		close(fd);
+		wl_client_post_no_memory(client);
+		return;
+	}
+	*pool = (CompositorPool){ .compositor = wl_resource_get_user_data(resource), .fd = fd,
+		.references = 1 };
+	compositorPoolMap(pool, (uint64)size);
+	if (!pool->memory) {
+		wl_resource_post_error(resource, WL_SHM_ERROR_INVALID_FD, "can't map the pool");
+	}
+	wl_resource_set_implementation(pool_resource, &compositor_pool_implementation, pool,
+			compositorPoolDestroyed);
+}
+
+global_variable const struct wl_shm_interface compositor_shm_implementation = {
+	.create_pool = compositorShmCreatePool,
+	.release = compositorDestroyResource,
+};
+
+internal void compositorBindShm(struct wl_client* client, void* data, uint32 version, uint32 id)
+{
+	struct wl_resource* resource = wl_resource_create(client, &wl_shm_interface, (int32)version,
+			id);
+	if (!resource) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	wl_resource_set_implementation(resource, &compositor_shm_implementation, data, nullptr);
+	wl_shm_send_format(resource, WL_SHM_FORMAT_ARGB8888);
+	wl_shm_send_format(resource, WL_SHM_FORMAT_XRGB8888);
+}
+
+/* wl_compositor, wl_surface and wl_region */
+
+internal void compositorCallbackDestroyed(struct wl_resource* resource)
+{
+	CompositorSurface* surface = wl_resource_get_user_data(resource);
+	for (int32 i = 0; i < surface->pending_callback_count; ++i) {
+		if (surface->pending_callbacks[i] == resource) {
+			surface->pending_callbacks[i] =
+				surface->pending_callbacks[--surface->pending_callback_count];
+			return;
+		}
+	}
+	for (int32 i = 0; i < surface->callback_count; ++i) {
+		if (surface->callbacks[i] == resource) {
+			surface->callbacks[i] = surface->callbacks[--surface->callback_count];
+			return;
+		}
+	}
+}
+
+internal void compositorCallbackDone(struct wl_resource* callback, uint64 now)
+{
+	wl_callback_send_done(callback, compositorMilliseconds(now));
+	wl_resource_destroy(callback); // removes it from its list | lo quita de su lista
+}
+
+internal void compositorSurfaceAttach(struct wl_client* client, struct wl_resource* resource,
+		struct wl_resource* buffer, int32 x, int32 y)
+{
+	CompositorSurface* surface = wl_resource_get_user_data(resource);
+	surface->attached = buffer;
+	surface->has_attached = true;
+}
+
+internal void compositorSurfaceDamage(struct wl_client* client, struct wl_resource* resource,
+		int32 x, int32 y, int32 width, int32 height)
+{
+}
+
+internal void compositorSurfaceFrame(struct wl_client* client, struct wl_resource* resource,
+		uint32 callback_id)
+{
+	CompositorSurface* surface = wl_resource_get_user_data(resource);
+	struct wl_resource* callback = wl_resource_create(client, &wl_callback_interface, 1,
+			callback_id);
+	if (!callback) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	wl_resource_set_implementation(callback, nullptr, surface, compositorCallbackDestroyed);
+	if (surface->pending_callback_count == COMPOSITOR_MAX_CALLBACKS) {
+		compositorCallbackDone(surface->pending_callbacks[0], clockNowNanoseconds());
+	}
+	surface->pending_callbacks[surface->pending_callback_count++] = callback;
+}
+
+internal void compositorSurfaceSetRegion(struct wl_client* client, struct wl_resource* resource,
+		struct wl_resource* region)
+{
+}
+
+/*
+ * [EN] The first commit of a toplevel asks for its initial configure. Later commits count as
+ * frames when they bring a buffer, which answers the frame callbacks of the last vblank and, once
+ * it has the size of the last configure, the resize.
+ * [ES] La primera confirmación de una superficie de nivel superior pide su configuración inicial.
+ * Las siguientes cuentan como fotogramas cuando traen un 'buffer', que responde a los 'callbacks'
+ * de fotograma del último 'vblank' y, una vez que tiene el tamaño de la última configuración, al
+ * cambio de tamaño.
+ */
+internal void compositorSendConfigure(CompositorSurface* surface, int32 width, int32 height,
+		uint64 now);
+
+/*
+ * [EN] Shows the committed buffer, releasing the one it replaces.
+ * [ES] Muestra el 'buffer' confirmado, liberando el que reemplaza.
+ */
+internal void compositorSurfaceShow(CompositorSurface* surface, uint64 now)
+{
+	Compositor* compositor = surface->compositor;
+	if (surface->shown && surface->shown != surface->committed) {
+		wl_buffer_send_release(surface->shown);
+	}
+	surface->shown = surface->committed;
+	surface->has_committed = false;
+	compositorInputsShown(&compositor->present_latency, &surface->committed_inputs,
+			now - compositor->spawn_time);
+}
+
+internal void compositorSurfaceCommit(struct wl_client* client, struct wl_resource* resource)
+{
+	CompositorSurface* surface = wl_resource_get_user_data(resource);
+	Compositor* compositor = surface->compositor;
+	uint64 now = clockNowNanoseconds();
+	surface->async = surface->presentation_hint == WP_TEARING_CONTROL_V1_PRESENTATION_HINT_ASYNC;
+	if (surface->xdg_toplevel && !surface->configure_sent) {
+		compositorSendConfigure(surface, compositor->initial_width, compositor->initial_height,
+				now);
+	}
+	if (surface->has_attached) {
+		if (surface->has_committed && surface->committed
+				&& surface->committed != surface->attached) {
+			wl_buffer_send_release(surface->committed); // never shown | nunca mostrado
+		}
+		surface->committed = surface->attached;
+		surface->has_committed = true;
+		surface->has_attached = false;
+		if (surface->committed && surface->xdg_toplevel) {
+			const CompositorBuffer* buffer = wl_resource_get_user_data(surface->committed);
+			compositor->frames++;
+			if (compositor->first_frame_time == 0) {
+				compositor->first_frame_time = now;
+				compositor->first_frame_width = buffer->width;
+				compositor->first_frame_height = buffer->height;
+				compositor->first_frame_drawn = compositorBufferDrawn(buffer);
+			}
+			if (surface->callbacks_done_time != 0) {
+				compositorLatencyAdd(&compositor->frame_latency,
+						now - surface->callbacks_done_time);
+				surface->callbacks_done_time = 0;
+			}
+			if (surface->resize_pending && buffer->width == surface->configure_width
+					&& buffer->height == surface->configure_height) {
+				compositorLatencyAdd(&compositor->resize_latency, now - surface->configure_time);
+				surface->resize_pending = false;
+			}
+		}
+		if (surface->resource == compositor->cursor_surface) {
+			const CompositorBuffer* buffer = surface->committed
+				? wl_resource_get_user_data(surface->committed) : nullptr;
+			compositor->cursor_width = buffer ? buffer->width : 0;
+			compositor->cursor_height = buffer ? buffer->height : 0;
+		}
+		if (surface->committed && surface->resource == compositor->pointer_surface) {
+			compositorInputsMerge(&surface->committed_inputs, &compositor->unseen_inputs);
+		}
+		if (surface->async) {
+			compositorSurfaceShow(surface, now);
+			compositor->async_frames++;
+		}
+	}
+	for (int32 i = 0; i < surface->pending_callback_count; ++i) {
+		if (surface->callback_count == COMPOSITOR_MAX_CALLBACKS) {
+			compositorCallbackDone(surface->callbacks[0], now);
+		}
+		surface->callbacks[surface->callback_count++] = surface->pending_callbacks[i];
+	}
+	surface->pending_callback_count = 0;
+}
+
+internal void compositorSurfaceSetInt32(struct wl_client* client, struct wl_resource* resource,
+		int32 value)
+{
+}
+
+internal void compositorSurfaceOffset(struct wl_client* client, struct wl_resource* resource,
+		int32 x, int32 y)
+{
+}
+
+internal void compositorSurfaceDestroyed(struct wl_resource* resource)
+{
+	CompositorSurface* surface = wl_resource_get_user_data(resource);
+	while (surface->pending_callback_count > 0) {
+		wl_resource_destroy(surface->pending_callbacks[surface->pending_callback_count - 1]);
+	}
+	while (surface->callback_count > 0) {
+		wl_resource_destroy(surface->callbacks[surface->callback_count - 1]);
+	}
+	if (surface->tearing_control) {
+		wl_resource_set_user_data(surface->tearing_control, nullptr); // inert | inerte
+	}
+	if (surface->compositor->cursor_surface == resource) {
+		surface->compositor->cursor_surface = nullptr;
+	}
+	*surface = (CompositorSurface){ .compositor = surface->compositor };
+}
+
+global_variable const struct wl_surface_interface compositor_surface_implementation = {
+	.destroy = compositorDestroyResource,
+	.attach = compositorSurfaceAttach,
+	.damage = compositorSurfaceDamage,
+	.frame = compositorSurfaceFrame,
+	.set_opaque_region = compositorSurfaceSetRegion,
+	.set_input_region = compositorSurfaceSetRegion,
+	.commit = compositorSurfaceCommit,
+	.set_buffer_transform = compositorSurfaceSetInt32,
+	.set_buffer_scale = compositorSurfaceSetInt32,
+	.damage_buffer = compositorSurfaceDamage,
+	.offset = compositorSurfaceOffset,
+};
+
+internal void compositorRegionChange(struct wl_client* client, struct wl_resource* resource,
+		int32 x, int32 y, int32 width, int32 height)
+{
+}
+
+global_variable const struct wl_region_interface compositor_region_implementation = {
+	.destroy = compositorDestroyResource,
+	.add = compositorRegionChange,
+	.subtract = compositorRegionChange,
+};
+
+internal void compositorCreateSurface(struct wl_client* client, struct wl_resource* resource,
+		uint32 id)
+{
+	Compositor* compositor = wl_resource_get_user_data(resource);
+	CompositorSurface* surface = nullptr;
+	for (int32 i = 0; i < COMPOSITOR_MAX_SURFACES && !surface; ++i) {
+		surface = compositor->surfaces[i].resource ? nullptr : &compositor->surfaces[i];
+	}
+	struct wl_resource* surface_resource = surface ? wl_resource_create(client,
+			&wl_surface_interface, wl_resource_get_version(resource), id) : nullptr;
+	if (!surface_resource) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	*surface = (CompositorSurface){ .compositor = compositor, .resource = surface_resource };
+	wl_resource_set_implementation(surface_resource, &compositor_surface_implementation, surface,
+			compositorSurfaceDestroyed);
+}
+
+internal void compositorCreateRegion(struct wl_client* client, struct wl_resource* resource,
+		uint32 id)
+{
+	struct wl_resource* region = wl_resource_create(client, &wl_region_interface, 1, id);
+	if (!region) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	wl_resource_set_implementation(region, &compositor_region_implementation, nullptr, nullptr);
+}
+
+global_variable const struct wl_compositor_interface compositor_implementation = {
+	.create_surface = compositorCreateSurface,
+	.create_region = compositorCreateRegion,
+};
+
+internal void compositorBindCompositor(struct wl_client* client, void* data, uint32 version,
+		uint32 id)
+{
+	struct wl_resource* resource = wl_resource_create(client, &wl_compositor_interface,
+			(int32)version, id);
+	if (!resource) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	wl_resource_set_implementation(resource, &compositor_implementation, data, nullptr);
+}
+
+/* wl_seat, wl_pointer and wl_keyboard */
+
+/*
+ * [EN] Like a real compositor, only a request with the serial of the last enter, while the pointer
+ * is still over the window, sets the pointer image; the size is the one of the buffer the cursor
+ * surface commits afterwards.
+ * [ES] Como en un compositor real, sólo una petición con el 'serial' de la última entrada, mientras
+ * el puntero sigue sobre la ventana, asigna la imagen del puntero; el tamaño es el del 'buffer' que
+ * la superficie del cursor confirma después.
+ */
+internal void compositorPointerSetCursor(struct wl_client* client, struct wl_resource* resource,
+		uint32 serial, struct wl_resource* surface, int32 hotspot_x, int32 hotspot_y)
+{
+	Compositor* compositor = wl_resource_get_user_data(resource);
+	if (!compositor->pointer_surface || serial != compositor->pointer_enter_serial) {
+		compositor->stale_cursor_requests++;
+		return;
+	}
+	compositor->cursor_requests++;
+	if (surface != compositor->cursor_surface) {
+		compositor->cursor_width = 0;
+		compositor->cursor_height = 0;
+	}
+	compositor->cursor_surface = surface;
+	compositor->cursor_hotspot_x = hotspot_x;
+	compositor->cursor_hotspot_y = hotspot_y;
+}
+
+global_variable const struct wl_pointer_interface compositor_pointer_implementation = {
+	.set_cursor = compositorPointerSetCursor,
+	.release = compositorDestroyResource,
+};
+
+global_variable const struct wl_keyboard_interface compositor_keyboard_implementation = {
+	.release = compositorDestroyResource,
+};
+
+global_variable const struct wl_touch_interface compositor_touch_implementation = {
+	.release = compositorDestroyResource,
+};
+
+internal void compositorPointerDestroyed(struct wl_resource* resource)
+{
+	Compositor* compositor = wl_resource_get_user_data(resource);
+	compositor->pointer = (compositor->pointer == resource) ? nullptr : compositor->pointer;
+}
+
+internal void compositorSeatGetPointer(struct wl_client* client, struct wl_resource* resource,
+		uint32 id)
+{
+	Compositor* compositor = wl_resource_get_user_data(resource);
+	struct wl_resource* pointer = wl_resource_create(client, &wl_pointer_interface,
+			wl_resource_get_version(resource), id);
+	if (!pointer) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	wl_resource_set_implementation(pointer, &compositor_pointer_implementation, compositor,
+			compositorPointerDestroyed);
+	compositor->pointer = pointer;
+}
+
+internal void compositorSeatGetKeyboard(struct wl_client* client, struct wl_resource* resource,
+		uint32 id)
+{
+	struct wl_resource* keyboard = wl_resource_create(client, &wl_keyboard_interface,
+			wl_resource_get_version(resource), id);
+	int32 fd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+	if (!keyboard || fd < 0) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	wl_resource_set_implementation(keyboard, &compositor_keyboard_implementation, nullptr,
+			nullptr);
+	wl_keyboard_send_keymap(keyboard, WL_KEYBOARD_KEYMAP_FORMAT_NO_KEYMAP, fd, 0); // dup'ed
+	close(fd);
+}
+
+internal void compositorSeatGetTouch(struct wl_client* client, struct wl_resource* resource,
+		uint32 id)
+{
+	struct wl_resource* touch = wl_resource_create(client, &wl_touch_interface,
+			wl_resource_get_version(resource), id);
+	if (!touch) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	wl_resource_set_implementation(touch, &compositor_touch_implementation, nullptr, nullptr);
+}
+
+global_variable const struct wl_seat_interface compositor_seat_implementation = {
+	.get_pointer = compositorSeatGetPointer,
+	.get_keyboard = compositorSeatGetKeyboard,
+	.get_touch = compositorSeatGetTouch,
+	.release = compositorDestroyResource,
+};
+
+internal void compositorBindSeat(struct wl_client* client, void* data, uint32 version, uint32 id)
+{
+	struct wl_resource* resource = wl_resource_create(client, &wl_seat_interface, (int32)version,
+			id);
+	if (!resource) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	wl_resource_set_implementation(resource, &compositor_seat_implementation, data, nullptr);
+	wl_seat_send_capabilities(resource, WL_SEAT_CAPABILITY_POINTER | WL_SEAT_CAPABILITY_KEYBOARD);
+	wl_seat_send_name(resource, "kanso_compositor");
+}
+
+/* xdg_wm_base, xdg_surface and xdg_toplevel */
+
+internal void compositorSendConfigure(CompositorSurface* surface, int32 width, int32 height,
+		uint64 now)
+{
+	Compositor* compositor = surface->compositor;
+	struct wl_array states;
+	wl_array_init(&states);
+	uint32* activated = wl_array_add(&states, sizeof(uint32));
+	if (activated) {
+		*activated = XDG_TOPLEVEL_STATE_ACTIVATED;
+	}
+	xdg_toplevel_send_configure(surface->xdg_toplevel, width, height, &states);
+	wl_array_release(&states);
+	surface->configure_serial = wl_display_next_serial(compositor->display);
+	surface->configure_time = now;
+	surface->configure_width = width;
+	surface->configure_height = height;
+	surface->resize_pending = width != 0 && height != 0;
+	surface->configure_sent = true;
+	xdg_surface_send_configure(surface->xdg_surface, surface->configure_serial);
+	compositor->configures++;
+}
+
+internal void compositorToplevelDestroyed(struct wl_resource* resource)
+{
+	CompositorSurface* surface = wl_resource_get_user_data(resource);
+	surface->xdg_toplevel = (surface->xdg_toplevel == resource) ? nullptr : surface->xdg_toplevel;
+}
+
+internal void compositorToplevelSetResource(struct wl_client* client,
+		struct wl_resource* resource, struct wl_resource* other)
+{
+}
+
+internal void compositorToplevelSetString(struct wl_client* client, struct wl_resource* resource,
+		const char* text)
+{
+}
+
+internal void compositorToplevelShowWindowMenu(struct wl_client* client,
+		struct wl_resource* resource, struct wl_resource* seat, uint32 serial, int32 x, int32 y)
+{
+}
+
+internal void compositorToplevelMove(struct wl_client* client, struct wl_resource* resource,
+		struct wl_resource* seat, uint32 serial)
+{
+}
+
+internal void compositorToplevelResize(struct wl_client* client, struct wl_resource* resource,
+		struct wl_resource* seat, uint32 serial, uint32 edges)
+{
+}
+
+internal void compositorToplevelSetSize(struct wl_client* client, struct wl_resource* resource,
+		int32 width, int32 height)
+{
+}
+
+internal void compositorToplevelSetState(struct wl_client* client, struct wl_resource* resource)
+{
+}
+
+global_variable const struct xdg_toplevel_interface compositor_toplevel_implementation = {
+	.destroy = compositorDestroyResource,
+	.set_parent = compositorToplevelSetResource,
+	.set_title = compositorToplevelSetString,
+	.set_app_id = compositorToplevelSetString,
+	.show_window_menu = compositorToplevelShowWindowMenu,
+	.move = compositorToplevelMove,
+	.resize = compositorToplevelResize,
+	.set_max_size = compositorToplevelSetSize,
+	.set_min_size = compositorToplevelSetSize,
+	.set_maximized = compositorToplevelSetState,
+	.unset_maximized = compositorToplevelSetState,
+	.set_fullscreen = compositorToplevelSetResource,
+	.unset_fullscreen = compositorToplevelSetState,
+	.set_minimized = compositorToplevelSetState,
+};
+
+internal void compositorXdgSurfaceGetToplevel(struct wl_client* client,
+		struct wl_resource* resource, uint32 id)
+{
+	CompositorSurface* surface = wl_resource_get_user_data(resource);
+	struct wl_resource* toplevel = wl_resource_create(client, &xdg_toplevel_interface,
+			wl_resource_get_version(resource), id);
+	if (!toplevel) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	wl_resource_set_implementation(toplevel, &compositor_toplevel_implementation, surface,
+			compositorToplevelDestroyed);
+	surface->xdg_toplevel = toplevel;
+}
+
+internal void compositorXdgSurfaceGetPopup(struct wl_client* client, struct wl_resource* resource,
+		uint32 id, struct wl_resource* parent, struct wl_resource* positioner)
+{
+	wl_client_post_implementation_error(client, "popups are not supported");
+}
+
+internal void compositorXdgSurfaceSetWindowGeometry(struct wl_client* client,
+		struct wl_resource* resource, int32 x, int32 y, int32 width, int32 height)
+{
+}
+
+internal void compositorXdgSurfaceAckConfigure(struct wl_client* client,
+		struct wl_resource* resource, uint32 serial)
+{
+	CompositorSurface* surface = wl_resource_get_user_data(resource);
+	Compositor* compositor = surface->compositor;
+	if (serial != surface->configure_serial) {
+		return; // an older one, superseded | una anterior, reemplazada
+	}
+	uint64 now = clockNowNanoseconds();
+	compositorLatencyAdd(&compositor->configure_latency, now - surface->configure_time);
+	if (compositor->configured_time == 0) {
+		compositor->configured_time = now;
+	}
+}
+
+internal void compositorXdgSurfaceDestroyed(struct wl_resource* resource)
+{
+	CompositorSurface* surface = wl_resource_get_user_data(resource);
+	surface->xdg_surface = (surface->xdg_surface == resource) ? nullptr : surface->xdg_surface;
+}
+
+global_variable const struct xdg_surface_interface compositor_xdg_surface_implementation = {
+	.destroy = compositorDestroyResource,
+	.get_toplevel = compositorXdgSurfaceGetToplevel,
+	.get_popup = compositorXdgSurfaceGetPopup,
+	.set_window_geometry = compositorXdgSurfaceSetWindowGeometry,
+	.ack_configure = compositorXdgSurfaceAckConfigure,
+};
+
+internal void compositorWmBaseCreatePositioner(struct wl_client* client,
+		struct wl_resource* resource, uint32 id)
+{
+	wl_client_post_implementation_error(client, "positioners are not supported");
+}
+
+internal void compositorWmBaseGetXdgSurface(struct wl_client* client,
+		struct wl_resource* resource, uint32 id, struct wl_resource* surface_resource)
+{
+	CompositorSurface* surface = wl_resource_get_user_data(surface_resource);
+	struct wl_resource* xdg_surface = wl_resource_create(client, &xdg_surface_interface,
+			wl_resource_get_version(resource), id);
+	if (!xdg_surface) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	wl_resource_set_implementation(xdg_surface, &compositor_xdg_surface_implementation, surface,
+			compositorXdgSurfaceDestroyed);
+	surface->xdg_surface = xdg_surface;
+}
+
+internal void compositorWmBasePong(struct wl_client* client, struct wl_resource* resource,
+		uint32 serial)
+{
+	Compositor* compositor = wl_resource_get_user_data(resource);
+	if (compositor->ping_time != 0 && serial == compositor->ping_serial) {
+		compositorLatencyAdd(&compositor->ping_latency,
+				clockNowNanoseconds() - compositor->ping_time);
+		compositor->ping_time = 0;
+	}
+}
+
+internal void compositorWmBaseDestroyed(struct wl_resource* resource)
+{
+	Compositor* compositor = wl_resource_get_user_data(resource);
+	compositor->xdg_wm_base = (compositor->xdg_wm_base == resource)
+		? nullptr : compositor->xdg_wm_base;
+}
+
+global_variable const struct xdg_wm_base_interface compositor_wm_base_implementation = {
+	.destroy = compositorDestroyResource,
+	.create_positioner = compositorWmBaseCreatePositioner,
+	.get_xdg_surface = compositorWmBaseGetXdgSurface,
+	.pong = compositorWmBasePong,
+};
+
+internal void compositorBindWmBase(struct wl_client* client, void* data, uint32 version,
+		uint32 id)
+{
+	Compositor* compositor = data;
+	struct wl_resource* resource = wl_resource_create(client, &xdg_wm_base_interface,
+			(int32)version, id);
+	if (!resource) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	wl_resource_set_implementation(resource, &compositor_wm_base_implementation, compositor,
+			compositorWmBaseDestroyed);
+	compositor->xdg_wm_base = resource;
+}
+
+/*
+ * [EN] wp_tearing_control_v1: the hint applies on the next commit, the object goes inert with its
+ * surface and destroying it goes back to vsync.
+ * [ES] wp_tearing_control_v1: la sugerencia se aplica en la siguiente confirmación, el objeto queda
+ * inerte con su superficie y destruirlo regresa a vsync.
+ */
+internal void compositorTearingControlSetHint(struct wl_client* client,
+		struct wl_resource* resource, uint32 hint)
+{
+	CompositorSurface* surface = wl_resource_get_user_data(resource);
+	if (surface) {
+		surface->presentation_hint = hint;
+	}
+}
+
+internal void compositorTearingControlDestroyed(struct wl_resource* resource)
+{
+	CompositorSurface* surface = wl_resource_get_user_data(resource);
+	if (surface) {
+		surface->tearing_control = nullptr;
+		surface->presentation_hint = WP_TEARING_CONTROL_V1_PRESENTATION_HINT_VSYNC;
+	}
+}
+
+global_variable const struct wp_tearing_control_v1_interface
+		compositor_tearing_control_implementation = {
+	.set_presentation_hint = compositorTearingControlSetHint,
+	.destroy = compositorDestroyResource,
+};
+
+internal void compositorTearingManagerGetControl(struct wl_client* client,
+		struct wl_resource* resource, uint32 id, struct wl_resource* surface_resource)
+{
+	CompositorSurface* surface = wl_resource_get_user_data(surface_resource);
+	if (surface->tearing_control) {
+		wl_resource_post_error(resource,
+				WP_TEARING_CONTROL_MANAGER_V1_ERROR_TEARING_CONTROL_EXISTS,
+				"the surface already has a tearing control");
+		return;
+	}
+	struct wl_resource* tearing_control = wl_resource_create(client,
+			&wp_tearing_control_v1_interface, wl_resource_get_version(resource), id);
+	if (!tearing_control) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	wl_resource_set_implementation(tearing_control, &compositor_tearing_control_implementation,
+			surface, compositorTearingControlDestroyed);
+	surface->tearing_control = tearing_control;
+}
+
+global_variable const struct wp_tearing_control_manager_v1_interface
+		compositor_tearing_manager_implementation = {
+	.destroy = compositorDestroyResource,
+	.get_tearing_control = compositorTearingManagerGetControl,
+};
+
+internal void compositorBindTearingManager(struct wl_client* client, void* data, uint32 version,
+		uint32 id)
+{
+	struct wl_resource* resource = wl_resource_create(client,
+			&wp_tearing_control_manager_v1_interface, (int32)version, id);
+	if (!resource) {
+		wl_client_post_no_memory(client);
+		return;
+	}
+	wl_resource_set_implementation(resource, &compositor_tearing_manager_implementation, data,
+			nullptr);
+}
+
+/* scenarios | escenarios */
+
+internal void compositorClientDestroyed(struct wl_listener* listener, void* data)
+{
+	Compositor* compositor = wl_container_of(listener, compositor, client_destroyed);
+	compositor->client = nullptr;
+	compositor->pointer = nullptr;
+	compositor->xdg_wm_base = nullptr;
+	compositor->gone_time = clockNowNanoseconds();
+}
+
+/*
+ * [EN] Shows the last commit of every surface, releasing the buffer it replaces, and answers the
+ * frame callbacks committed before it on the surfaces that are mapped. Async surfaces showed their
+ * commits already, they only get their callbacks.
+ * [ES] Muestra la última confirmación de cada superficie, liberando el 'buffer' que reemplaza, y
+ * responde a los 'callbacks' de fotograma confirmados antes en las superficies mapeadas. Las
+ * superficies asíncronas ya mostraron sus confirmaciones, sólo reciben sus 'callbacks'.
+ */
+internal void compositorVblank(Compositor* compositor, uint64 now)
+{
+	for (int32 i = 0; i < COMPOSITOR_MAX_SURFACES; ++i) {
+		CompositorSurface* surface = &compositor->surfaces[i];
+		if (!surface->resource) {
+			continue;
+		}
+		if (surface->has_committed) {
+			compositorSurfaceShow(surface, now);
+		}
+		if (!surface->shown) {
+			continue; // unmapped | sin mapear
+		}
+		if (surface->callback_count > 0 && surface->xdg_toplevel) {
+			surface->callbacks_done_time = now;
+		}
+		while (surface->callback_count > 0) {
+			compositorCallbackDone(surface->callbacks[surface->callback_count - 1], now);
+		}
+	}
+}
+
+internal void compositorPointerFlood(Compositor* compositor, uint64 now, uint32 rate)
+{
+	CompositorSurface* target = nullptr;
+	for (int32 i = 0; i < COMPOSITOR_MAX_SURFACES && !target; ++i) {
+		target = compositor->surfaces[i].xdg_toplevel ? &compositor->surfaces[i] : nullptr;
+	}
+	if (!compositor->pointer || !target) {
+		return;
+	}
+	struct wl_resource* pointer = compositor->pointer;
+	bool8 frames = wl_resource_get_version(pointer) >= WL_POINTER_FRAME_SINCE_VERSION;
+	if (!compositor->pointer_surface) {
+		compositor->pointer_surface = target->resource;
+		compositor->pointer_enter_serial = wl_display_next_serial(compositor->display);
+		wl_pointer_send_enter(pointer, compositor->pointer_enter_serial, target->resource,
+				wl_fixed_from_int(100), wl_fixed_from_int(100));
+		if (frames) {
+			wl_pointer_send_frame(pointer);
+		}
+	}
+	uint64 due = (now - compositor->scenario_start) * rate / NANOSECONDS_PER_SECOND;
+	uint64 sent = compositor->pointer_sent;
+	for (int32 burst = 0; compositor->pointer_sent < due && burst < COMPOSITOR_MAX_POINTER_BURST;
+			++burst) {
+		uint64 i = compositor->pointer_sent++;
+		wl_pointer_send_motion(pointer, compositorMilliseconds(now),
+				wl_fixed_from_int(100 + (int32)(i % 200)),
+				wl_fixed_from_int(100 + (int32)((i / 200) % 200)));
+		if (frames) {
+			wl_pointer_send_frame(pointer);
+		}
+	}
+	compositorInputsAdd(&compositor->unseen_inputs, compositor->pointer_sent - sent,
+			now - compositor->spawn_time);
+}
+
+/*
+ * [EN] Sends whatever is due at now and returns when the next thing is due.
+ * [ES] Envía lo que toque en now y regresa cuándo toca lo siguiente.
+ */
+internal uint64 compositorUpdate(Compositor* compositor, uint64 now)
+{
+	if (now >= compositor->next_vblank) {
+		compositorVblank(compositor, now);
+		uint64 interval = NANOSECONDS_PER_SECOND / compositor->refresh;
+		while (compositor->next_vblank <= now) { // a late wake up skips vblanks | se saltan
+			compositor->next_vblank += interval;
+		}
+	}
+	uint64 next = compositor->next_vblank;
+	if (compositor->xdg_wm_base && now >= compositor->next_ping) {
+		if (compositor->ping_time == 0) {
+			compositor->ping_serial = wl_display_next_serial(compositor->display);
+			compositor->ping_time = now;
+			xdg_wm_base_send_ping(compositor->xdg_wm_base, compositor->ping_serial);
+		}
+		compositor->next_ping = now + (NANOSECONDS_PER_SECOND / compositor->ping_rate);
+	}
+	next = (compositor->next_ping < next) ? compositor->next_ping : next;
+	if (compositor->scenario == COMPOSITOR_RESIZE && now >= compositor->next_resize) {
+		int32 index = (int32)compositor->resize_count++;
+		for (int32 i = 0; i < COMPOSITOR_MAX_SURFACES; ++i) {
+			CompositorSurface* surface = &compositor->surfaces[i];
+			if (surface->xdg_toplevel && surface->xdg_surface) {
+				compositorSendConfigure(surface, 320 + ((index * 97) % 1280),
+						240 + ((index * 61) % 720), now);
+			}
+		}
+		compositor->next_resize = now + (NANOSECONDS_PER_SECOND / compositor->resize_rate);
+	}
+	if (compositor->scenario == COMPOSITOR_RESIZE) {
+		next = (compositor->next_resize < next) ? compositor->next_resize : next;
+	}
+	if (compositor->scenario == COMPOSITOR_POINTER || compositor->scenario == COMPOSITOR_LATENCY) {
+		compositorPointerFlood(compositor, now, (compositor->scenario == COMPOSITOR_POINTER)
+				? compositor->pointer_rate : COMPOSITOR_LATENCY_POINTER_RATE);
+		next = now + NANOSECONDS_PER_MILLISECOND;
+	}
+	return next;
+}
+
+/*
+ * [EN] Serves the client until end, the client leaves or done says so.
+ * [ES] Atiende al cliente hasta end, hasta que el cliente se va o done lo diga.
+ */
+internal void compositorRun(Compositor* compositor, uint64 end,
+		bool8 (*done)(const Compositor* compositor))
+{
+	struct wl_event_loop* loop = wl_display_get_event_loop(compositor->display);
+	for (;;) {
+		uint64 now = clockNowNanoseconds();
+		if (now >= end || !compositor->client || (done && done(compositor))) {
+			return;
+		}
+		uint64 next = compositorUpdate(compositor, now);
+		next = (end < next) ? end : next;
+		wl_display_flush_clients(compositor->display);
+		int32 timeout = (next > now) ? (int32)((next - now + NANOSECONDS_PER_MILLISECOND - 1)
+				/ NANOSECONDS_PER_MILLISECOND) : 0;
+		wl_event_loop_dispatch(loop, timeout);
+	}
+}
+
+internal bool8 compositorShownFirstFrame(const Compositor* compositor)
+{
+	return compositor->first_frame_time != 0;
+}
+
+internal void compositorResetStats(Compositor* compositor, CompositorScenario scenario)
+{
+	compositor->scenario = scenario;
+	compositor->scenario_start = clockNowNanoseconds();
+	compositor->next_resize = compositor->scenario_start;
+	compositor->pointer_sent = 0;
+	compositor->frames = 0;
+	compositor->configures = 0;
+	compositor->frame_latency = (CompositorLatency){ 0 };
+	compositor->configure_latency = (CompositorLatency){ 0 };
+	compositor->resize_latency = (CompositorLatency){ 0 };
+	compositor->ping_latency = (CompositorLatency){ 0 };
+	compositor->present_latency = (CompositorLatency){ 0 };
+	compositor->unseen_inputs = (CompositorInputs){ 0 };
+	compositor->async_frames = 0;
+	compositor->cursor_requests = 0;
+	compositor->stale_cursor_requests = 0;
+	for (int32 i = 0; i < COMPOSITOR_MAX_SURFACES; ++i) {
+		compositor->surfaces[i].committed_inputs = (CompositorInputs){ 0 };
+	}
+}
+
+/*
+ * [EN] Runs one scenario and prints its numbers, false when the client failed it.
+ * [ES] Corre un escenario e imprime sus números, falso cuando el cliente lo falló.
+ */
+[[nodiscard]] internal bool8 compositorRunScenario(Compositor* compositor,
+		CompositorScenario scenario)
+{
+	compositorResetStats(compositor, scenario);
+	uint64 start = compositor->scenario_start;
+	if (scenario == COMPOSITOR_CLOSE) {
+		for (int32 i = 0; i < COMPOSITOR_MAX_SURFACES; ++i) {
+			if (compositor->surfaces[i].xdg_toplevel) {
+				xdg_toplevel_send_close(compositor->surfaces[i].xdg_toplevel);
+			}
+		}
+		compositorRun(compositor, start + COMPOSITOR_CLOSE_TIMEOUT, nullptr);
+		if (compositor->client) {
+			printf("close: still connected %.0f ms after close\n",
+					clockNanosecondsToMilliseconds(COMPOSITOR_CLOSE_TIMEOUT));
+			return false;
+		}
+		printf("close: disconnected %.3f ms after close\n",
+				clockNanosecondsToMilliseconds(compositor->gone_time - start));
+		return true;
+	}
+
+	compositorRun(compositor, start + compositor->duration, nullptr);
+	if (compositor->pointer_surface && compositor->pointer && compositor->client) {
+		wl_pointer_send_leave(compositor->pointer, wl_display_next_serial(compositor->display),
+				compositor->pointer_surface);
+	}
+	compositor->pointer_surface = nullptr;
+	if (!compositor->client) {
+		printf("%s: the client disconnected\n", compositor_scenario_names[scenario]);
+		return false;
+	}
+	float64 seconds = (float64)(clockNowNanoseconds() - start) / NANOSECONDS_PER_SECOND;
+	printf("%s: %.1f frames/s", compositor_scenario_names[scenario], compositor->frames / seconds);
+	if (scenario == COMPOSITOR_RESIZE) {
+		printf(", %.1f configures/s", compositor->configures / seconds);
+		compositorPrintLatency("ack", &compositor->configure_latency);
+		compositorPrintLatency("resized frame", &compositor->resize_latency);
+	} else if (scenario == COMPOSITOR_POINTER || scenario == COMPOSITOR_LATENCY) {
+		printf(", %.0f motion events/s, %s presentation", compositor->pointer_sent / seconds,
+				(compositor->async_frames > 0) ? "async" : "vsync");
+		compositorPrintLatency("input to present", &compositor->present_latency);
+		if (compositor->cursor_requests > 0 && compositor->cursor_surface) {
+			printf(", cursor %dx%d hotspot %d,%d", compositor->cursor_width,
+					compositor->cursor_height, compositor->cursor_hotspot_x,
+					compositor->cursor_hotspot_y);
+		} else {
+			printf(", %s", (compositor->cursor_requests > 0) ? "cursor hidden" : "no cursor");
+		}
+		if (compositor->stale_cursor_requests > 0) {
+			printf(", %u set_cursor with a stale serial", compositor->stale_cursor_requests);
+		}
+	}
+	compositorPrintLatency("callback to commit", &compositor->frame_latency);
+	compositorPrintLatency("pong", &compositor->ping_latency);
+	printf("\n");
+	return compositor->frames > 0 && compositor->stale_cursor_requests == 0;
+}
+
+/*
+ * [EN] Starts the client with its end of a socketpair() as WAYLAND_SOCKET.
+ * [ES] Inicia el cliente con su extremo de un socketpair() como WAYLAND_SOCKET.
+ */
+[[nodiscard]] internal bool8 compositorSpawn(Compositor* compositor, char** arguments)
+{
+	int32 fds[2];
+	if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) < 0) {
+		logError("Failed to create the client socket (%s).", strerror(errno));
+		return false;
+	}
+	compositor->spawn_time = clockNowNanoseconds();
+	compositor->pid = fork();
+	if (compositor->pid < 0) {
+		logError("Failed to start %s (%s).", arguments[0], strerror(errno));
+		close(fds[0]);
+		close(fds[1]);
+		return false;
+	}
+	if (compositor->pid == 0) {
+		int32 fd = dup(fds[1]); // without FD_CLOEXEC | sin FD_CLOEXEC
+		char socket_name[16];
+		snprintf(socket_name, sizeof(socket_name), "%d", fd);
+		setenv("WAYLAND_SOCKET", socket_name, 1);
+		unsetenv("WAYLAND_DISPLAY");
+		execvp(arguments[0], arguments);
+		fprintf(stderr, "Failed to run %s (%s).\n", arguments[0], strerror(errno));
+		_exit(127);
+	}
+	close(fds[1]);
+	compositor->client = wl_client_create(compositor->display, fds[0]);
+	if (!compositor->client) {
+		logError("Failed to create the wayland client.");
+		close(fds[0]);
+		return false;
+	}
+	compositor->client_destroyed.notify = compositorClientDestroyed;
+	wl_client_add_destroy_listener(compositor->client, &compositor->client_destroyed);
+	return true;
+}
+
+[[nodiscard]] internal bool8 compositorCreateGlobals(Compositor* compositor)
+{
+	struct wl_display* display = compositor->display;
+	return wl_global_create(display, &wl_compositor_interface, wl_compositor_interface.version,
+				compositor, compositorBindCompositor)
+		&& wl_global_create(display, &wl_shm_interface, wl_shm_interface.version, compositor,
+				compositorBindShm)
+		&& wl_global_create(display, &wl_seat_interface, COMPOSITOR_SEAT_VERSION, compositor,
+				compositorBindSeat)
+		&& wl_global_create(display, &xdg_wm_base_interface, COMPOSITOR_XDG_WM_BASE_VERSION,
+				compositor, compositorBindWmBase)
+		&& wl_global_create(display, &wp_tearing_control_manager_v1_interface,
+				COMPOSITOR_TEARING_CONTROL_VERSION, compositor, compositorBindTearingManager);
+}
+
+int32 main(int32 argument_count, char** arguments)
+{
+	Compositor compositor = { .refresh = 60, .resize_rate = 240, .pointer_rate = 8000,
+		.ping_rate = 20, .duration = 3'000'000'000ull, .pid = -1 };
+	CompositorScenario scenarios[COMPOSITOR_SCENARIO_COUNT];
+	int32 scenario_count = 0;
+	int32 i = 1;
+	bool8 valid = true;
+	for (; i < argument_count && strcmp(arguments[i], "--"); ++i) {
+		const char* value = (i + 1 < argument_count) ? arguments[i + 1] : "";
+		if (!strcmp(arguments[i], "--refresh")) {
+			compositor.refresh = (uint32)atoi(value);
+			i++;
+		} else if (!strcmp(arguments[i], "--resize-rate")) {
+			compositor.resize_rate = (uint32)atoi(value);
+			i++;
+		} else if (!strcmp(arguments[i], "--pointer-rate")) {
+			compositor.pointer_rate = (uint32)atoi(value);
+			i++;
+		} else if (!strcmp(arguments[i], "--ping-rate")) {
+			compositor.ping_rate = (uint32)atoi(value);
+			i++;
+		} else if (!strcmp(arguments[i], "--duration")) {
+			compositor.duration = (uint64)atoi(value) * NANOSECONDS_PER_MILLISECOND;
+			i++;
+		} else if (!strcmp(arguments[i], "--size")) {
+			valid = sscanf(value, "%dx%d", &compositor.initial_width,
+					&compositor.initial_height) == 2;
+			i++;
+		} else if (!strcmp(arguments[i], "--first-frame-budget")) {
+			compositor.first_frame_budget = (uint64)atoi(value) * NANOSECONDS_PER_MILLISECOND;
+			i++;
+		} else {
+			int32 s = 0;
+			while (s < COMPOSITOR_SCENARIO_COUNT
+					&& strcmp(arguments[i], compositor_scenario_names[s])) {
+				s++;
+			}
+			if (s == COMPOSITOR_SCENARIO_COUNT || scenario_count == COMPOSITOR_SCENARIO_COUNT) {
+				valid = false;
+				break;
+			}
+			scenarios[scenario_count++] = (CompositorScenario)s;
+		}
+	}
+	valid = valid && i + 1 < argument_count && compositor.refresh > 0
+		&& compositor.resize_rate > 0 && compositor.pointer_rate > 0 && compositor.ping_rate > 0;
+	if (!valid) {
+		fprintf(stderr, "usage: %s [--refresh <hz>] [--resize-rate <hz>] [--pointer-rate <hz>]"
+				" [--ping-rate <hz>] [--duration <ms>] [--size <w>x<h>]"
+				" [--first-frame-budget <ms>] [frames | resize | pointer | latency | close]..."
+				" -- <client> [arguments]\n", arguments[0]);
+		return EXIT_FAILURE;
+	}
+	if (scenario_count == 0) {
+		for (int32 s = 0; s < COMPOSITOR_SCENARIO_COUNT; ++s) {
+			scenarios[scenario_count++] = (CompositorScenario)s;
+		}
+	}
+
+	compositor.display = wl_display_create();
+	if (!compositor.display || !compositorCreateGlobals(&compositor)
+			|| !compositorSpawn(&compositor, &arguments[i + 1])) {
+		logFatal("Failed to start the compositor.");
+		return EXIT_FAILURE;
+	}
+	compositor.next_vblank = clockNowNanoseconds();
+	compositor.next_ping = compositor.next_vblank;
+	compositor.scenario = COMPOSITOR_FRAMES;
+	compositorRun(&compositor, compositor.spawn_time + COMPOSITOR_STARTUP_TIMEOUT,
+			compositorShownFirstFrame);
+	bool8 passed = compositorShownFirstFrame(&compositor);
+	if (passed) {
+		uint64 first_frame = compositor.first_frame_time - compositor.spawn_time;
+		printf("startup: configured %.3f ms, first frame %.3f ms after spawn, %dx%d %s\n",
+				clockNanosecondsToMilliseconds(compositor.configured_time - compositor.spawn_time),
+				clockNanosecondsToMilliseconds(first_frame), compositor.first_frame_width,
+				compositor.first_frame_height, compositor.first_frame_drawn ? "drawn" : "blank");
+		bool8 sized = (compositor.initial_width == 0
+				|| compositor.first_frame_width == compositor.initial_width)
+			&& (compositor.initial_height == 0
+				|| compositor.first_frame_height == compositor.initial_height);
+		bool8 in_budget = compositor.first_frame_budget == 0
+			|| first_frame <= compositor.first_frame_budget;
+		if (!sized) {
+			logError("The first frame doesn't have the configured size.");
+		}
+		if (!compositor.first_frame_drawn) {
+			logError("The first frame is blank.");
+		}
+		if (!in_budget) {
+			logError("The first frame is over its budget of %u ms.",
+					compositorMilliseconds(compositor.first_frame_budget));
+		}
+		passed = sized && compositor.first_frame_drawn && in_budget;
+	} else {
+		printf("startup: no frame %.0f ms after spawn\n",
+				clockNanosecondsToMilliseconds(COMPOSITOR_STARTUP_TIMEOUT));
+	}
+	for (int32 s = 0; s < scenario_count && passed; ++s) {
+		passed = compositorRunScenario(&compositor, scenarios[s]);
+	}
+
+	if (compositor.client) {
+		kill(compositor.pid, SIGTERM);
+	}
+	int32 status = 0;
+	waitpid(compositor.pid, &status, 0);
+	wl_display_destroy(compositor.display);
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* 18/10/2026 - kanso engine */
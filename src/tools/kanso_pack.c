@@ -0,0 +1,240 @@
+/* kanso_pack.c: asset pack building tool | herramienta para construir paquetes de recursos */
+/*
+ * [EN] Usage:
+ *    kanso_pack create <pack> <file>...   packs the files, each named by its path as given
+ *    kanso_pack list <pack>               prints the table of contents
+ *    kanso_pack bench <pack>              measures cold-start and warm-start load times
+ * [ES] Uso:
+ *    kanso_pack create <paquete> <archivo>...   empaca los archivos, cada uno nombrado por su ruta
+ *    kanso_pack list <paquete>                  imprime la tabla de contenidos
+ *    kanso_pack bench <paquete>                 mide tiempos de carga en frío y en caliente
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define KSO_LOG_IMPLEMENTATION
+
+#include "../log.h"
+#include "../defines.h"
+#include "../types.h"
+#include "../asset_pack.h"
+#include "../clock.h"
+
+#include "../linux/linux_clock.c"
+#include "../asset_pack.c"
+#include "../linux/linux_asset_pack.c"
+
+#include <poll.h>
+
+typedef struct {
+	const char* path;
+	AssetPackEntry entry;
+} PackInput;
+
+internal int packCompareEntries(const void* a, const void* b)
+{
+	uint64 hash_a = ((const PackInput*)a)->entry.name_hash;
+	uint64 hash_b = ((const PackInput*)b)->entry.name_hash;
+	return (hash_a > hash_b) - (hash_a < hash_b);
+}
+
+internal uint64 packAlign(uint64 value)
+{
+	return (value + ASSET_PACK_ALIGNMENT - 1) & ~(uint64)(ASSET_PACK_ALIGNMENT - 1);
+}
+
+[[nodiscard]] internal bool8 packCopyFile(FILE* output, const char* path, uint64 size)
+{
+	FILE* input = fopen(path, "rb");
+	if (!input) {
+		return false;
+	}
+	uint8 chunk[64 * 1024];
+	uint64 remaining = size;
+	while (remaining > 0) {
+		size_t wanted = (remaining < sizeof(chunk)) ? (size_t)remaining : sizeof(chunk);
+		size_t got = fread(chunk, 1, wanted, input);
+		if (got == 0 || fwrite(chunk, 1, got, output) != got) {
+			fclose(input);
+			return false;
+		}
+		remaining -= got;
+	}
+	fclose(input);
+	return true;
+}
+
+internal int32 packCreate(const char* pack_path, int32 file_count, char** file_paths)
+{
+	PackInput* inputs = calloc(file_count, sizeof(PackInput));
+	if (!inputs) {
+		logFatal("Out of memory.");
+		return EXIT_FAILURE;
+	}
+
+	/* [EN] Table of contents | [ES] Tabla de contenidos */
+	uint64 offset = packAlign(sizeof(AssetPackHeader) + ((uint64)file_count * sizeof(AssetPackEntry)));
+	for (int32 i = 0; i < file_count; ++i) {
+		PackInput* input = &inputs[i];
+		input->path = file_paths[i];
+		if (strlen(input->path) >= ASSET_NAME_SIZE) {
+			logFatal("Asset name %s is longer than %d characters.", input->path, ASSET_NAME_SIZE - 1);
+			free(inputs);
+			return EXIT_FAILURE;
+		}
+		struct stat file_status;
+		if (stat(input->path, &file_status) < 0 || !S_ISREG(file_status.st_mode)) {
+			logFatal("Can't read %s.", input->path);
+			free(inputs);
+			return EXIT_FAILURE;
+		}
+		strcpy(input->entry.name, input->path);
+		input->entry.name_hash = assetHashName(input->path);
+		input->entry.offset = offset;
+		input->entry.size = (uint64)file_status.st_size;
+		offset = packAlign(offset + input->entry.size);
+	}
+	qsort(inputs, file_count, sizeof(PackInput), packCompareEntries);
+
+	AssetPackHeader header = {
+		.magic = ASSET_PACK_MAGIC,
+		.version = ASSET_PACK_VERSION,
+		.entry_count = (uint32)file_count,
+		.alignment = ASSET_PACK_ALIGNMENT,
+		.toc_offset = sizeof(AssetPackHeader),
+		.file_size = offset,
+	};
+
+	FILE* output = fopen(pack_path, "wb");
+	if (!output) {
+		logFatal("Can't create %s.", pack_path);
+		free(inputs);
+		return EXIT_FAILURE;
+	}
+	bool8 succeeded = fwrite(&header, sizeof(header), 1, output) == 1;
+	for (int32 i = 0; succeeded && i < file_count; ++i) {
+		succeeded = fwrite(&inputs[i].entry, sizeof(AssetPackEntry), 1, output) == 1;
+	}
+	// [EN] Every asset at its aligned offset, the gaps are zero padding
+	// [ES] Cada recurso en su desplazamiento alineado, los huecos son relleno con ceros
+	for (int32 i = 0; succeeded && i < file_count; ++i) {
+		succeeded = fseek(output, (long)inputs[i].entry.offset, SEEK_SET) == 0
+			&& packCopyFile(output, inputs[i].path, inputs[i].entry.size);
+	}
+	if (succeeded && offset > 0) { // size the file up to the last padding | tamaño final
+		succeeded = fseek(output, (long)(offset - 1), SEEK_SET) == 0 && fputc(0, output) != EOF;
+	}
+	succeeded = (fclose(output) == 0) && succeeded;
+	free(inputs);
+	if (!succeeded) {
+		logFatal("Failed to write %s.", pack_path);
+		return EXIT_FAILURE;
+	}
+	printf("Packed %d assets in %s (%llu bytes).\n", file_count, pack_path,
+			(unsigned long long)offset);
+	return EXIT_SUCCESS;
+}
+
+internal int32 packList(const char* pack_path)
+{
+	AssetPack pack;
+	if (!assetPackOpen(&pack, pack_path)) {
+		return EXIT_FAILURE;
+	}
+	for (uint32 i = 0; i < pack.header->entry_count; ++i) {
+		const AssetPackEntry* entry = &pack.entries[i];
+		printf("%016llx %12llu %12llu %s\n", (unsigned long long)entry->name_hash,
+				(unsigned long long)entry->offset, (unsigned long long)entry->size, entry->name);
+	}
+	assetPackClose(&pack);
+	return EXIT_SUCCESS;
+}
+
+internal void packBenchAssetLoaded(void* context, const AssetPackEntry* entry, const void* data)
+{
+	int32* remaining = context;
+	(*remaining)--;
+}
+
+/*
+ * [EN] Opens the pack and waits, through the event loop path, until the loader made every asset
+ * resident. Cold runs drop the file from the page cache first.
+ * [ES] Abre el paquete y espera, por la ruta del ciclo de eventos, hasta que el cargador volvió
+ * residentes todos los recursos. Las corridas en frío primero sacan el archivo del caché de páginas.
+ */
+[[nodiscard]] internal bool8 packBenchLoad(const char* pack_path, bool8 cold, float32* milliseconds)
+{
+	if (cold) {
+		int32 fd = open(pack_path, O_RDONLY);
+		if (fd < 0) {
+			return false;
+		}
+		fdatasync(fd);
+		posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+		close(fd);
+	}
+
+	uint64 start = clockNowNanoseconds();
+	AssetPack pack;
+	AssetLoader loader;
+	if (!assetPackOpen(&pack, pack_path)) {
+		return false;
+	}
+	if (!assetLoaderStart(&loader, &pack)) {
+		assetPackClose(&pack);
+		return false;
+	}
+	int32 remaining = 0;
+	for (uint32 i = 0; i < pack.header->entry_count; ++i) {
+		if (assetLoaderRequest(&loader, &pack.entries[i], packBenchAssetLoaded, &remaining)) {
+			remaining++;
+		} else { // queue full, drain it first | cola llena, primero se vacía
+			struct pollfd wake = { .fd = assetLoaderGetWakeFd(&loader), .events = POLLIN };
+			poll(&wake, 1, -1);
+			assetLoaderDispatch(&loader);
+			i--;
+		}
+	}
+	while (remaining > 0) {
+		struct pollfd wake = { .fd = assetLoaderGetWakeFd(&loader), .events = POLLIN };
+		poll(&wake, 1, -1);
+		assetLoaderDispatch(&loader);
+	}
+	*milliseconds = clockNanosecondsToMilliseconds(clockNowNanoseconds() - start);
+
+	assetLoaderStop(&loader);
+	assetPackClose(&pack);
+	return true;
+}
+
+internal int32 packBench(const char* pack_path)
+{
+	#define PACK_BENCH_RUNS 5
+	for (int32 run = 0; run < PACK_BENCH_RUNS; ++run) {
+		float32 cold_time, warm_time;
+		if (!packBenchLoad(pack_path, true, &cold_time)
+				|| !packBenchLoad(pack_path, false, &warm_time)) {
+			return EXIT_FAILURE;
+		}
+		printf("run %d: cold %.3f ms, warm %.3f ms\n", run, cold_time, warm_time);
+	}
+	return EXIT_SUCCESS;
+}
+
+int32 main(int32 argument_count, char** arguments)
+{
+	if (argument_count >= 4 && !strcmp(arguments[1], "create")) {
+		return packCreate(arguments[2], argument_count - 3, arguments + 3);
+	} else if (argument_count == 3 && !strcmp(arguments[1], "list")) {
+		return packList(arguments[2]);
+	} else if (argument_count == 3 && !strcmp(arguments[1], "bench")) {
+		return packBench(arguments[2]);
+	}
+	fprintf(stderr, "usage: %s create <pack> <file>... | list <pack> | bench <pack>\n",
+			arguments[0]);
+	return EXIT_FAILURE;
+}
+
+/* 18/10/2026 - kanso engine */
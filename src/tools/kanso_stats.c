@@ -0,0 +1,145 @@
+/* kanso_stats.c: live metrics viewer | visor de métricas en vivo */
+/*
+ * [EN] Usage:
+ *    kanso_stats list                       prints the running instances that publish live stats
+ *    kanso_stats watch <pid> [interval]     prints rates and the frame time histogram of each
+ *                                           interval, in milliseconds (default 1000)
+ * [ES] Uso:
+ *    kanso_stats list                       imprime las instancias en ejecución que publican
+ *    kanso_stats watch <pid> [intervalo]    imprime tasas y el histograma de tiempos de fotograma
+ *                                           de cada intervalo, en milisegundos (1000 por defecto)
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define KSO_LOG_IMPLEMENTATION
+
+#include "../log.h"
+#include "../defines.h"
+#include "../types.h"
+#include "../clock.h"
+#include "../live_stats.h"
+
+#include "../linux/linux_clock.c"
+#include "../live_stats.c"
+#include "../random.c"
+#include "../linux/linux_shm.c"
+#include "../linux/linux_live_stats.c"
+
+#include <dirent.h>
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+
+#define STATS_SHM_DIRECTORY "/dev/shm" // linux keeps shm_open() objects here | objetos shm_open()
+#define STATS_DEFAULT_INTERVAL 1000
+#define STATS_BAR_WIDTH 40
+
+[[nodiscard]] internal bool8 statsProcessAlive(int32 pid)
+{
+	return kill(pid, 0) == 0 || errno == EPERM;
+}
+
+internal int32 statsList(void)
+{
+	DIR* directory = opendir(STATS_SHM_DIRECTORY);
+	if (!directory) {
+		fprintf(stderr, "Can't read %s.\n", STATS_SHM_DIRECTORY);
+		return EXIT_FAILURE;
+	}
+	struct dirent* entry;
+	while ((entry = readdir(directory))) {
+		int32 pid = 0;
+		// [EN] The object name without its leading '/' | [ES] El nombre del objeto sin su '/'
+		if (sscanf(entry->d_name, LIVE_STATS_NAME_FORMAT + 1, &pid) == 1) {
+			printf("%d%s\n", pid, statsProcessAlive(pid) ? "" : " (exited)");
+		}
+	}
+	closedir(directory);
+	return EXIT_SUCCESS;
+}
+
+internal void statsPrintHistogram(const LiveStats* previous, const LiveStats* current)
+{
+	uint32 counts[LIVE_STATS_HISTOGRAM_BUCKETS];
+	uint32 max_count = 0;
+	for (int32 i = 0; i < LIVE_STATS_HISTOGRAM_BUCKETS; ++i) {
+		counts[i] = current->frame_time_histogram[i] - previous->frame_time_histogram[i];
+		max_count = (counts[i] > max_count) ? counts[i] : max_count;
+	}
+	for (int32 i = 0; i < LIVE_STATS_HISTOGRAM_BUCKETS; ++i) {
+		if (counts[i] == 0) {
+			continue;
+		}
+		char bar[STATS_BAR_WIDTH + 1];
+		int32 length = (int32)(((uint64)counts[i] * STATS_BAR_WIDTH + max_count - 1) / max_count);
+		memset(bar, '#', (uint64)length);
+		bar[length] = '\0';
+		if (i == LIVE_STATS_HISTOGRAM_BUCKETS - 1) {
+			printf("  >=%2d ms %-*s %u\n", i, STATS_BAR_WIDTH, bar, counts[i]);
+		} else {
+			printf("  %2d-%2d ms %-*s %u\n", i, i + 1, STATS_BAR_WIDTH, bar, counts[i]);
+		}
+	}
+}
+
+internal int32 statsWatch(int32 pid, int32 interval)
+{
+	LiveStatsSegment segment;
+	if (!liveStatsAttach(&segment, pid)) {
+		return EXIT_FAILURE;
+	}
+	LiveStats previous;
+	if (!liveStatsRead(segment.page, &previous)) {
+		fprintf(stderr, "The stats of %d keep changing, couldn't read them.\n", pid);
+		liveStatsClose(&segment);
+		return EXIT_FAILURE;
+	}
+
+	while (statsProcessAlive(pid)) {
+		poll(nullptr, 0, interval);
+		LiveStats current;
+		if (!liveStatsRead(segment.page, &current)) {
+			continue; // try again next interval | reintentar el siguiente intervalo
+		}
+		if (current.update_time == previous.update_time) {
+			printf("pid %d: no new frames\n\n", pid);
+			continue;
+		}
+
+		float64 seconds = (float64)(current.update_time - previous.update_time)
+			/ NANOSECONDS_PER_SECOND;
+		float64 frames = (float64)(current.frame_count - previous.frame_count);
+		float64 events = (float64)(current.events_dispatched - previous.events_dispatched);
+		printf("pid %d: %.1f fps, frame %.2f ms, render %.2f ms, latency %.2f ms %s\n", pid,
+				frames / seconds, current.frame_time, current.render_time,
+				current.presentation_latency,
+				(current.presentation_mode == LIVE_STATS_PRESENTATION_ASYNC) ? "async" : "vsync");
+		printf("  events %.0f/s, queue depth %u, max dispatch %.3f ms, buffers busy %u/%u\n",
+				events / seconds, current.event_queue_depth, current.max_event_dispatch_time,
+				current.buffers_busy, current.buffer_count);
+		statsPrintHistogram(&previous, &current);
+		printf("\n");
+		fflush(stdout);
+		previous = current;
+	}
+	printf("pid %d exited.\n", pid);
+	liveStatsClose(&segment);
+	return EXIT_SUCCESS;
+}
+
+int32 main(int32 argument_count, char** arguments)
+{
+	if (argument_count == 2 && !strcmp(arguments[1], "list")) {
+		return statsList();
+	} else if ((argument_count == 3 || argument_count == 4) && !strcmp(arguments[1], "watch")) {
+		int32 interval = (argument_count == 4) ? atoi(arguments[3]) : STATS_DEFAULT_INTERVAL;
+		return statsWatch(atoi(arguments[2]), (interval > 0) ? interval : STATS_DEFAULT_INTERVAL);
+	}
+	fprintf(stderr, "usage: %s list | watch <pid> [interval ms]\n", arguments[0]);
+	return EXIT_FAILURE;
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,1544 @@
+/* kanso_test.c: engine correctness checks | comprobaciones de correctitud del motor */
+/*
+ * [EN] Usage:
+ *    kanso_test [check]...        runs the given checks, or all of them, exits with the failures
+ *    kanso_test image [corpus]    decodes every file of the corpus manifest (tests/images)
+ *    kanso_test hud               draws the panel with the widest stats, checks it stays inside,
+ *                                 and that redrawing the changed area equals a full redraw
+ *    kanso_test jobs              every job runs once, dependencies and parallel-for ranges hold
+ *    kanso_test scale             every filter against golden hashes, in the build's SIMD path
+ *    kanso_test raster            a triangle mesh covers each pixel once, shared edges included
+ *    kanso_test math              batch functions give the bits of the single ones, and goldens
+ *    kanso_test noise             random streams and noise fills match goldens in every build
+ *    kanso_test replay            a replay by frame renders what the recorded session rendered
+ *    kanso_test shm               the shm arena block list is first fit, aligned and sorted, and
+ *                                 grows and fails where it should
+ *    kanso_test capture           4:2:0 conversion of odd sizes against hand computed values, and
+ *                                 the frames a full ring or a new size drop
+ *    kanso_test perf              per-frame IPC, misses per kilo instruction and CPU time, with
+ *                                 counters that step back or are missing
+ *    kanso_test live              live stats seqlock, a reader never sees a half written update
+ *                                 while another thread writes, and frame time histogram edges
+ * Every check prints one line per failure and a summary, build it with -fsanitize=address so
+ * malformed inputs catch out of bounds accesses too. SIMD paths are chosen at compile time, the
+ * build makes a scalar (-U__SSE2__), an SSE2 and an AVX2 (-mavx2) kanso_test and all of them must
+ * match the same goldens.
+ * [ES] Uso:
+ *    kanso_test [comprobación]...   corre las comprobaciones dadas, o todas, sale con los fallos
+ *    kanso_test image [corpus]      decodifica cada archivo del manifiesto del corpus
+ *                                   (tests/images)
+ *    kanso_test hud                 dibuja el panel con las estadísticas más anchas, revisa que
+ *                                   no se salga, y que redibujar el área cambiada iguala un
+ *                                   redibujado completo
+ *    kanso_test jobs                cada trabajo corre una vez, las dependencias y los rangos del
+ *                                   for paralelo se cumplen
+ *    kanso_test scale               cada filtro contra hashes de referencia, en la ruta SIMD de
+ *                                   la compilación
+ *    kanso_test raster              una malla de triángulos cubre cada píxel una vez, también en
+ *                                   las aristas compartidas
+ *    kanso_test math                las funciones por lotes dan los bits de las individuales, y
+ *                                   las referencias
+ *    kanso_test noise               flujos aleatorios y rellenos de ruido igualan las referencias
+ *                                   en cada compilación
+ *    kanso_test replay              una repetición por fotograma dibuja lo que dibujó la sesión
+ *                                   grabada
+ *    kanso_test shm                 la lista de bloques de la arena shm es de primer hueco,
+ *                                   alineada y ordenada, y crece y falla donde debe
+ *    kanso_test capture             conversión 4:2:0 de tamaños impares contra valores calculados
+ *                                   a mano, y los fotogramas que descartan un anillo lleno o un
+ *                                   tamaño nuevo
+ *    kanso_test perf                IPC, fallos por mil instrucciones y tiempo de CPU por
+ *                                   fotograma, con contadores que retroceden o que faltan
+ *    kanso_test live                'seqlock' de estadísticas en vivo, un lector nunca ve una
+ *                                   actualización a medias mientras otro hilo escribe, y los
+ *                                   bordes del histograma de tiempos de fotograma
+ * Cada comprobación imprime una línea por fallo y un resumen, compilarlo con -fsanitize=address
+ * hace que las entradas malformadas detecten también accesos fuera de límites. Las rutas SIMD se
+ * eligen al compilar, la compilación hace un kanso_test escalar (-U__SSE2__), uno SSE2 y uno AVX2
+ * (-mavx2) y todos deben coincidir con las mismas referencias.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#define KSO_LOG_IMPLEMENTATION
+
+#include "../log.h"
+#include "../defines.h"
+#include "../types.h"
+#include "../render.h"
+#include "../arena.h"
+#include "../image.h"
+#include "../clock.h"
+#include "../text.h"
+#include "../hud.h"
+#include "../thread.h"
+#include "../scale.h"
+#include "../raster.h"
+#include "../vector_math.h"
+#include "../random.h"
+#include "../noise.h"
+#include "../input_log.h"
+#include "../frame_timing.h"
+#include "../shm_blocks.h"
+#include "../frame_capture.h"
+#include "../perf_counters.h"
+#include "../live_stats.h"
+
+#include "../linux/linux_clock.c"
+#include "../linux/linux_thread.c"
+#include "../image.c"
+#include "../text.c"
+#include "../hud.c"
+#include "../scale.c"
+#include "../raster.c"
+#include "../vector_math.c"
+#include "../random.c"
+#include "../noise.c"
+#include "../input_log.c"
+#include "../frame_timing.c"
+#include "../shm_blocks.c"
+#include "../frame_capture.c"
+#include "../linux/linux_frame_capture.c"
+#include "../perf_counters.c"
+#include "../live_stats.c"
+
+#define TEST_IMAGE_CORPUS "tests/images"
+#define TEST_IMAGE_ARENA_SIZE (64ull * 1024 * 1024)
+#define TEST_PATH_SIZE 512
+#define TEST_HUD_WIDTH 1024
+#define TEST_HUD_HEIGHT 640
+#define TEST_HUD_BACKGROUND 0x0012'3456
+#define TEST_JOB_WORKERS 3 // more threads than cores exercise preemption too | también desalojos
+#define TEST_JOB_COUNT 100'000
+#define TEST_JOB_BATCH 1000
+#define TEST_PARALLEL_FOR_COUNT 1000
+#define TEST_SCALE_WIDTH 173 // odd, SIMD loops get tails | impar, los ciclos SIMD tienen colas
+#define TEST_SCALE_HEIGHT 97
+#define TEST_RASTER_SIZE 64 // a power of two keeps clip to screen exact | mantiene exacto
+#define TEST_RASTER_CELLS 6
+#define TEST_RASTER_CELL_SIZE 8
+#define TEST_RASTER_ORIGIN 8
+#define TEST_MATH_BLOCKS 64
+#define TEST_MATH_VECTORS 511 // odd, AVX takes pairs | impar, AVX toma pares
+#define TEST_RANDOM_SEED 0x1234'5678'9abc'def0ull
+#define TEST_RANDOM_COUNT 1000
+#define TEST_RANDOM_WIDE_COUNT 1003 // not whole steps | no son pasos completos
+#define TEST_NOISE_SIZE 131 // over the threading threshold, ragged lanes | carriles incompletos
+#define TEST_REPLAY_STEPS 600
+#define TEST_REPLAY_EVENTS (TEST_REPLAY_STEPS * 6)
+#define TEST_REPLAY_DEVICE_TIME 0x1234'5678'9AFF'0000ull // microseconds, 24 bits wrap soon | pronto
+#define TEST_SHM_PAGES 256 // max_size in SHM_BLOCKS_ALIGNMENT pages | en páginas
+#define TEST_SHM_OPERATIONS 20'000
+#define TEST_CAPTURE_WIDTH 521 // odd, and a frame is bigger than a pipe | más grande que un 'pipe'
+#define TEST_CAPTURE_HEIGHT 263
+#define TEST_CAPTURE_PADDING 3 // pixels past each row | píxeles después de cada fila
+#define TEST_CAPTURE_TIMEOUT (5 * NANOSECONDS_PER_SECOND)
+#define TEST_LIVE_WRITES 200'000
+
+typedef struct {
+	const char* name;
+	int32 checks;
+	int32 failures;
+} TestReport;
+
+internal void testCheck(TestReport* report, bool8 passed, const char* what)
+{
+	report->checks++;
+	if (!passed) {
+		report->failures++;
+		printf("FAIL %s: %s\n", report->name, what);
+	}
+}
+
+internal int32 testSummary(const TestReport* report)
+{
+	printf("%s: %d checks, %d failures\n", report->name, report->checks, report->failures);
+	return report->failures;
+}
+
+#define TEST_HASH_SEED 0xcbf2'9ce4'8422'2325ull
+
+/*
+ * [EN] FNV-1a, goldens are hashes of whole outputs. Chained through hash, start at TEST_HASH_SEED.
+ * [ES] FNV-1a, las referencias son hashes de salidas completas. Encadenado por hash, empieza en
+ * TEST_HASH_SEED.
+ */
+internal uint64 testHashBytes(uint64 hash, const void* data, uint64 size)
+{
+	const uint8* bytes = data;
+	for (uint64 i = 0; i < size; ++i) {
+		hash = (hash ^ bytes[i]) * 0x0000'0100'0000'01b3ull;
+	}
+	return hash;
+}
+
+internal uint64 testHashBitmap(const Bitmap* bitmap)
+{
+	uint64 hash = TEST_HASH_SEED;
+	for (int32 row = 0; row < bitmap->height; ++row) {
+		const uint8* bytes = (const uint8*)bitmap->memory + ((uint64)row * bitmap->bytes_per_row);
+		hash = testHashBytes(hash, bytes, (uint64)bitmap->width * sizeof(uint32));
+	}
+	return hash;
+}
+
+[[nodiscard]] internal uint8* testReadFile(const char* path, uint64* size)
+{
+	FILE* file = fopen(path, "rb");
+	if (!file) {
+		return nullptr;
+	}
+	fseek(file, 0, SEEK_END);
+	long length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	uint8* data = (length > 0) ? malloc((uint64)length) : nullptr;
+	if (data && fread(data, 1, (uint64)length, file) != (uint64)length) {
+		free(data);
+		data = nullptr;
+	}
+	fclose(file);
+	*size = (uint64)length;
+	return data;
+}
+
+/*
+ * [EN] Each manifest line is "<file> ok|fail <width> <height> <hash>": valid files must decode to
+ * pixels with that hash, malformed ones must be rejected leaving the arena as it was. The hashes
+ * come from the pixels the corpus was generated from, not from this decoder.
+ * [ES] Cada línea del manifiesto es "<archivo> ok|fail <ancho> <alto> <hash>": los archivos válidos
+ * deben decodificarse a píxeles con ese hash, los malformados deben rechazarse dejando la arena
+ * como estaba. Los hashes vienen de los píxeles con los que se generó el corpus, no de este
+ * decodificador.
+ */
+internal int32 testImage(const char* corpus)
+{
+	TestReport report = { .name = "image" };
+	char path[TEST_PATH_SIZE];
+	snprintf(path, sizeof(path), "%s/manifest.txt", corpus);
+	FILE* manifest = fopen(path, "r");
+	void* memory = malloc(TEST_IMAGE_ARENA_SIZE);
+	if (!manifest || !memory) {
+		printf("FAIL image: can't open %s\n", path);
+		free(memory);
+		return 1;
+	}
+	MemoryArena arena = arenaCreate(memory, TEST_IMAGE_ARENA_SIZE);
+
+	char line[TEST_PATH_SIZE];
+	while (fgets(line, sizeof(line), manifest)) {
+		char name[128], expected[8];
+		int32 width, height;
+		unsigned long long hash;
+		if (line[0] == '#' || sscanf(line, "%127s %7s %d %d %llx", name, expected, &width,
+					&height, &hash) != 5) {
+			continue;
+		}
+		snprintf(path, sizeof(path), "%s/%s", corpus, name);
+		uint64 size;
+		uint8* data = testReadFile(path, &size);
+		if (!data) {
+			testCheck(&report, false, name);
+			continue;
+		}
+		// [EN] An exact size copy, reads past the end hit the sanitizer's redzone
+		// [ES] Una copia de tamaño exacto, las lecturas más allá del final tocan la zona roja
+		Bitmap image = { 0 };
+		uint64 mark = arenaMark(&arena);
+		bool8 decoded = imageDecode(data, size, &arena, &image);
+		if (!strcmp(expected, "ok")) {
+			testCheck(&report, decoded && image.width == width && image.height == height
+					&& testHashBitmap(&image) == hash, name);
+		} else {
+			testCheck(&report, !decoded && arenaMark(&arena) == mark, name);
+		}
+		arenaRestore(&arena, mark);
+		free(data);
+	}
+	fclose(manifest);
+	free(memory);
+	return testSummary(&report);
+}
+
+/*
+ * [EN] Counts the pixels of target outside the rectangle that aren't outside.
+ * [ES] Cuenta los píxeles de target fuera del rectángulo que no son outside.
+ */
+internal int32 testCountOutside(const Bitmap* target, int32 x, int32 y, int32 width,
+		int32 height, uint32 outside)
+{
+	int32 count = 0;
+	for (int32 row = 0; row < target->height; ++row) {
+		const uint32* pxl = (const uint32*)((const uint8*)target->memory
+				+ ((int64)row * target->bytes_per_row));
+		for (int32 col = 0; col < target->width; ++col) {
+			bool8 inside = col >= x && col < x + width && row >= y && row < y + height;
+			count += !inside && pxl[col] != outside;
+		}
+	}
+	return count;
+}
+
+/*
+ * [EN] Pixels of two bitmaps of the same size that differ.
+ * [ES] Píxeles de dos 'bitmaps' del mismo tamaño que difieren.
+ */
+internal int32 testCountDifferent(const Bitmap* a, const Bitmap* b)
+{
+	int32 count = 0;
+	for (int32 row = 0; row < a->height; ++row) {
+		const uint32* pxl_a = (const uint32*)((const uint8*)a->memory
+				+ ((int64)row * a->bytes_per_row));
+		const uint32* pxl_b = (const uint32*)((const uint8*)b->memory
+				+ ((int64)row * b->bytes_per_row));
+		for (int32 col = 0; col < a->width; ++col) {
+			count += pxl_a[col] != pxl_b[col];
+		}
+	}
+	return count;
+}
+
+/*
+ * [EN] The widest stats the panel shows, and frame times no format fits: every line has to stay
+ * inside the panel, over a frame and on its own layer. Then a layer updated with slightly
+ * different stats and one more frame, redrawn only in the area hudUpdateLayer() returned, has to
+ * equal a layer redrawn whole.
+ * [ES] Las estadísticas más anchas que muestra el panel, y tiempos de fotograma que ningún formato
+ * acomoda: cada línea tiene que quedar dentro del panel, sobre un fotograma y en su propia capa.
+ * Luego una capa actualizada con estadísticas un poco distintas y un fotograma más, redibujada sólo
+ * en el área que regresó hudUpdateLayer(), tiene que igualar una capa redibujada completa.
+ */
+internal int32 testHud(void)
+{
+	TestReport report = { .name = "hud" };
+	Hud hud;
+	uint32* memory = malloc((uint64)TEST_HUD_WIDTH * TEST_HUD_HEIGHT * sizeof(uint32));
+	if (!memory || !hudInitialize(&hud)) {
+		printf("FAIL hud: can't initialize\n");
+		free(memory);
+		return 1;
+	}
+	hudToggle(&hud);
+	for (int32 i = 0; i < HUD_GRAPH_SAMPLES; ++i) {
+		hudRecordFrameTime(&hud, 12345.67f);
+	}
+	PerfFrameStats perf = { .instructions_per_cycle = 9.99f,
+		.llc_misses_per_kilo_instruction = 999.9f, .dtlb_misses_per_kilo_instruction = 999.9f,
+		.cpu_time = 999.99f, .page_faults = 9999, .mode = PERF_COUNTERS_HARDWARE };
+	HudBufferStats stats = { .width = 7680, .height = 4320, .bytes_per_row = 7680 * 4,
+		.buffer_index = 2, .buffer_count = 3, .render_time = 999.99f, .events_per_second = 99999,
+		.max_event_dispatch_time = 9.999f, .presentation_latency = 999.99f, .tearing = false,
+		.raw_pointer = true, .pointer_events = 999, .pointer_event_rate = 99999, .perf = &perf };
+	int32 panel_width = hudPanelWidth(&hud);
+	int32 panel_height = hudPanelHeight(&hud, HUD_TEXT_LINES);
+
+	Bitmap frame = { .memory = memory, .width = TEST_HUD_WIDTH, .height = TEST_HUD_HEIGHT,
+		.bytes_per_row = TEST_HUD_WIDTH * sizeof(uint32) };
+	hudFillRectangle(&frame, 0, 0, frame.width, frame.height, TEST_HUD_BACKGROUND);
+	hudDraw(&hud, &frame, &stats);
+	testCheck(&report, testCountOutside(&frame, HUD_MARGIN, HUD_MARGIN, panel_width,
+				panel_height, TEST_HUD_BACKGROUND) == 0, "text outside the panel");
+
+	// [EN] A layer wider than needed, its extra columns must stay transparent
+	// [ES] Una capa más ancha de lo necesario, sus columnas de más deben quedar transparentes
+	int32 layer_width, layer_height;
+	hudLayerSize(&hud, &layer_width, &layer_height);
+	testCheck(&report, layer_width + 64 <= TEST_HUD_WIDTH && layer_height <= TEST_HUD_HEIGHT,
+			"layer size");
+	Bitmap layer = { .memory = memory, .width = layer_width + 64, .height = layer_height,
+		.bytes_per_row = TEST_HUD_WIDTH * sizeof(uint32) };
+	HudLayerChanges changes = hudUpdateLayer(&hud, &stats);
+	testCheck(&report, changes.count == 1 && changes.areas[0].x == 0 && changes.areas[0].y == 0
+			&& changes.areas[0].width == layer_width && changes.areas[0].height == layer_height,
+			"first layer update changes it whole");
+	HudRectangle all = { 0, 0, layer.width, layer.height };
+	hudDrawLayer(&hud, &layer, &all, 1);
+	testCheck(&report, testCountOutside(&layer, HUD_MARGIN, HUD_MARGIN, panel_width,
+				panel_height, 0) == 0, "text outside the layer's panel");
+
+	// [EN] Two layers side by side, one kept up to date by areas and one redrawn whole
+	// [ES] Dos capas lado a lado, una actualizada por áreas y otra redibujada completa
+	Bitmap partial = { .memory = memory, .width = layer_width, .height = layer_height,
+		.bytes_per_row = TEST_HUD_WIDTH * sizeof(uint32) };
+	Bitmap whole = partial;
+	whole.memory = memory + (TEST_HUD_WIDTH / 2);
+	stats = (HudBufferStats){ .width = 1920, .height = 1080, .bytes_per_row = 1920 * 4,
+		.buffer_count = 3, .render_time = 3.21f, .events_per_second = 240,
+		.max_event_dispatch_time = 0.05f, .presentation_latency = 9.5f };
+	hudRecordFrameTime(&hud, 16.6f);
+	hudUpdateLayer(&hud, &stats);
+	all = (HudRectangle){ 0, 0, layer_width, layer_height };
+	hudDrawLayer(&hud, &partial, &all, 1);
+	stats.render_time = 3.25f;
+	stats.buffer_index = 1;
+	hudRecordFrameTime(&hud, 17.1f);
+	changes = hudUpdateLayer(&hud, &stats);
+	hudDrawLayer(&hud, &partial, changes.areas, changes.count);
+	hudFillRectangle(&whole, 0, 0, whole.width, whole.height, TEST_HUD_BACKGROUND);
+	hudDrawLayer(&hud, &whole, &all, 1);
+	int64 changed_pixels = 0;
+	for (int32 i = 0; i < changes.count; ++i) {
+		changed_pixels += (int64)changes.areas[i].width * changes.areas[i].height;
+	}
+	testCheck(&report, changes.count > 0 && changed_pixels < (int64)layer_width * layer_height / 4,
+			"changed areas are a small part of the layer");
+	testCheck(&report, testCountDifferent(&partial, &whole) == 0,
+			"redrawing the changed area equals a full redraw");
+
+	hudDestroy(&hud);
+	free(memory);
+	return testSummary(&report);
+}
+
+#if defined(__AVX2__)
+	#define TEST_SIMD "avx2"
+#elif defined(__SSE2__)
+	#define TEST_SIMD "sse2"
+#else
+	#define TEST_SIMD "scalar"
+#endif
+
+typedef struct {
+	atomic_uchar runs[TEST_JOB_COUNT];
+	atomic_int ranges_below_batch;
+	int32 min_batch_size;
+	atomic_bool first_done;
+	atomic_bool ran_early;
+} TestJobs;
+
+internal void testJobMark(void* context)
+{
+	atomic_uchar* run = context;
+	atomic_fetch_add(run, 1);
+}
+
+internal void testJobFirst(void* context)
+{
+	TestJobs* jobs = context;
+	atomic_store(&jobs->first_done, true);
+}
+
+internal void testJobSecond(void* context)
+{
+	TestJobs* jobs = context;
+	if (!atomic_load(&jobs->first_done)) {
+		atomic_store(&jobs->ran_early, true);
+	}
+}
+
+internal void testJobRange(void* context, int32 begin, int32 end)
+{
+	TestJobs* jobs = context;
+	if (end - begin < jobs->min_batch_size) {
+		atomic_fetch_add(&jobs->ranges_below_batch, 1);
+	}
+	for (int32 i = begin; i < end; ++i) {
+		atomic_fetch_add(&jobs->runs[i], 1);
+	}
+}
+
+/*
+ * [EN] Every job runs exactly once, a dependent job never before its dependency, and
+ * threadParallelFor() covers each index once with ranges of at least min_batch_size.
+ * [ES] Cada trabajo corre exactamente una vez, un trabajo dependiente nunca antes de su
+ * dependencia, y threadParallelFor() cubre cada índice una vez con rangos de al menos
+ * min_batch_size.
+ */
+internal int32 testJobs(void)
+{
+	TestReport report = { .name = "jobs" };
+	TestJobs* jobs = calloc(1, sizeof(TestJobs));
+	if (!jobs || !jobSystemStart(TEST_JOB_WORKERS, JOB_AFFINITY_NONE)) {
+		printf("FAIL jobs: can't start\n");
+		free(jobs);
+		return 1;
+	}
+
+	for (int32 batch = 0; batch < TEST_JOB_COUNT; batch += TEST_JOB_BATCH) {
+		JobCounter counter = { 0 };
+		for (int32 i = batch; i < batch + TEST_JOB_BATCH; ++i) {
+			jobRun(testJobMark, &jobs->runs[i], &counter);
+		}
+		jobWait(&counter);
+	}
+	int32 wrong_runs = 0;
+	for (int32 i = 0; i < TEST_JOB_COUNT; ++i) {
+		wrong_runs += atomic_load(&jobs->runs[i]) != 1;
+		atomic_store(&jobs->runs[i], 0);
+	}
+	testCheck(&report, wrong_runs == 0, "every job once");
+
+	for (int32 i = 0; i < TEST_JOB_BATCH; ++i) {
+		JobCounter first = { 0 };
+		JobCounter second = { 0 };
+		atomic_store(&jobs->first_done, false);
+		jobRun(testJobFirst, jobs, &first);
+		jobRunAfter(testJobSecond, jobs, &second, &first);
+		jobWait(&second);
+		jobWait(&first);
+	}
+	testCheck(&report, !atomic_load(&jobs->ran_early), "dependency order");
+
+	// [EN] Counts that don't split evenly in batches | [ES] Conteos que no se dividen parejo
+	for (int32 min_batch_size = 1; min_batch_size <= 64; min_batch_size += 7) {
+		for (int32 count = 1; count <= TEST_PARALLEL_FOR_COUNT; count += 37) {
+			jobs->min_batch_size = (count < min_batch_size) ? count : min_batch_size;
+			threadParallelFor(count, min_batch_size, testJobRange, jobs);
+			for (int32 i = 0; i < count; ++i) {
+				wrong_runs += atomic_load(&jobs->runs[i]) != 1;
+				atomic_store(&jobs->runs[i], 0);
+			}
+		}
+	}
+	testCheck(&report, wrong_runs == 0, "parallel for covers each index once");
+	testCheck(&report, atomic_load(&jobs->ranges_below_batch) == 0,
+			"parallel for ranges of at least min_batch_size");
+
+	jobSystemStop();
+	free(jobs);
+	return testSummary(&report);
+}
+
+/*
+ * [EN] Hashed pixels every SIMD path reads the same way, the goldens below come from it.
+ * [ES] Píxeles con hash que cada ruta SIMD lee igual, las referencias de abajo vienen de ellos.
+ */
+internal void testFillPattern(Bitmap* bitmap, uint32 seed)
+{
+	for (int32 row = 0; row < bitmap->height; ++row) {
+		uint32* pxl = (uint32*)((uint8*)bitmap->memory + ((int64)row * bitmap->bytes_per_row));
+		for (int32 col = 0; col < bitmap->width; ++col) {
+			uint32 value = ((uint32)col * 0x9E37'79B1u) ^ ((uint32)row * 0x85EB'CA77u) ^ seed;
+			value ^= value >> 15;
+			value *= 0x2C1B'3C6Du;
+			value ^= value >> 13;
+			pxl[col] = value;
+		}
+	}
+}
+
+typedef bool8 TestScaleFunction(Bitmap* destination, const Bitmap* source);
+
+internal bool8 testScaleBoxHalf(Bitmap* destination, const Bitmap* source)
+{
+	scaleBoxHalf(destination, source);
+	return true;
+}
+
+typedef struct {
+	const char* name;
+	TestScaleFunction* function;
+	int32 width;
+	int32 height;
+	uint64 hash;
+} TestScaleGolden;
+
+/*
+ * [EN] Goldens from a separate reimplementation of the scalar formulas, not from this code. The
+ * same size as the source must return it unchanged, its hash is the source's. The 411x233 cases
+ * are large enough to be split across the job system's threads.
+ * [ES] Referencias de una reimplementación aparte de las fórmulas escalares, no de este código. El
+ * mismo tamaño que el origen debe regresarlo sin cambios, su hash es el del origen. Los casos de
+ * 411x233 son lo bastante grandes para dividirse entre los hilos del sistema de trabajos.
+ */
+global_variable const TestScaleGolden test_scale_goldens[] = {
+	{ "nearest up", scaleNearest, 411, 233, 0x8af3'c861'b5cb'409cull },
+	{ "nearest down", scaleNearest, 61, 37, 0x408a'ce4d'3f72'ba05ull },
+	{ "nearest same", scaleNearest, 173, 97, 0x15e9'c8e4'8a79'e5c1ull },
+	{ "bilinear up", scaleBilinear, 411, 233, 0x8e26'493f'8d6c'2361ull },
+	{ "bilinear down", scaleBilinear, 61, 37, 0xc2e3'bfa7'83b8'9ad4ull },
+	{ "bilinear same", scaleBilinear, 173, 97, 0x15e9'c8e4'8a79'e5c1ull },
+	{ "box up", scaleBox, 411, 233, 0x7aac'f09e'dea5'0148ull },
+	{ "box down", scaleBox, 61, 37, 0xff7b'3922'7d09'f656ull },
+	{ "box same", scaleBox, 173, 97, 0x15e9'c8e4'8a79'e5c1ull },
+	{ "box half", testScaleBoxHalf, 87, 49, 0x4564'07a3'bebf'1a41ull },
+};
+
+internal int32 testScale(void)
+{
+	TestReport report = { .name = "scale " TEST_SIMD };
+	Bitmap source = { .width = TEST_SCALE_WIDTH, .height = TEST_SCALE_HEIGHT,
+		.bytes_per_row = TEST_SCALE_WIDTH * sizeof(uint32) };
+	source.memory = malloc((uint64)source.bytes_per_row * source.height);
+	uint32* destination_memory = malloc(411ull * 233 * sizeof(uint32));
+	if (!source.memory || !destination_memory || !jobSystemStart(TEST_JOB_WORKERS,
+				JOB_AFFINITY_NONE)) {
+		printf("FAIL scale: can't start\n");
+		free(source.memory);
+		free(destination_memory);
+		return 1;
+	}
+	testFillPattern(&source, 0);
+	testCheck(&report, testHashBitmap(&source) == 0x15e9'c8e4'8a79'e5c1ull, "source pattern");
+
+	for (uint64 i = 0; i < sizeof(test_scale_goldens) / sizeof(test_scale_goldens[0]); ++i) {
+		const TestScaleGolden* golden = &test_scale_goldens[i];
+		Bitmap destination = { .memory = destination_memory, .width = golden->width,
+			.height = golden->height, .bytes_per_row = golden->width * sizeof(uint32) };
+		bool8 scaled = golden->function(&destination, &source);
+		testCheck(&report, scaled && testHashBitmap(&destination) == golden->hash, golden->name);
+	}
+
+	jobSystemStop();
+	free(source.memory);
+	free(destination_memory);
+	return testSummary(&report);
+}
+
+internal RasterVertex testRasterVertex(float32 x, float32 y)
+{
+	float32 half_size = TEST_RASTER_SIZE / 2.0f;
+	return (RasterVertex){ .x = (x / half_size) - 1.0f, .y = 1.0f - (y / half_size), .z = 0,
+		.w = 1.0f, .r = 1.0f, .g = 1.0f, .b = 1.0f };
+}
+
+/*
+ * [EN] A grid of cells split in two triangles, alternating diagonals and windings, drawn one
+ * triangle at a time. Inner vertices sit on pixel centers (jitter 0, edges cross many centers
+ * exactly) or off the pixel grid; either way every pixel of the grid must be covered once and
+ * nothing outside it.
+ * [ES] Una rejilla de celdas partidas en dos triángulos, alternando diagonales y sentidos de giro,
+ * dibujada un triángulo a la vez. Los vértices interiores están en centros de píxel (jitter 0, las
+ * aristas cruzan muchos centros exactamente) o fuera de la rejilla de píxeles; en ambos casos cada
+ * píxel de la rejilla debe cubrirse una vez y nada fuera de ella.
+ */
+internal int32 testRasterMesh(TestReport* report, uint8* coverage, Bitmap* target,
+		DepthBuffer* depth, float32 jitter)
+{
+	enum { POINTS = TEST_RASTER_CELLS + 1 };
+	float32 xs[POINTS][POINTS], ys[POINTS][POINTS];
+	for (int32 j = 0; j < POINTS; ++j) {
+		for (int32 i = 0; i < POINTS; ++i) {
+			xs[j][i] = (float32)(TEST_RASTER_ORIGIN + (i * TEST_RASTER_CELL_SIZE));
+			ys[j][i] = (float32)(TEST_RASTER_ORIGIN + (j * TEST_RASTER_CELL_SIZE));
+			if (i > 0 && j > 0 && i < POINTS - 1 && j < POINTS - 1) { // borders stay straight
+				xs[j][i] += 0.5f + (jitter * (float32)((i * 7 + j * 3) % 5 - 2));
+				ys[j][i] += 0.5f + (jitter * (float32)((i * 2 + j * 5) % 5 - 2));
+			}
+		}
+	}
+	memset(coverage, 0, TEST_RASTER_SIZE * TEST_RASTER_SIZE);
+	int32 drawn = 0;
+	for (int32 j = 0; j < TEST_RASTER_CELLS; ++j) {
+		for (int32 i = 0; i < TEST_RASTER_CELLS; ++i) {
+			RasterVertex a = testRasterVertex(xs[j][i], ys[j][i]);
+			RasterVertex b = testRasterVertex(xs[j][i + 1], ys[j][i + 1]);
+			RasterVertex c = testRasterVertex(xs[j + 1][i + 1], ys[j + 1][i + 1]);
+			RasterVertex d = testRasterVertex(xs[j + 1][i], ys[j + 1][i]);
+			RasterVertex triangles[2][3] = { { a, b, c }, { a, c, d } };
+			if ((i + j) % 2) {
+				triangles[0][0] = b, triangles[0][1] = d, triangles[0][2] = a;
+				triangles[1][0] = b, triangles[1][1] = c, triangles[1][2] = d;
+			}
+			for (int32 t = 0; t < 2; ++t) {
+				memset(target->memory, 0, (uint64)target->bytes_per_row * target->height);
+				rasterClearDepth(depth);
+				drawn += rasterDrawTriangles(target, depth, triangles[t], 3);
+				for (int32 p = 0; p < TEST_RASTER_SIZE * TEST_RASTER_SIZE; ++p) {
+					coverage[p] += ((uint32*)target->memory)[p] != 0;
+				}
+			}
+		}
+	}
+
+	int32 wrong_pixels = 0;
+	int32 grid_end = TEST_RASTER_ORIGIN + (TEST_RASTER_CELLS * TEST_RASTER_CELL_SIZE);
+	for (int32 row = 0; row < TEST_RASTER_SIZE; ++row) {
+		for (int32 col = 0; col < TEST_RASTER_SIZE; ++col) {
+			bool8 in_grid = col >= TEST_RASTER_ORIGIN && col < grid_end
+				&& row >= TEST_RASTER_ORIGIN && row < grid_end;
+			wrong_pixels += coverage[(row * TEST_RASTER_SIZE) + col] != (in_grid ? 1 : 0);
+		}
+	}
+	if (wrong_pixels > 0) {
+		printf("  %d pixels not covered once, jitter %.4f\n", wrong_pixels, jitter);
+	}
+	testCheck(report, drawn == 2 * TEST_RASTER_CELLS * TEST_RASTER_CELLS, "mesh drawn");
+	return wrong_pixels;
+}
+
+internal int32 testRaster(void)
+{
+	TestReport report = { .name = "raster " TEST_SIMD };
+	uint32* pixels = malloc(TEST_RASTER_SIZE * TEST_RASTER_SIZE * sizeof(uint32));
+	float32* depths = malloc(TEST_RASTER_SIZE * TEST_RASTER_SIZE * sizeof(float32));
+	uint8* coverage = malloc(TEST_RASTER_SIZE * TEST_RASTER_SIZE);
+	if (!pixels || !depths || !coverage) {
+		printf("FAIL raster: out of memory\n");
+		free(pixels);
+		free(depths);
+		free(coverage);
+		return 1;
+	}
+	Bitmap target = { .memory = pixels, .width = TEST_RASTER_SIZE, .height = TEST_RASTER_SIZE,
+		.bytes_per_row = TEST_RASTER_SIZE * sizeof(uint32) };
+	DepthBuffer depth = { .memory = depths, .width = TEST_RASTER_SIZE,
+		.height = TEST_RASTER_SIZE };
+
+	testCheck(&report, testRasterMesh(&report, coverage, &target, &depth, 0) == 0,
+			"shared edges through pixel centers");
+	testCheck(&report, testRasterMesh(&report, coverage, &target, &depth, 0.5f) == 0,
+			"vertices on pixel corners");
+	testCheck(&report, testRasterMesh(&report, coverage, &target, &depth, 0.3671875f) == 0,
+			"vertices off the pixel grid");
+
+	free(pixels);
+	free(depths);
+	free(coverage);
+	return testSummary(&report);
+}
+
+/*
+ * [EN] Uniform in [-100, 100), rounded the way the goldens' generator rounds it.
+ * [ES] Uniforme en [-100, 100), redondeado como lo redondea el generador de las referencias.
+ */
+internal float32 testRandomFloat(uint32* state)
+{
+	*state ^= *state << 13; // xorshift32
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	float32 unit = (float32)(*state >> 8) * 0x1p-24f;
+	return (unit * 200.0f) - 100.0f;
+}
+
+internal bool8 testSameBits(const void* a, const void* b, uint64 size)
+{
+	return memcmp(a, b, size) == 0;
+}
+
+/*
+ * [EN] Every batch function against its single element counterpart, bit for bit, and hashes of the
+ * batch outputs against goldens from a float32 reimplementation of the documented operation
+ * order, which every build (scalar, SSE2, AVX) must match. The matrix entries are dyadic so they
+ * are exact in both. Block 0 lane 3 is a zero vector, normalizing keeps it.
+ * [ES] Cada función por lotes contra su equivalente de un elemento, bit por bit, y los hashes de
+ * las salidas por lotes contra referencias de una reimplementación en float32 del orden de
+ * operaciones documentado, que cada compilación (escalar, SSE2, AVX) debe igualar. Las entradas de
+ * la matriz son diádicas así que son exactas en ambas. El bloque 0 carril 3 es un vector cero,
+ * normalizarlo lo conserva.
+ */
+internal int32 testMath(void)
+{
+	TestReport report = { .name = "math " TEST_SIMD };
+	Vec3x8* points = malloc(sizeof(Vec3x8) * TEST_MATH_BLOCKS);
+	Vec4x8* points_out = malloc(sizeof(Vec4x8) * TEST_MATH_BLOCKS);
+	Vec3x8* vectors_out = malloc(sizeof(Vec3x8) * TEST_MATH_BLOCKS);
+	Vec4* vec4s = malloc(sizeof(Vec4) * TEST_MATH_VECTORS);
+	Vec4* vec4s_out = malloc(sizeof(Vec4) * TEST_MATH_VECTORS);
+	if (!points || !points_out || !vectors_out || !vec4s || !vec4s_out) {
+		printf("FAIL math: out of memory\n");
+		free(points);
+		free(points_out);
+		free(vectors_out);
+		free(vec4s);
+		free(vec4s_out);
+		return 1;
+	}
+	Mat4 m = { .columns = { { 0.75f, -0.375f, 0.5f, 0.0625f }, { 0.5f, 0.625f, -0.25f, -0.125f },
+		{ -0.25f, 0.5f, 0.8125f, 0.03125f }, { 12.5f, -3.25f, 7.0f, 1.0f } } };
+	Mat3 m3 = mat3FromMat4(&m);
+	uint32 random = 0x2545'F491u;
+	for (int32 block = 0; block < TEST_MATH_BLOCKS; ++block) {
+		for (int32 lane = 0; lane < VECTOR_MATH_BLOCK_LANES; ++lane) {
+			points[block].x[lane] = testRandomFloat(&random);
+			points[block].y[lane] = testRandomFloat(&random);
+			points[block].z[lane] = testRandomFloat(&random);
+		}
+	}
+	points[0].x[3] = points[0].y[3] = points[0].z[3] = 0;
+	random = 0x9E37'79B9u;
+	for (int32 i = 0; i < TEST_MATH_VECTORS; ++i) {
+		vec4s[i].x = testRandomFloat(&random);
+		vec4s[i].y = testRandomFloat(&random);
+		vec4s[i].z = testRandomFloat(&random);
+		vec4s[i].w = testRandomFloat(&random);
+	}
+
+	int32 mismatches = 0;
+	mat4TransformPointsWide(&m, points, points_out, TEST_MATH_BLOCKS);
+	for (int32 i = 0; i < TEST_MATH_BLOCKS * VECTOR_MATH_BLOCK_LANES; ++i) {
+		const Vec3x8* in = &points[i / VECTOR_MATH_BLOCK_LANES];
+		const Vec4x8* out = &points_out[i / VECTOR_MATH_BLOCK_LANES];
+		int32 lane = i % VECTOR_MATH_BLOCK_LANES;
+		Vec4 single = mat4TransformPoint(&m, (Vec3){ in->x[lane], in->y[lane], in->z[lane] });
+		Vec4 wide = { out->x[lane], out->y[lane], out->z[lane], out->w[lane] };
+		mismatches += !testSameBits(&single, &wide, sizeof(Vec4));
+	}
+	testCheck(&report, mismatches == 0, "mat4TransformPointsWide() bits");
+	testCheck(&report, testHashBytes(TEST_HASH_SEED, points_out, sizeof(Vec4x8) * TEST_MATH_BLOCKS)
+			== 0xfff3'943f'd858'6d33ull, "mat4TransformPointsWide() golden");
+
+	mismatches = 0;
+	mat3TransformVec3sWide(&m3, points, vectors_out, TEST_MATH_BLOCKS);
+	for (int32 i = 0; i < TEST_MATH_BLOCKS * VECTOR_MATH_BLOCK_LANES; ++i) {
+		const Vec3x8* in = &points[i / VECTOR_MATH_BLOCK_LANES];
+		const Vec3x8* out = &vectors_out[i / VECTOR_MATH_BLOCK_LANES];
+		int32 lane = i % VECTOR_MATH_BLOCK_LANES;
+		Vec3 single = mat3TransformVec3(&m3, (Vec3){ in->x[lane], in->y[lane], in->z[lane] });
+		Vec3 wide = { out->x[lane], out->y[lane], out->z[lane] };
+		mismatches += !testSameBits(&single, &wide, sizeof(Vec3));
+	}
+	testCheck(&report, mismatches == 0, "mat3TransformVec3sWide() bits");
+	testCheck(&report, testHashBytes(TEST_HASH_SEED, vectors_out, sizeof(Vec3x8) * TEST_MATH_BLOCKS)
+			== 0x92b1'81f7'b57c'05faull, "mat3TransformVec3sWide() golden");
+
+	mismatches = 0;
+	vec3NormalizeWide(points, vectors_out, TEST_MATH_BLOCKS);
+	for (int32 i = 0; i < TEST_MATH_BLOCKS * VECTOR_MATH_BLOCK_LANES; ++i) {
+		const Vec3x8* in = &points[i / VECTOR_MATH_BLOCK_LANES];
+		const Vec3x8* out = &vectors_out[i / VECTOR_MATH_BLOCK_LANES];
+		int32 lane = i % VECTOR_MATH_BLOCK_LANES;
+		Vec3 single = vec3Normalize((Vec3){ in->x[lane], in->y[lane], in->z[lane] });
+		Vec3 wide = { out->x[lane], out->y[lane], out->z[lane] };
+		mismatches += !testSameBits(&single, &wide, sizeof(Vec3));
+	}
+	testCheck(&report, mismatches == 0, "vec3NormalizeWide() bits");
+	testCheck(&report, testHashBytes(TEST_HASH_SEED, vectors_out, sizeof(Vec3x8) * TEST_MATH_BLOCKS)
+			== 0xa9da'e00c'20d2'd699ull, "vec3NormalizeWide() golden");
+
+	mismatches = 0;
+	mat4TransformVec4s(&m, vec4s, vec4s_out, TEST_MATH_VECTORS);
+	for (int32 i = 0; i < TEST_MATH_VECTORS; ++i) {
+		Vec4 single = mat4TransformVec4(&m, vec4s[i]);
+		mismatches += !testSameBits(&single, &vec4s_out[i], sizeof(Vec4));
+	}
+	testCheck(&report, mismatches == 0, "mat4TransformVec4s() bits");
+	testCheck(&report, testHashBytes(TEST_HASH_SEED, vec4s_out, sizeof(Vec4) * TEST_MATH_VECTORS)
+			== 0xc575'30b9'fefb'b55dull, "mat4TransformVec4s() golden");
+
+	// [EN] A product is the transform of each column | [ES] Un producto transforma cada columna
+	Mat4 n = { .columns = { vec4s[0], vec4s[1], vec4s[2], vec4s[3] } };
+	Mat4 product = mat4Multiply(&m, &n);
+	mismatches = 0;
+	for (int32 i = 0; i < 4; ++i) {
+		Vec4 column = mat4TransformVec4(&m, n.columns[i]);
+		mismatches += !testSameBits(&column, &product.columns[i], sizeof(Vec4));
+	}
+	testCheck(&report, mismatches == 0, "mat4Multiply() bits");
+
+	free(points);
+	free(points_out);
+	free(vectors_out);
+	free(vec4s);
+	free(vec4s_out);
+	return testSummary(&report);
+}
+
+typedef struct {
+	const char* name;
+	NoiseType type;
+	uint64 hash;
+} TestNoiseGolden;
+
+/*
+ * [EN] Goldens from a separate float32 reimplementation of the kernels, not from this code: 3
+ * octaves, seed 0xC0FFEE, frequency 0.0731 and offsets (-70.3, -20.7), so lattice coordinates
+ * cross zero and the offsets round.
+ * [ES] Referencias de una reimplementación aparte de los núcleos en float32, no de este código: 3
+ * octavas, semilla 0xC0FFEE, frecuencia 0.0731 y desplazamientos (-70.3, -20.7), así las
+ * coordenadas de la retícula cruzan el cero y los desplazamientos redondean.
+ */
+global_variable const TestNoiseGolden test_noise_goldens[] = {
+	{ "value noise", NOISE_VALUE, 0x806b'e478'fa44'e708ull },
+	{ "perlin noise", NOISE_PERLIN, 0x31fc'b843'a078'9c23ull },
+	{ "simplex noise", NOISE_SIMPLEX, 0xda75'a178'f697'5d85ull },
+};
+
+/*
+ * [EN] Both generators against goldens from a separate reimplementation, then every noise type
+ * filled on the job system and on the calling thread, and each pixel of a one octave fill against
+ * noiseSample(). The same goldens in the scalar, SSE2 and AVX2 builds mean the paths agree.
+ * [ES] Ambos generadores contra referencias de una reimplementación aparte, luego cada tipo de
+ * ruido llenado en el sistema de trabajos y en el hilo que llama, y cada píxel de un relleno de
+ * una octava contra noiseSample(). Las mismas referencias en las compilaciones escalar, SSE2 y
+ * AVX2 significan que las rutas coinciden.
+ */
+internal int32 testNoise(void)
+{
+	TestReport report = { .name = "noise " TEST_SIMD };
+	uint32 numbers[TEST_RANDOM_WIDE_COUNT + 2 * RANDOM_WIDE_LANES];
+	float32 floats[TEST_RANDOM_WIDE_COUNT];
+	Bitmap target = { .width = TEST_NOISE_SIZE, .height = TEST_NOISE_SIZE,
+		.bytes_per_row = TEST_NOISE_SIZE * sizeof(uint32) };
+	target.memory = malloc((uint64)target.bytes_per_row * target.height);
+	if (!target.memory) {
+		printf("FAIL noise: out of memory\n");
+		return 1;
+	}
+
+	Random random;
+	randomSeed(&random, TEST_RANDOM_SEED);
+	uint64 hash = TEST_HASH_SEED;
+	for (int32 i = 0; i < TEST_RANDOM_COUNT; ++i) {
+		uint64 number = randomNext(&random);
+		hash = testHashBytes(hash, &number, sizeof(number));
+	}
+	testCheck(&report, hash == 0xc089'6b73'f0e5'22e6ull, "randomNext() golden");
+
+	// [EN] The ragged fill must advance every lane | [ES] El relleno incompleto avanza cada carril
+	RandomWide wide;
+	randomWideSeed(&wide, TEST_RANDOM_SEED);
+	randomWideFill(&wide, numbers, TEST_RANDOM_WIDE_COUNT);
+	randomWideFill(&wide, &numbers[TEST_RANDOM_WIDE_COUNT], 2 * RANDOM_WIDE_LANES);
+	testCheck(&report, testHashBytes(TEST_HASH_SEED, numbers, sizeof(numbers))
+			== 0xf0d7'f298'cdee'8c40ull, "randomWideFill() golden");
+	randomWideSeed(&wide, TEST_RANDOM_SEED);
+	randomWideFillFloat32(&wide, floats, TEST_RANDOM_WIDE_COUNT);
+	int32 mismatches = 0;
+	for (int32 i = 0; i < TEST_RANDOM_WIDE_COUNT; ++i) {
+		mismatches += floats[i] != (float32)(numbers[i] >> 8) * 0x1p-24f;
+	}
+	testCheck(&report, mismatches == 0, "randomWideFillFloat32() follows randomWideFill()");
+
+	NoiseParameters parameters = { .seed = 0xC0FFEE, .frequency = 0.0731f, .offset_x = -70.3f,
+		.offset_y = -20.7f, .octaves = 3 };
+	for (uint64 i = 0; i < sizeof(test_noise_goldens) / sizeof(test_noise_goldens[0]); ++i) {
+		parameters.type = test_noise_goldens[i].type;
+		bool8 started = jobSystemStart(TEST_JOB_WORKERS, JOB_AFFINITY_NONE);
+		noiseFill(&target, &parameters);
+		uint64 threaded = testHashBitmap(&target);
+		if (started) {
+			jobSystemStop();
+		}
+		noiseFill(&target, &parameters);
+		testCheck(&report, started && threaded == test_noise_goldens[i].hash
+				&& testHashBitmap(&target) == threaded, test_noise_goldens[i].name);
+	}
+
+	parameters.octaves = 1;
+	for (uint64 i = 0; i < sizeof(test_noise_goldens) / sizeof(test_noise_goldens[0]); ++i) {
+		parameters.type = test_noise_goldens[i].type;
+		noiseFill(&target, &parameters);
+		mismatches = 0;
+		for (int32 row = 0; row < target.height; ++row) {
+			const uint32* pxl = (const uint32*)((uint8*)target.memory
+					+ ((int64)row * target.bytes_per_row));
+			float32 y = ((float32)row + parameters.offset_y) * parameters.frequency;
+			for (int32 col = 0; col < target.width; ++col) {
+				float32 x = ((float32)col + parameters.offset_x) * parameters.frequency;
+				float32 sample = noiseSample(parameters.type, parameters.seed, x, y);
+				mismatches += (pxl[col] & 0xffu) != (uint32)((sample * 255.0f) + 0.5f);
+			}
+		}
+		testCheck(&report, mismatches == 0, "noiseSample() matches noiseFill()");
+	}
+
+	free(target.memory);
+	return testSummary(&report);
+}
+
+typedef struct {
+	int32 speed;
+	int32 offset;
+	int32 previous_offset;
+} TestReplayState;
+
+internal float32 testReplayStep(TestReplayState* state, int32 ticks, float32 interpolation)
+{
+	for (int32 tick = 0; tick < ticks; ++tick) {
+		state->previous_offset = state->offset;
+		state->offset += state->speed;
+	}
+	return (float32)state->previous_offset
+		+ ((float32)(state->offset - state->previous_offset) * interpolation);
+}
+
+/*
+ * [EN] Records a session the way the platform does, a FixedTimestep on a clock that jitters and
+ * stalls, with axis events that set the speed, a relative motion, an INPUT_EVENT_FRAME after the
+ * input of each step. Replaying it by frame, with no clock at all, must render the same value at
+ * every step and rebuild the device time of every motion; by time the markers never reach the
+ * caller.
+ * [ES] Graba una sesión como lo hace la plataforma, un FixedTimestep sobre un reloj que varía y se
+ * detiene, con eventos de eje que fijan la velocidad, un movimiento relativo, un INPUT_EVENT_FRAME
+ * después de la entrada de cada paso. Repetirla por fotograma, sin ningún reloj, debe dibujar el
+ * mismo valor en cada paso y reconstruir el tiempo del dispositivo de cada movimiento; por tiempo
+ * los marcadores nunca llegan a quien llama.
+ */
+internal int32 testReplay(void)
+{
+	TestReport report = { .name = "replay" };
+	uint64 size = sizeof(InputLogHeader) + (sizeof(InputEvent) * TEST_REPLAY_EVENTS);
+	uint8* memory = calloc(1, size);
+	float32* rendered = malloc(sizeof(float32) * TEST_REPLAY_STEPS);
+	uint64* motion_times = malloc(sizeof(uint64) * TEST_REPLAY_STEPS);
+	if (!memory || !rendered || !motion_times) {
+		printf("FAIL replay: out of memory\n");
+		return 1;
+	}
+	*(InputLogHeader*)memory = (InputLogHeader){ .magic = INPUT_LOG_MAGIC,
+		.version = INPUT_LOG_VERSION, .event_size = sizeof(InputEvent) };
+	InputEvent* events = (InputEvent*)(memory + sizeof(InputLogHeader));
+
+	FixedTimestep timestep;
+	fixedTimestepInitialize(&timestep, SIMULATION_TICK_RATE, 0);
+	TestReplayState state = { 0 };
+	uint32 random = 0x5EED'1234u;
+	uint64 now = 0;
+	int32 count = 0;
+	int32 input_count = 0;
+	for (int32 step = 0; step < TEST_REPLAY_STEPS; ++step) {
+		float32 jitter = testRandomFloat(&random); // [-100, 100)
+		now += 16'666'667ull + (uint64)(int64)(jitter * 40'000.0f);
+		now += (step % 97 == 0) ? 70'000'000ull : 0; // a stall | una pausa
+		for (int32 i = (int32)(testRandomFloat(&random) + 100.0f) % 4; i > 0; --i) {
+			int32 speed = (int32)testRandomFloat(&random) / 10;
+			events[count++] = (InputEvent){ .frame = (uint32)step,
+				.time = (uint32)(now / NANOSECONDS_PER_MILLISECOND), .x = speed,
+				.type = INPUT_EVENT_POINTER_AXIS };
+			state.speed = speed;
+			input_count++;
+		}
+		motion_times[step] = TEST_REPLAY_DEVICE_TIME + (now / 1000);
+		events[count] = (InputEvent){ .frame = (uint32)step,
+			.time = (uint32)(now / NANOSECONDS_PER_MILLISECOND), .x = step,
+			.type = INPUT_EVENT_RELATIVE_MOTION };
+		inputEventSetRelativeTime(&events[count++], motion_times[step]);
+		events[count++] = (InputEvent){ .frame = (uint32)step,
+			.time = (uint32)(now / NANOSECONDS_PER_MILLISECOND), .x = -step,
+			.type = INPUT_EVENT_RELATIVE_MOTION_UNACCELERATED };
+		input_count += 2;
+		int32 ticks = fixedTimestepAdvance(&timestep, now);
+		float32 interpolation = fixedTimestepAlpha(&timestep);
+		events[count] = (InputEvent){ .frame = (uint32)step,
+			.time = (uint32)(now / NANOSECONDS_PER_MILLISECOND), .x = ticks,
+			.type = INPUT_EVENT_FRAME };
+		memcpy(&events[count++].y, &interpolation, sizeof(interpolation));
+		rendered[step] = testReplayStep(&state, ticks, interpolation);
+	}
+	size = sizeof(InputLogHeader) + (sizeof(InputEvent) * (uint64)count);
+	testCheck(&report, inputLogValidate(memory, size), "the recorded log is valid");
+
+	InputReplay replay = { .events = events, .event_count = (uint64)count,
+		.mode = INPUT_REPLAY_BY_FRAME };
+	state = (TestReplayState){ 0 };
+	int32 mismatches = 0;
+	int32 motion_mismatches = 0;
+	uint64 motion_time = TEST_REPLAY_DEVICE_TIME - 1; // any earlier time | cualquier tiempo previo
+	int32 step = 0;
+	while (!inputReplayFinished(&replay) && step < TEST_REPLAY_STEPS) {
+		const InputEvent* event;
+		const InputEvent* accelerated = nullptr;
+		while ((event = inputReplayNext(&replay, 0))) {
+			if (event->type == INPUT_EVENT_RELATIVE_MOTION) {
+				accelerated = event;
+				motion_time = inputEventRelativeTime(event, motion_time);
+				motion_mismatches += motion_time != motion_times[step] || event->x != step;
+			} else if (event->type == INPUT_EVENT_RELATIVE_MOTION_UNACCELERATED) {
+				motion_mismatches += !accelerated || event->x != -step;
+			} else {
+				state.speed = event->x;
+			}
+		}
+		int32 ticks = 0;
+		float32 interpolation = 0;
+		if (!inputReplayTakeFrame(&replay, &ticks, &interpolation)) {
+			break;
+		}
+		float32 value = testReplayStep(&state, ticks, interpolation);
+		mismatches += !testSameBits(&value, &rendered[step++], sizeof(value));
+	}
+	testCheck(&report, step == TEST_REPLAY_STEPS && inputReplayFinished(&replay),
+			"a replay by frame takes every step");
+	testCheck(&report, mismatches == 0, "a replay by frame renders the recorded values");
+	testCheck(&report, motion_mismatches == 0 && motion_time >> 24 != TEST_REPLAY_DEVICE_TIME >> 24,
+			"relative motions come back in pairs with their device time, across 24 bit wraps");
+
+	replay = (InputReplay){ .events = events, .event_count = (uint64)count,
+		.mode = INPUT_REPLAY_BY_TIME };
+	int32 returned = 0;
+	bool8 markers = false;
+	const InputEvent* event;
+	while ((event = inputReplayNext(&replay, UINT32_MAX))) {
+		markers |= event->type == INPUT_EVENT_FRAME;
+		returned++;
+	}
+	int32 ticks = 0;
+	float32 interpolation = 0;
+	testCheck(&report, returned == input_count && !markers && inputReplayFinished(&replay)
+			&& !inputReplayTakeFrame(&replay, &ticks, &interpolation),
+			"a replay by time returns every input event and no marker");
+
+	free(motion_times);
+	free(rendered);
+	free(memory);
+	return testSummary(&report);
+}
+
+/*
+ * [EN] Where the first run of pages free in used that holds pages starts, -1 when none does.
+ * [ES] Dónde empieza la primera serie de páginas libres en used que contiene pages, -1 si ninguna.
+ */
+internal int32 testShmFirstFit(const bool8* used, int32 pages)
+{
+	int32 run = 0;
+	for (int32 page = 0; page < TEST_SHM_PAGES; ++page) {
+		run = used[page] ? 0 : run + 1;
+		if (run == pages) {
+			return page - pages + 1;
+		}
+	}
+	return -1;
+}
+
+internal bool8 testShmWellFormed(const ShmBlocks* blocks)
+{
+	int32 end = 0;
+	for (int32 i = 0; i < blocks->count; ++i) {
+		const ShmBlock* block = &blocks->blocks[i];
+		if (block->offset < end || block->offset % SHM_BLOCKS_ALIGNMENT != 0
+				|| block->size <= 0 || block->size % SHM_BLOCKS_ALIGNMENT != 0) {
+			return false;
+		}
+		end = block->offset + block->size;
+	}
+	return end <= blocks->max_size;
+}
+
+/*
+ * [EN] Hand picked cases first, then random allocations and frees checked against a page map:
+ * each block must land on the first run of free pages that holds it.
+ * [ES] Primero casos elegidos a mano, luego reservas y liberaciones aleatorias comparadas con un
+ * mapa de páginas: cada bloque debe caer en la primera serie de páginas libres que lo contenga.
+ */
+internal int32 testShm(void)
+{
+	TestReport report = { .name = "shm" };
+	const int32 page = SHM_BLOCKS_ALIGNMENT;
+	ShmBlocks blocks = { .size = 4 * page, .max_size = TEST_SHM_PAGES * page };
+	int32 a = -1;
+	int32 b = -1;
+	int32 c = -1;
+	int32 d = -1;
+	testCheck(&report, shmBlocksAllocate(&blocks, 1, &a) && a == 0
+			&& blocks.blocks[0].size == page, "a block is rounded up to the alignment");
+	testCheck(&report, shmBlocksAllocate(&blocks, page + 1, &b) && b == page
+			&& shmBlocksAllocate(&blocks, page, &c) && c == 3 * page,
+			"blocks follow each other");
+	testCheck(&report, shmBlocksEnd(&blocks) == 4 * page
+			&& shmBlocksGrowSize(&blocks, shmBlocksEnd(&blocks)) == 4 * page,
+			"an arena that holds its blocks doesn't grow");
+	shmBlocksFree(&blocks, b);
+	testCheck(&report, shmBlocksAllocate(&blocks, page, &b) && b == page,
+			"a block takes the first gap that fits");
+	testCheck(&report, shmBlocksAllocate(&blocks, 2 * page, &d) && d == 4 * page,
+			"a block skips a gap too small");
+	testCheck(&report, shmBlocksGrowSize(&blocks, shmBlocksEnd(&blocks)) == 8 * page,
+			"the arena doubles to hold a block past its end");
+	shmBlocksFree(&blocks, a);
+	shmBlocksFree(&blocks, b);
+	testCheck(&report, shmBlocksAllocate(&blocks, 3 * page, &a) && a == 0,
+			"freed neighbours merge into one gap");
+	testCheck(&report, !shmBlocksAllocate(&blocks, TEST_SHM_PAGES * page, &b)
+			&& !shmBlocksAllocate(&blocks, 0, &b) && blocks.count == 3,
+			"a block past max_size or empty fails and changes nothing");
+	blocks.size = (TEST_SHM_PAGES / 2) * page;
+	testCheck(&report, shmBlocksGrowSize(&blocks, (TEST_SHM_PAGES - 1) * page)
+			== TEST_SHM_PAGES * page, "growth stops at max_size");
+
+	blocks = (ShmBlocks){ .max_size = TEST_SHM_PAGES * page };
+	int32 filled = 0;
+	while (shmBlocksAllocate(&blocks, 1, &a)) {
+		filled++;
+	}
+	testCheck(&report, filled == SHM_BLOCKS_CAPACITY && blocks.count == SHM_BLOCKS_CAPACITY,
+			"the list holds SHM_BLOCKS_CAPACITY blocks");
+
+	blocks = (ShmBlocks){ .max_size = TEST_SHM_PAGES * page };
+	bool8 used[TEST_SHM_PAGES] = { 0 };
+	int32 mismatches = 0;
+	bool8 well_formed = true;
+	uint32 random = 0x0BAD'F00Du;
+	for (int32 operation = 0; operation < TEST_SHM_OPERATIONS; ++operation) {
+		float32 roll = testRandomFloat(&random); // [-100, 100)
+		if (roll < 20.0f && blocks.count > 0) {
+			int32 index = (int32)(testRandomFloat(&random) + 100.0f) % blocks.count;
+			ShmBlock block = blocks.blocks[index];
+			shmBlocksFree(&blocks, block.offset);
+			memset(&used[block.offset / page], 0, (uint64)(block.size / page));
+		} else {
+			int32 size = 1 + (int32)((testRandomFloat(&random) + 100.0f) * 0.005f * 8 * page);
+			int32 pages = (size + page - 1) / page;
+			int32 expected = testShmFirstFit(used, pages);
+			bool8 full = blocks.count == SHM_BLOCKS_CAPACITY;
+			int32 offset = -1;
+			bool8 allocated = shmBlocksAllocate(&blocks, size, &offset);
+			if (allocated) {
+				mismatches += offset != expected * page;
+				memset(&used[offset / page], 1, (uint64)pages);
+			} else {
+				mismatches += !full && expected >= 0;
+			}
+		}
+		well_formed = well_formed && testShmWellFormed(&blocks);
+	}
+	testCheck(&report, mismatches == 0, "random blocks land on the first fit of a page map");
+	testCheck(&report, well_formed, "blocks stay sorted, aligned and apart");
+	return testSummary(&report);
+}
+
+[[nodiscard]] internal bool8 testReadAll(int32 fd, void* data, uint64 size)
+{
+	uint8* bytes = data;
+	while (size > 0) {
+		ssize_t done = read(fd, bytes, size);
+		if (done <= 0 && errno != EINTR) {
+			return false;
+		}
+		bytes += (done > 0) ? done : 0;
+		size -= (done > 0) ? (uint64)done : 0;
+	}
+	return true;
+}
+
+/*
+ * [EN] Reads the next raw frame of the capture and compares it with frame, padding left out.
+ * [ES] Lee el siguiente fotograma crudo de la captura y lo compara con frame, sin el relleno.
+ */
+internal bool8 testCaptureReadFrame(int32 fd, const Bitmap* frame, uint32* packed)
+{
+	uint64 row_size = (uint64)frame->width * sizeof(uint32);
+	if (!testReadAll(fd, packed, row_size * frame->height)) {
+		return false;
+	}
+	for (int32 row = 0; row < frame->height; ++row) {
+		if (memcmp((uint8*)packed + (row * row_size),
+				(const uint8*)frame->memory + ((int64)row * frame->bytes_per_row), row_size)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/*
+ * [EN] A 3x3 frame covers the odd column and the odd row, every value was worked out by hand
+ * from the BT.601 full range formulas of frame_capture.c. The ring is checked by capturing to a
+ * pipe nobody reads yet: the writer blocks on the first frame, bigger than the pipe, so the ring
+ * fills deterministically.
+ * [ES] Un fotograma de 3x3 cubre la columna impar y la fila impar, cada valor se calculó a mano con
+ * las fórmulas BT.601 de rango completo de frame_capture.c. El anillo se revisa capturando a un
+ * 'pipe' que nadie lee aún: el escritor se bloquea en el primer fotograma, más grande que el
+ * 'pipe', así el anillo se llena de forma determinista.
+ */
+internal int32 testCapture(void)
+{
+	TestReport report = { .name = "capture" };
+	testCheck(&report, frameCaptureYuv420Size(3, 3) == 17 && frameCaptureYuv420Size(1, 1) == 3
+			&& frameCaptureYuv420Size(2, 2) == 6 && frameCaptureYuv420Size(5, 1) == 11
+			&& frameCaptureYuv420Size(1920, 1080) == 3'110'400,
+			"frameCaptureYuv420Size() rounds chroma up");
+
+	// [EN] One padding pixel per row, never read | [ES] Un píxel de relleno por fila, nunca leído
+	uint32 pixels[3 * 4] = {
+		0xFFFF'FFFF, 0xFF00'0000, 0xFFFF'0000, 0xDEAD'BEEF, // white, black, red
+		0xFF00'FF00, 0xFF00'00FF, 0xFF80'8080, 0xDEAD'BEEF, // green, blue, gray
+		0xFFFF'FF00, 0xFF00'FFFF, 0xFFFF'00FF, 0xDEAD'BEEF, // yellow, cyan, magenta
+	};
+	Bitmap small = { .memory = pixels, .width = 3, .height = 3, .bytes_per_row = 4 * 4 };
+	uint8 yuv[18];
+	memset(yuv, 0xA5, sizeof(yuv));
+	frameCaptureConvertToYuv420(&small, yuv);
+	const uint8 luma[9] = { 255, 0, 77, 149, 29, 128, 226, 178, 106 };
+	const uint8 blue_chroma[4] = { 139, 107, 86, 213 };
+	const uint8 red_chroma[4] = { 96, 192, 75, 235 };
+	testCheck(&report, !memcmp(yuv, luma, sizeof(luma)), "luma of every pixel");
+	testCheck(&report, !memcmp(yuv + 9, blue_chroma, sizeof(blue_chroma))
+			&& !memcmp(yuv + 13, red_chroma, sizeof(red_chroma)),
+			"chroma averages the pixels of each block that exist");
+	testCheck(&report, yuv[17] == 0xA5, "nothing is written past the planes");
+
+	int32 fds[2];
+	int32 row_pixels = TEST_CAPTURE_WIDTH + TEST_CAPTURE_PADDING;
+	Bitmap frames[FRAME_CAPTURE_RING_SIZE + 1];
+	uint32* packed = malloc(sizeof(uint32) * TEST_CAPTURE_WIDTH * TEST_CAPTURE_HEIGHT);
+	FrameCapture* capture = malloc(sizeof(FrameCapture));
+	bool8 ready = packed && capture && pipe(fds) == 0;
+	for (int32 i = 0; i <= FRAME_CAPTURE_RING_SIZE; ++i) {
+		frames[i] = (Bitmap){ .memory = malloc(sizeof(uint32) * row_pixels * TEST_CAPTURE_HEIGHT),
+			.width = TEST_CAPTURE_WIDTH, .height = TEST_CAPTURE_HEIGHT,
+			.bytes_per_row = row_pixels * (int32)sizeof(uint32) };
+		ready = ready && frames[i].memory;
+	}
+	char path[TEST_PATH_SIZE];
+	snprintf(path, sizeof(path), "/proc/self/fd/%d", ready ? fds[1] : -1);
+	if (!ready || !frameCaptureStart(capture, path, FRAME_CAPTURE_RAW)) {
+		printf("FAIL capture: can't capture to a pipe\n");
+		return testSummary(&report) + 1;
+	}
+	for (int32 i = 0; i <= FRAME_CAPTURE_RING_SIZE; ++i) {
+		testFillPattern(&frames[i], (uint32)i);
+	}
+
+	int32 accepted = 0;
+	for (int32 i = 0; i < FRAME_CAPTURE_RING_SIZE; ++i) {
+		accepted += frameCaptureSubmit(capture, &frames[i]);
+	}
+	bool8 overflow = frameCaptureSubmit(capture, &frames[FRAME_CAPTURE_RING_SIZE]);
+	FrameCaptureStats stats = frameCaptureGetStats(capture);
+	testCheck(&report, accepted == FRAME_CAPTURE_RING_SIZE && !overflow
+			&& stats.submitted == FRAME_CAPTURE_RING_SIZE + 1 && stats.dropped == 1,
+			"a full ring drops the frame and counts it");
+
+	bool8 same = true;
+	for (int32 i = 0; i < FRAME_CAPTURE_RING_SIZE; ++i) {
+		same = same && testCaptureReadFrame(fds[0], &frames[i], packed);
+	}
+	testCheck(&report, same, "queued frames are written in order without their padding");
+	uint64 start = clockNowNanoseconds();
+	while (frameCaptureGetStats(capture).written < FRAME_CAPTURE_RING_SIZE
+			&& clockNowNanoseconds() - start < TEST_CAPTURE_TIMEOUT) {
+		sched_yield();
+	}
+
+	Bitmap resized = frames[0];
+	resized.width--;
+	bool8 resized_accepted = frameCaptureSubmit(capture, &resized);
+	bool8 accepted_after = frameCaptureSubmit(capture, &frames[FRAME_CAPTURE_RING_SIZE]);
+	testCheck(&report, accepted_after
+			&& testCaptureReadFrame(fds[0], &frames[FRAME_CAPTURE_RING_SIZE], packed),
+			"the ring takes frames again once written");
+	start = clockNowNanoseconds();
+	while (frameCaptureGetStats(capture).written < FRAME_CAPTURE_RING_SIZE + 1
+			&& clockNowNanoseconds() - start < TEST_CAPTURE_TIMEOUT) {
+		sched_yield();
+	}
+	stats = frameCaptureGetStats(capture);
+	testCheck(&report, !resized_accepted && stats.submitted == FRAME_CAPTURE_RING_SIZE + 3
+			&& stats.dropped == 2 && stats.written == FRAME_CAPTURE_RING_SIZE + 1,
+			"a frame of another size is dropped and counted");
+
+	frameCaptureStop(capture);
+	close(fds[0]);
+	close(fds[1]);
+	for (int32 i = 0; i <= FRAME_CAPTURE_RING_SIZE; ++i) {
+		free(frames[i].memory);
+	}
+	free(capture);
+	free(packed);
+	return testSummary(&report);
+}
+
+/*
+ * [EN] Deltas picked so every ratio is exact in binary.
+ * [ES] Deltas elegidos para que cada razón sea exacta en binario.
+ */
+internal int32 testPerf(void)
+{
+	TestReport report = { .name = "perf" };
+	const uint32 all = (1u << PERF_COUNTER_COUNT) - 1;
+	PerfSample previous = { .values = { 1000, 2000, 30, 40, 50, 1'000'000 }, .available = all };
+	PerfSample current = { .values = { 3000, 7000, 55, 50, 57, 5'000'000 }, .available = all };
+	PerfFrameStats stats = perfFrameStatsCompute(&previous, &current, PERF_COUNTERS_HARDWARE);
+	testCheck(&report, stats.instructions_per_cycle == 2.5f, "instructions per cycle");
+	testCheck(&report, stats.llc_misses_per_kilo_instruction == 5.0f
+			&& stats.dtlb_misses_per_kilo_instruction == 2.0f, "misses per kilo instruction");
+	testCheck(&report, stats.cpu_time == 4.0f && stats.page_faults == 7,
+			"CPU time in milliseconds and page faults");
+	testCheck(&report, stats.available == all && stats.mode == PERF_COUNTERS_HARDWARE,
+			"availability and mode pass through");
+
+	// [EN] Multiplexed estimates a little lower than the last read | [ES] Un poco más bajas
+	PerfSample behind = current;
+	behind.values[PERF_COUNTER_CYCLES] = 2990;
+	behind.values[PERF_COUNTER_INSTRUCTIONS] = 6990;
+	behind.values[PERF_COUNTER_TASK_CLOCK] = 4'999'000;
+	stats = perfFrameStatsCompute(&current, &behind, PERF_COUNTERS_HARDWARE);
+	testCheck(&report, stats.instructions_per_cycle == 0
+			&& stats.llc_misses_per_kilo_instruction == 0 && stats.cpu_time == 0,
+			"counters that step back count as zero, not as a wrap around");
+	behind.values[PERF_COUNTER_CYCLES] = 4000;
+	stats = perfFrameStatsCompute(&current, &behind, PERF_COUNTERS_HARDWARE);
+	testCheck(&report, stats.instructions_per_cycle == 0
+			&& stats.dtlb_misses_per_kilo_instruction == 0,
+			"no instructions give no ratios");
+
+	uint32 software = (1u << PERF_COUNTER_PAGE_FAULTS) | (1u << PERF_COUNTER_TASK_CLOCK);
+	PerfSample software_previous = { .values = { [PERF_COUNTER_TASK_CLOCK] = 500'000 },
+		.available = software };
+	PerfSample software_current = { .values = { [PERF_COUNTER_PAGE_FAULTS] = 3,
+		[PERF_COUNTER_TASK_CLOCK] = 2'500'000 }, .available = software };
+	stats = perfFrameStatsCompute(&software_previous, &software_current, PERF_COUNTERS_SOFTWARE);
+	testCheck(&report, stats.instructions_per_cycle == 0
+			&& stats.llc_misses_per_kilo_instruction == 0
+			&& stats.dtlb_misses_per_kilo_instruction == 0 && stats.cpu_time == 2.0f
+			&& stats.page_faults == 3 && stats.available == software,
+			"missing hardware counters give zeros, the software ones still count");
+	return testSummary(&report);
+}
+
+/*
+ * [EN] Every field of the n-th update derives from n, a copy mixing two updates doesn't add up.
+ * [ES] Cada campo de la actualización n-ésima deriva de n, una copia que mezcla dos no cuadra.
+ */
+internal void testLiveFill(LiveStats* stats, uint64 n)
+{
+	stats->update_time = n * 7;
+	stats->frame_count = n;
+	stats->events_dispatched = n * 3;
+	stats->frame_time = (float32)(n & 1023);
+	stats->buffer_count = (uint32)n ^ 0x5555;
+	for (int32 i = 0; i < LIVE_STATS_HISTOGRAM_BUCKETS; ++i) {
+		stats->frame_time_histogram[i] = (uint32)n + (uint32)i;
+	}
+}
+
+internal bool8 testLiveConsistent(const LiveStats* stats)
+{
+	uint64 n = stats->frame_count;
+	bool8 consistent = stats->update_time == n * 7 && stats->events_dispatched == n * 3
+		&& stats->frame_time == (float32)(n & 1023) && stats->buffer_count == ((uint32)n ^ 0x5555);
+	for (int32 i = 0; i < LIVE_STATS_HISTOGRAM_BUCKETS; ++i) {
+		consistent &= stats->frame_time_histogram[i] == (uint32)n + (uint32)i;
+	}
+	return consistent;
+}
+
+typedef struct {
+	LiveStatsPage page;
+	atomic_bool done;
+} TestLiveState;
+
+internal void* testLiveWriter(void* context)
+{
+	TestLiveState* state = context;
+	for (uint64 n = 1; n <= TEST_LIVE_WRITES; ++n) {
+		testLiveFill(liveStatsBeginWrite(&state->page), n);
+		liveStatsEndWrite(&state->page);
+	}
+	atomic_store(&state->done, true);
+	return nullptr;
+}
+
+internal int32 testLive(void)
+{
+	TestReport report = { .name = "live" };
+	TestLiveState* state = calloc(1, sizeof(TestLiveState));
+	if (!state) {
+		printf("FAIL live: out of memory\n");
+		return 1;
+	}
+
+	LiveStats stats;
+	testLiveFill(liveStatsBeginWrite(&state->page), 1);
+	testCheck(&report, !liveStatsRead(&state->page, &stats), "no read while a write is open");
+	liveStatsEndWrite(&state->page);
+	testCheck(&report, liveStatsRead(&state->page, &stats) && stats.frame_count == 1
+			&& testLiveConsistent(&stats) && atomic_load(&state->page.sequence) == 2,
+			"the update reads back once closed");
+
+	memset(&state->page, 0, sizeof(state->page));
+	testLiveFill(&state->page.stats, 0); // reads before the first update | antes de la primera
+	pthread_t writer;
+	if (pthread_create(&writer, nullptr, testLiveWriter, state) != 0) {
+		printf("FAIL live: can't start the writer\n");
+		free(state);
+		return 1;
+	}
+	int32 reads = 0;
+	int32 torn = 0;
+	int32 backwards = 0;
+	uint64 last = 0;
+	while (!atomic_load(&state->done)) {
+		if (liveStatsRead(&state->page, &stats)) {
+			reads++;
+			torn += !testLiveConsistent(&stats);
+			backwards += stats.frame_count < last;
+			last = stats.frame_count;
+		}
+	}
+	pthread_join(writer, nullptr);
+	testCheck(&report, reads > 0 && torn == 0 && backwards == 0,
+			"a reader racing the writer never gets a torn or older copy");
+	testCheck(&report, liveStatsRead(&state->page, &stats)
+			&& stats.frame_count == TEST_LIVE_WRITES && testLiveConsistent(&stats),
+			"the last update reads back");
+	free(state);
+
+	const int32 last_bucket = LIVE_STATS_HISTOGRAM_BUCKETS - 1;
+	testCheck(&report, liveStatsHistogramBucket(0) == 0 && liveStatsHistogramBucket(-1) == 0
+			&& liveStatsHistogramBucket(NAN) == 0 && liveStatsHistogramBucket(0.5f) == 0,
+			"zero, negative and NaN frame times fall in the first bucket");
+	testCheck(&report, liveStatsHistogramBucket(1) == 1 && liveStatsHistogramBucket(16.7f) == 16
+			&& liveStatsHistogramBucket(32.99f) == 32, "whole milliseconds pick the bucket");
+	testCheck(&report, liveStatsHistogramBucket(33) == last_bucket
+			&& liveStatsHistogramBucket(34) == last_bucket
+			&& liveStatsHistogramBucket(1e12f) == last_bucket
+			&& liveStatsHistogramBucket(INFINITY) == last_bucket, "the last bucket is open");
+	return testSummary(&report);
+}
+
+int32 main(int32 argument_count, char** arguments)
+{
+	int32 failures = 0;
+	bool8 all = argument_count == 1;
+	for (int32 i = 1; i < argument_count || all; ++i) {
+		const char* check = all ? "all" : arguments[i];
+		bool8 known = false;
+		if (all || !strcmp(check, "image")) {
+			const char* corpus = TEST_IMAGE_CORPUS;
+			if (!all && i + 1 < argument_count && strchr(arguments[i + 1], '/')) {
+				corpus = arguments[++i];
+			}
+			failures += testImage(corpus);
+			known = true;
+		}
+		if (all || !strcmp(check, "hud")) {
+			failures += testHud();
+			known = true;
+		}
+		if (all || !strcmp(check, "jobs")) {
+			failures += testJobs();
+			known = true;
+		}
+		if (all || !strcmp(check, "scale")) {
+			failures += testScale();
+			known = true;
+		}
+		if (all || !strcmp(check, "raster")) {
+			failures += testRaster();
+			known = true;
+		}
+		if (all || !strcmp(check, "math")) {
+			failures += testMath();
+			known = true;
+		}
+		if (all || !strcmp(check, "noise")) {
+			failures += testNoise();
+			known = true;
+		}
+		if (all || !strcmp(check, "replay")) {
+			failures += testReplay();
+			known = true;
+		}
+		if (all || !strcmp(check, "shm")) {
+			failures += testShm();
+			known = true;
+		}
+		if (all || !strcmp(check, "capture")) {
+			failures += testCapture();
+			known = true;
+		}
+		if (all || !strcmp(check, "perf")) {
+			failures += testPerf();
+			known = true;
+		}
+		if (all || !strcmp(check, "live")) {
+			failures += testLive();
+			known = true;
+		}
+		if (!known) {
+			fprintf(stderr, "usage: %s [image [corpus] | hud | jobs | scale | raster | math"
+					" | noise | replay | shm | capture | perf | live]...\n", arguments[0]);
+			return EXIT_FAILURE;
+		}
+		if (all) {
+			break;
+		}
+	}
+	return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,539 @@
+/* vector_math.c: vectors, matrices and quaternions | vectores, matrices y cuaterniones */
+
+#include "defines.h"
+#include "types.h"
+#include "vector_math.h"
+
+#include <math.h>
+
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+#endif
+#if defined(__AVX__)
+	#include <immintrin.h>
+#endif
+
+/*
+ * [EN] a * b + c rounded once (FMA) differs from rounding the product and the sum, keeping every
+ * path bit exact means never contracting. Restored at the end of the file for the unity build.
+ * [ES] a * b + c redondeado una vez (FMA) difiere de redondear el producto y la suma, mantener cada
+ * camino exacto significa nunca contraer. Se restablece al final del archivo por la compilación
+ * unitaria.
+ */
+#pragma STDC FP_CONTRACT OFF
+
+/*
+ * [EN] Wide types and operations for the batch functions, written once on top of them over
+ * VECTOR_MATH_LANES elements per iteration: 8 with AVX, 4 with SSE2 and 1 otherwise.
+ * [ES] Tipos y operaciones anchas para las funciones por lotes, escritas una vez sobre ellas con
+ * VECTOR_MATH_LANES elementos por iteración: 8 con AVX, 4 con SSE2 y 1 de otra forma.
+ */
+#if defined(__AVX__)
+	#define VECTOR_MATH_LANES 8
+typedef __m256 MathWide;
+
+internal inline MathWide mathWideSet(float32 value) { return _mm256_set1_ps(value); }
+internal inline MathWide mathWideLoad(const float32* p) { return _mm256_loadu_ps(p); }
+internal inline void mathWideStore(float32* p, MathWide a) { _mm256_storeu_ps(p, a); }
+internal inline MathWide mathWideAdd(MathWide a, MathWide b) { return _mm256_add_ps(a, b); }
+internal inline MathWide mathWideMul(MathWide a, MathWide b) { return _mm256_mul_ps(a, b); }
+internal inline MathWide mathWideDiv(MathWide a, MathWide b) { return _mm256_div_ps(a, b); }
+internal inline MathWide mathWideSqrt(MathWide a) { return _mm256_sqrt_ps(a); }
+internal inline MathWide mathWideSelectPositive(MathWide test, MathWide a, MathWide b)
+{
+	return _mm256_blendv_ps(b, a, _mm256_cmp_ps(test, _mm256_setzero_ps(), _CMP_GT_OQ));
+}
+#elif defined(__SSE2__)
+	#define VECTOR_MATH_LANES 4
+typedef __m128 MathWide;
+
+internal inline MathWide mathWideSet(float32 value) { return _mm_set1_ps(value); }
+internal inline MathWide mathWideLoad(const float32* p) { return _mm_loadu_ps(p); }
+internal inline void mathWideStore(float32* p, MathWide a) { _mm_storeu_ps(p, a); }
+internal inline MathWide mathWideAdd(MathWide a, MathWide b) { return _mm_add_ps(a, b); }
+internal inline MathWide mathWideMul(MathWide a, MathWide b) { return _mm_mul_ps(a, b); }
+internal inline MathWide mathWideDiv(MathWide a, MathWide b) { return _mm_div_ps(a, b); }
+internal inline MathWide mathWideSqrt(MathWide a) { return _mm_sqrt_ps(a); }
+internal inline MathWide mathWideSelectPositive(MathWide test, MathWide a, MathWide b)
+{
+	__m128 mask = _mm_cmpgt_ps(test, _mm_setzero_ps());
+	return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+#else
+	#define VECTOR_MATH_LANES 1
+typedef float32 MathWide;
+
+internal inline MathWide mathWideSet(float32 value) { return value; }
+internal inline MathWide mathWideLoad(const float32* p) { return *p; }
+internal inline void mathWideStore(float32* p, MathWide a) { *p = a; }
+internal inline MathWide mathWideAdd(MathWide a, MathWide b) { return a + b; }
+internal inline MathWide mathWideMul(MathWide a, MathWide b) { return a * b; }
+internal inline MathWide mathWideDiv(MathWide a, MathWide b) { return a / b; }
+internal inline MathWide mathWideSqrt(MathWide a) { return sqrtf(a); }
+internal inline MathWide mathWideSelectPositive(MathWide test, MathWide a, MathWide b)
+{
+	return (test > 0.0f) ? a : b;
+}
+#endif
+
+static_assert(VECTOR_MATH_BLOCK_LANES % VECTOR_MATH_LANES == 0, "Blocks must hold whole wides");
+
+#if defined(__SSE2__)
+internal inline __m128 vec4Load(Vec4 v) { return _mm_loadu_ps(&v.x); }
+
+internal inline Vec4 vec4Store(__m128 a)
+{
+	Vec4 v;
+	_mm_storeu_ps(&v.x, a);
+	return v;
+}
+
+internal inline __m128 vec4Splat(__m128 a, int32 lane)
+{
+	switch (lane) {
+	case 0: return _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0));
+	case 1: return _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1));
+	case 2: return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2));
+	default: return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3));
+	}
+}
+
+/*
+ * [EN] ((c0 * v.x + c1 * v.y) + c2 * v.z) + c3 * v.w, the order of the scalar expression.
+ * [ES] ((c0 * v.x + c1 * v.y) + c2 * v.z) + c3 * v.w, el orden de la expresión escalar.
+ */
+internal inline __m128 mat4TransformSse(const Mat4* m, __m128 v)
+{
+	__m128 result = _mm_mul_ps(vec4Load(m->columns[0]), vec4Splat(v, 0));
+	result = _mm_add_ps(result, _mm_mul_ps(vec4Load(m->columns[1]), vec4Splat(v, 1)));
+	result = _mm_add_ps(result, _mm_mul_ps(vec4Load(m->columns[2]), vec4Splat(v, 2)));
+	return _mm_add_ps(result, _mm_mul_ps(vec4Load(m->columns[3]), vec4Splat(v, 3)));
+}
+#endif
+
+#if defined(__AVX__)
+/*
+ * [EN] Two Vec4 at once, each 128-bit half against a copy of the columns.
+ * [ES] Dos Vec4 a la vez, cada mitad de 128 bits contra una copia de las columnas.
+ */
+internal inline __m256 mat4TransformAvx(const __m256 columns[4], __m256 v)
+{
+	__m256 result = _mm256_mul_ps(columns[0], _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+	result = _mm256_add_ps(result, _mm256_mul_ps(columns[1],
+				_mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1))));
+	result = _mm256_add_ps(result, _mm256_mul_ps(columns[2],
+				_mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2))));
+	return _mm256_add_ps(result, _mm256_mul_ps(columns[3],
+				_mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3))));
+}
+
+internal inline void mat4BroadcastColumns(const Mat4* m, __m256 columns[4])
+{
+	for (int32 i = 0; i < 4; ++i) {
+		columns[i] = _mm256_broadcast_ps((const __m128*)&m->columns[i]);
+	}
+}
+#endif
+
+/* Vec2 */
+
+Vec2 vec2Add(Vec2 a, Vec2 b) { return (Vec2){ a.x + b.x, a.y + b.y }; }
+Vec2 vec2Subtract(Vec2 a, Vec2 b) { return (Vec2){ a.x - b.x, a.y - b.y }; }
+Vec2 vec2Scale(Vec2 v, float32 scale) { return (Vec2){ v.x * scale, v.y * scale }; }
+float32 vec2Dot(Vec2 a, Vec2 b) { return a.x * b.x + a.y * b.y; }
+float32 vec2Length(Vec2 v) { return sqrtf(vec2Dot(v, v)); }
+
+/* Vec3 */
+
+Vec3 vec3Add(Vec3 a, Vec3 b) { return (Vec3){ a.x + b.x, a.y + b.y, a.z + b.z }; }
+Vec3 vec3Subtract(Vec3 a, Vec3 b) { return (Vec3){ a.x - b.x, a.y - b.y, a.z - b.z }; }
+Vec3 vec3Scale(Vec3 v, float32 scale) { return (Vec3){ v.x * scale, v.y * scale, v.z * scale }; }
+float32 vec3Dot(Vec3 a, Vec3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+float32 vec3Length(Vec3 v) { return sqrtf(vec3Dot(v, v)); }
+
+Vec3 vec3Cross(Vec3 a, Vec3 b)
+{
+	return (Vec3){ a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+Vec3 vec3Normalize(Vec3 v)
+{
+	float32 length = vec3Length(v);
+	if (length > 0.0f) { // same division as vec3NormalizeWide() | misma división
+		return (Vec3){ v.x / length, v.y / length, v.z / length };
+	}
+	return v;
+}
+
+/* Vec4 */
+
+Vec4 vec4Add(Vec4 a, Vec4 b)
+{
+#if defined(__SSE2__)
+	return vec4Store(_mm_add_ps(vec4Load(a), vec4Load(b)));
+#else
+	return (Vec4){ a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w };
+#endif
+}
+
+Vec4 vec4Subtract(Vec4 a, Vec4 b)
+{
+#if defined(__SSE2__)
+	return vec4Store(_mm_sub_ps(vec4Load(a), vec4Load(b)));
+#else
+	return (Vec4){ a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w };
+#endif
+}
+
+Vec4 vec4Multiply(Vec4 a, Vec4 b)
+{
+#if defined(__SSE2__)
+	return vec4Store(_mm_mul_ps(vec4Load(a), vec4Load(b)));
+#else
+	return (Vec4){ a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w };
+#endif
+}
+
+Vec4 vec4Scale(Vec4 v, float32 scale)
+{
+#if defined(__SSE2__)
+	return vec4Store(_mm_mul_ps(vec4Load(v), _mm_set1_ps(scale)));
+#else
+	return (Vec4){ v.x * scale, v.y * scale, v.z * scale, v.w * scale };
+#endif
+}
+
+float32 vec4Dot(Vec4 a, Vec4 b)
+{
+#if defined(__SSE2__)
+	// [EN] Added left to right like the scalar sum | [ES] Sumado de izquierda a derecha
+	__m128 products = _mm_mul_ps(vec4Load(a), vec4Load(b));
+	__m128 sum = _mm_add_ss(products, vec4Splat(products, 1));
+	sum = _mm_add_ss(sum, vec4Splat(products, 2));
+	return _mm_cvtss_f32(_mm_add_ss(sum, vec4Splat(products, 3)));
+#else
+	return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+#endif
+}
+
+/* Mat3 */
+
+Mat3 mat3Identity(void)
+{
+	return (Mat3){ .columns = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f },
+		{ 0.0f, 0.0f, 1.0f } } };
+}
+
+Vec3 mat3TransformVec3(const Mat3* m, Vec3 v)
+{
+	const Vec3* c = m->columns;
+	return (Vec3){
+		c[0].x * v.x + c[1].x * v.y + c[2].x * v.z,
+		c[0].y * v.x + c[1].y * v.y + c[2].y * v.z,
+		c[0].z * v.x + c[1].z * v.y + c[2].z * v.z,
+	};
+}
+
+Mat3 mat3Multiply(const Mat3* a, const Mat3* b)
+{
+	Mat3 result;
+	for (int32 i = 0; i < 3; ++i) {
+		result.columns[i] = mat3TransformVec3(a, b->columns[i]);
+	}
+	return result;
+}
+
+Mat3 mat3Transpose(const Mat3* m)
+{
+	const Vec3* c = m->columns;
+	return (Mat3){ .columns = { { c[0].x, c[1].x, c[2].x }, { c[0].y, c[1].y, c[2].y },
+		{ c[0].z, c[1].z, c[2].z } } };
+}
+
+Mat3 mat3FromMat4(const Mat4* m)
+{
+	Mat3 result;
+	for (int32 i = 0; i < 3; ++i) {
+		result.columns[i] = (Vec3){ m->columns[i].x, m->columns[i].y, m->columns[i].z };
+	}
+	return result;
+}
+
+Mat3 mat3FromQuat(Quat q)
+{
+	float32 xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+	float32 xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+	float32 wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+	return (Mat3){ .columns = {
+		{ 1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy) },
+		{ 2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx) },
+		{ 2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy) },
+	} };
+}
+
+/* Mat4 */
+
+Mat4 mat4Identity(void)
+{
+	return mat4Scaling((Vec3){ 1.0f, 1.0f, 1.0f });
+}
+
+Mat4 mat4Translation(Vec3 offset)
+{
+	Mat4 result = mat4Identity();
+	result.columns[3] = (Vec4){ offset.x, offset.y, offset.z, 1.0f };
+	return result;
+}
+
+Mat4 mat4Scaling(Vec3 scale)
+{
+	return (Mat4){ .columns = { { scale.x, 0.0f, 0.0f, 0.0f }, { 0.0f, scale.y, 0.0f, 0.0f },
+		{ 0.0f, 0.0f, scale.z, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f } } };
+}
+
+Mat4 mat4FromTransform(Vec3 translation, Quat rotation, Vec3 scale)
+{
+	Mat3 r = mat3FromQuat(rotation);
+	Vec3 x = vec3Scale(r.columns[0], scale.x);
+	Vec3 y = vec3Scale(r.columns[1], scale.y);
+	Vec3 z = vec3Scale(r.columns[2], scale.z);
+	return (Mat4){ .columns = { { x.x, x.y, x.z, 0.0f }, { y.x, y.y, y.z, 0.0f },
+		{ z.x, z.y, z.z, 0.0f }, { translation.x, translation.y, translation.z, 1.0f } } };
+}
+
+/*
+ * [EN] Maps -near to -1 and -far to 1 after the divide, the camera looks down -z.
+ * [ES] Lleva -near a -1 y -far a 1 tras la división, la cámara mira hacia -z.
+ */
+Mat4 mat4Perspective(float32 vertical_fov, float32 aspect, float32 near, float32 far)
+{
+	float32 focal = 1.0f / tanf(vertical_fov * 0.5f);
+	float32 depth = near - far;
+	return (Mat4){ .columns = { { focal / aspect, 0.0f, 0.0f, 0.0f }, { 0.0f, focal, 0.0f, 0.0f },
+		{ 0.0f, 0.0f, (far + near) / depth, -1.0f },
+		{ 0.0f, 0.0f, (2.0f * far * near) / depth, 0.0f } } };
+}
+
+Vec4 mat4TransformVec4(const Mat4* m, Vec4 v)
+{
+#if defined(__SSE2__)
+	return vec4Store(mat4TransformSse(m, vec4Load(v)));
+#else
+	const Vec4* c = m->columns;
+	return (Vec4){
+		c[0].x * v.x + c[1].x * v.y + c[2].x * v.z + c[3].x * v.w,
+		c[0].y * v.x + c[1].y * v.y + c[2].y * v.z + c[3].y * v.w,
+		c[0].z * v.x + c[1].z * v.y + c[2].z * v.z + c[3].z * v.w,
+		c[0].w * v.x + c[1].w * v.y + c[2].w * v.z + c[3].w * v.w,
+	};
+#endif
+}
+
+Vec4 mat4TransformPoint(const Mat4* m, Vec3 point)
+{
+	// [EN] c3 * 1 is exact, so it's added as is | [ES] c3 * 1 es exacto, se suma tal cual
+	const Vec4* c = m->columns;
+	return (Vec4){
+		c[0].x * point.x + c[1].x * point.y + c[2].x * point.z + c[3].x,
+		c[0].y * point.x + c[1].y * point.y + c[2].y * point.z + c[3].y,
+		c[0].z * point.x + c[1].z * point.y + c[2].z * point.z + c[3].z,
+		c[0].w * point.x + c[1].w * point.y + c[2].w * point.z + c[3].w,
+	};
+}
+
+Mat4 mat4Multiply(const Mat4* a, const Mat4* b)
+{
+	Mat4 result;
+#if defined(__AVX__)
+	__m256 columns[4];
+	mat4BroadcastColumns(a, columns);
+	for (int32 i = 0; i < 4; i += 2) {
+		_mm256_storeu_ps(&result.columns[i].x,
+				mat4TransformAvx(columns, _mm256_loadu_ps(&b->columns[i].x)));
+	}
+#else
+	for (int32 i = 0; i < 4; ++i) {
+		result.columns[i] = mat4TransformVec4(a, b->columns[i]);
+	}
+#endif
+	return result;
+}
+
+Mat4 mat4Transpose(const Mat4* m)
+{
+	Mat4 result;
+#if defined(__SSE2__)
+	__m128 c0 = vec4Load(m->columns[0]);
+	__m128 c1 = vec4Load(m->columns[1]);
+	__m128 c2 = vec4Load(m->columns[2]);
+	__m128 c3 = vec4Load(m->columns[3]);
+	_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+	result.columns[0] = vec4Store(c0);
+	result.columns[1] = vec4Store(c1);
+	result.columns[2] = vec4Store(c2);
+	result.columns[3] = vec4Store(c3);
+#else
+	const float32* source = &m->columns[0].x;
+	float32* destination = &result.columns[0].x;
+	for (int32 column = 0; column < 4; ++column) {
+		for (int32 row = 0; row < 4; ++row) {
+			destination[(row * 4) + column] = source[(column * 4) + row];
+		}
+	}
+#endif
+	return result;
+}
+
+/* Quat */
+
+Quat quatIdentity(void)
+{
+	return (Quat){ 0.0f, 0.0f, 0.0f, 1.0f };
+}
+
+Quat quatFromAxisAngle(Vec3 axis, float32 angle)
+{
+	float32 s = sinf(angle * 0.5f);
+	return (Quat){ axis.x * s, axis.y * s, axis.z * s, cosf(angle * 0.5f) };
+}
+
+Quat quatMultiply(Quat a, Quat b)
+{
+	return (Quat){
+		a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+		a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+		a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+		a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+	};
+}
+
+Quat quatConjugate(Quat q)
+{
+	return (Quat){ -q.x, -q.y, -q.z, q.w };
+}
+
+Quat quatNormalize(Quat q)
+{
+	float32 length = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+	if (length > 0.0f) {
+		return (Quat){ q.x / length, q.y / length, q.z / length, q.w / length };
+	}
+	return quatIdentity();
+}
+
+Quat quatNlerp(Quat a, Quat b, float32 t)
+{
+	// [EN] q and -q are the same rotation, take the closer one | [ES] q y -q son la misma rotación
+	float32 sign = (a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w < 0.0f) ? -1.0f : 1.0f;
+	float32 s = 1.0f - t;
+	float32 u = t * sign;
+	return quatNormalize((Quat){ a.x * s + b.x * u, a.y * s + b.y * u, a.z * s + b.z * u,
+			a.w * s + b.w * u });
+}
+
+/*
+ * [EN] v + w * t + q.xyz x t with t = 2 * (q.xyz x v), cheaper than q * v * q^-1.
+ * [ES] v + w * t + q.xyz x t con t = 2 * (q.xyz x v), más barato que q * v * q^-1.
+ */
+Vec3 quatRotateVec3(Quat q, Vec3 v)
+{
+	Vec3 axis = { q.x, q.y, q.z };
+	Vec3 t = vec3Scale(vec3Cross(axis, v), 2.0f);
+	return vec3Add(vec3Add(v, vec3Scale(t, q.w)), vec3Cross(axis, t));
+}
+
+/* Batches | Lotes */
+
+void mat4TransformVec4s(const Mat4* m, const Vec4* vectors, Vec4* result, int32 count)
+{
+	int32 i = 0;
+#if defined(__AVX__)
+	__m256 columns[4];
+	mat4BroadcastColumns(m, columns);
+	for (; i + 2 <= count; i += 2) {
+		_mm256_storeu_ps(&result[i].x, mat4TransformAvx(columns, _mm256_loadu_ps(&vectors[i].x)));
+	}
+#endif
+	for (; i < count; ++i) {
+		result[i] = mat4TransformVec4(m, vectors[i]);
+	}
+}
+
+void mat4TransformPointsWide(const Mat4* m, const Vec3x8* points, Vec4x8* result, int32 count)
+{
+	// [EN] Matrix entries splatted once, [column][row] | [ES] Entradas replicadas una vez
+	MathWide c[4][4];
+	for (int32 column = 0; column < 4; ++column) {
+		const float32* entries = &m->columns[column].x;
+		for (int32 row = 0; row < 4; ++row) {
+			c[column][row] = mathWideSet(entries[row]);
+		}
+	}
+
+	for (int32 block = 0; block < count; ++block) {
+		const Vec3x8* in = &points[block];
+		Vec4x8* out = &result[block];
+		for (int32 lane = 0; lane < VECTOR_MATH_BLOCK_LANES; lane += VECTOR_MATH_LANES) {
+			MathWide x = mathWideLoad(&in->x[lane]);
+			MathWide y = mathWideLoad(&in->y[lane]);
+			MathWide z = mathWideLoad(&in->z[lane]);
+			float32* rows[4] = { &out->x[lane], &out->y[lane], &out->z[lane], &out->w[lane] };
+			for (int32 row = 0; row < 4; ++row) {
+				MathWide value = mathWideMul(c[0][row], x);
+				value = mathWideAdd(value, mathWideMul(c[1][row], y));
+				value = mathWideAdd(value, mathWideMul(c[2][row], z));
+				mathWideStore(rows[row], mathWideAdd(value, c[3][row]));
+			}
+		}
+	}
+}
+
+void mat3TransformVec3sWide(const Mat3* m, const Vec3x8* vectors, Vec3x8* result, int32 count)
+{
+	MathWide c[3][3];
+	for (int32 column = 0; column < 3; ++column) {
+		const float32* entries = &m->columns[column].x;
+		for (int32 row = 0; row < 3; ++row) {
+			c[column][row] = mathWideSet(entries[row]);
+		}
+	}
+
+	for (int32 block = 0; block < count; ++block) {
+		const Vec3x8* in = &vectors[block];
+		Vec3x8* out = &result[block];
+		for (int32 lane = 0; lane < VECTOR_MATH_BLOCK_LANES; lane += VECTOR_MATH_LANES) {
+			MathWide x = mathWideLoad(&in->x[lane]);
+			MathWide y = mathWideLoad(&in->y[lane]);
+			MathWide z = mathWideLoad(&in->z[lane]);
+			float32* rows[3] = { &out->x[lane], &out->y[lane], &out->z[lane] };
+			for (int32 row = 0; row < 3; ++row) {
+				MathWide value = mathWideMul(c[0][row], x);
+				value = mathWideAdd(value, mathWideMul(c[1][row], y));
+				mathWideStore(rows[row], mathWideAdd(value, mathWideMul(c[2][row], z)));
+			}
+		}
+	}
+}
+
+void vec3NormalizeWide(const Vec3x8* vectors, Vec3x8* result, int32 count)
+{
+	for (int32 block = 0; block < count; ++block) {
+		const Vec3x8* in = &vectors[block];
+		Vec3x8* out = &result[block];
+		for (int32 lane = 0; lane < VECTOR_MATH_BLOCK_LANES; lane += VECTOR_MATH_LANES) {
+			MathWide x = mathWideLoad(&in->x[lane]);
+			MathWide y = mathWideLoad(&in->y[lane]);
+			MathWide z = mathWideLoad(&in->z[lane]);
+			MathWide length = mathWideAdd(mathWideAdd(mathWideMul(x, x), mathWideMul(y, y)),
+					mathWideMul(z, z));
+			length = mathWideSqrt(length);
+			mathWideStore(&out->x[lane], mathWideSelectPositive(length, mathWideDiv(x, length), x));
+			mathWideStore(&out->y[lane], mathWideSelectPositive(length, mathWideDiv(y, length), y));
+			mathWideStore(&out->z[lane], mathWideSelectPositive(length, mathWideDiv(z, length), z));
+		}
+	}
+}
+
+#pragma STDC FP_CONTRACT DEFAULT
+
+/* 18/10/2026 - kanso engine */
@@ -0,0 +1,124 @@
+/* vector_math.h: vectors, matrices and quaternions | vectores, matrices y cuaterniones */
+
+#pragma once
+#include "types.h"
+
+/*
+ * [EN] Matrices are column-major and multiply column vectors (v' = M * v), clip space follows the
+ * OpenGL convention used by the rasterizer. Every function gives the same bits with AVX, SSE2 or
+ * the scalar fallback: the SIMD paths only use lane-wise IEEE operations in the same order as the
+ * scalar expressions, and contraction into FMA is disabled in vector_math.c.
+ * [ES] Las matrices se guardan por columnas y multiplican vectores columna (v' = M * v), el espacio
+ * de recorte sigue la convención de OpenGL usada por el rasterizador. Cada función da los mismos
+ * bits con AVX, SSE2 o la versión escalar: los caminos SIMD solo usan operaciones IEEE por carril
+ * en el mismo orden que las expresiones escalares, y la contracción a FMA está desactivada en
+ * vector_math.c.
+ */
+typedef struct {
+	float32 x, y;
+} Vec2;
+
+typedef struct {
+	float32 x, y, z;
+} Vec3;
+
+typedef struct {
+	float32 x, y, z, w;
+} Vec4;
+
+typedef struct {
+	float32 x, y, z, w; // w is the real part | w es la parte real
+} Quat;
+
+typedef struct {
+	Vec3 columns[3];
+} Mat3;
+
+typedef struct {
+	Vec4 columns[4];
+} Mat4;
+
+/*
+ * [EN] Structure of arrays blocks for batch work, lane i of every member is the i-th element.
+ * [ES] Bloques de estructura de arreglos para trabajo por lotes, el carril i de cada miembro es el
+ * i-ésimo elemento.
+ */
+#define VECTOR_MATH_BLOCK_LANES 8
+
+typedef struct {
+	float32 x[VECTOR_MATH_BLOCK_LANES];
+	float32 y[VECTOR_MATH_BLOCK_LANES];
+	float32 z[VECTOR_MATH_BLOCK_LANES];
+} Vec3x8;
+
+typedef struct {
+	float32 x[VECTOR_MATH_BLOCK_LANES];
+	float32 y[VECTOR_MATH_BLOCK_LANES];
+	float32 z[VECTOR_MATH_BLOCK_LANES];
+	float32 w[VECTOR_MATH_BLOCK_LANES];
+} Vec4x8;
+
+/* Vec2 */
+Vec2 vec2Add(Vec2 a, Vec2 b);
+Vec2 vec2Subtract(Vec2 a, Vec2 b);
+Vec2 vec2Scale(Vec2 v, float32 scale);
+float32 vec2Dot(Vec2 a, Vec2 b);
+float32 vec2Length(Vec2 v);
+
+/* Vec3 */
+Vec3 vec3Add(Vec3 a, Vec3 b);
+Vec3 vec3Subtract(Vec3 a, Vec3 b);
+Vec3 vec3Scale(Vec3 v, float32 scale);
+float32 vec3Dot(Vec3 a, Vec3 b);
+Vec3 vec3Cross(Vec3 a, Vec3 b);
+float32 vec3Length(Vec3 v);
+Vec3 vec3Normalize(Vec3 v); // zero stays zero | cero se queda en cero
+
+/* Vec4 */
+Vec4 vec4Add(Vec4 a, Vec4 b);
+Vec4 vec4Subtract(Vec4 a, Vec4 b);
+Vec4 vec4Multiply(Vec4 a, Vec4 b); // per component | por componente
+Vec4 vec4Scale(Vec4 v, float32 scale);
+float32 vec4Dot(Vec4 a, Vec4 b);
+
+/* Mat3 */
+Mat3 mat3Identity(void);
+Mat3 mat3Multiply(const Mat3* a, const Mat3* b);
+Mat3 mat3Transpose(const Mat3* m);
+Vec3 mat3TransformVec3(const Mat3* m, Vec3 v);
+Mat3 mat3FromMat4(const Mat4* m); // upper left 3x3 | 3x3 superior izquierda
+Mat3 mat3FromQuat(Quat q); // q must be unit length | q debe ser unitario
+
+/* Mat4 */
+Mat4 mat4Identity(void);
+Mat4 mat4Translation(Vec3 offset);
+Mat4 mat4Scaling(Vec3 scale);
+Mat4 mat4FromTransform(Vec3 translation, Quat rotation, Vec3 scale); // T * R * S
+Mat4 mat4Perspective(float32 vertical_fov, float32 aspect, float32 near, float32 far); // radians
+Mat4 mat4Multiply(const Mat4* a, const Mat4* b);
+Mat4 mat4Transpose(const Mat4* m);
+Vec4 mat4TransformVec4(const Mat4* m, Vec4 v);
+Vec4 mat4TransformPoint(const Mat4* m, Vec3 point); // w = 1
+
+/* Quat */
+Quat quatIdentity(void);
+Quat quatFromAxisAngle(Vec3 axis, float32 angle); // unit axis, radians | eje unitario, radianes
+Quat quatMultiply(Quat a, Quat b); // applies b, then a | aplica b, luego a
+Quat quatConjugate(Quat q);
+Quat quatNormalize(Quat q);
+Quat quatNlerp(Quat a, Quat b, float32 t); // shortest path | camino más corto
+Vec3 quatRotateVec3(Quat q, Vec3 v);
+
+/*
+ * [EN] Batches. mat4TransformVec4s() works on arrays of Vec4, the rest on count blocks of
+ * VECTOR_MATH_BLOCK_LANES elements, pad the last block. Input and output may be the same memory.
+ * [ES] Lotes. mat4TransformVec4s() trabaja sobre arreglos de Vec4, el resto sobre count bloques de
+ * VECTOR_MATH_BLOCK_LANES elementos, rellena el último bloque. La entrada y la salida pueden ser la
+ * misma memoria.
+ */
+void mat4TransformVec4s(const Mat4* m, const Vec4* vectors, Vec4* result, int32 count);
+void mat4TransformPointsWide(const Mat4* m, const Vec3x8* points, Vec4x8* result, int32 count);
+void mat3TransformVec3sWide(const Mat3* m, const Vec3x8* vectors, Vec3x8* result, int32 count);
+void vec3NormalizeWide(const Vec3x8* vectors, Vec3x8* result, int32 count);
+
+/* 18/10/2026 - kanso engine */